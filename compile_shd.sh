@@ -1,3 +1,12 @@
 mkdir -p shd/bin
 glslc shd/default.vert -o shd/bin/default.vert.spv
 glslc shd/default.frag -o shd/bin/default.frag.spv
+glslc shd/fullscreen.vert -o shd/bin/fullscreen.vert.spv
+glslc shd/post.frag -o shd/bin/post.frag.spv
+glslc shd/post_fused.frag -o shd/bin/post_fused.frag.spv
+glslc shd/bloom_down.comp -o shd/bin/bloom_down.comp.spv
+glslc shd/bloom_up.comp -o shd/bin/bloom_up.comp.spv
+glslc shd/tonemap.comp -o shd/bin/tonemap.comp.spv
+glslc shd/fxaa.comp -o shd/bin/fxaa.comp.spv
+glslc shd/particle.vert -o shd/bin/particle.vert.spv
+glslc shd/particles.comp -o shd/bin/particles.comp.spv
@@ -1,10 +1,15 @@
 #version 450
 #extension GL_ARB_separate_shader_objects : enable
 
+layout(constant_id = 0) const bool grayscale = false;
+
 layout(location = 0) out vec4 outColor;
 
 layout(location = 0) in vec3 fragColor;
 
 void main() {
-    outColor = vec4(fragColor, 1.0);
+    if(grayscale)
+        outColor = vec4(vec3(dot(fragColor, vec3(0.2126, 0.7152, 0.0722))), 1.0);
+    else
+        outColor = vec4(fragColor, 1.0);
 }
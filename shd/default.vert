@@ -1,12 +1,23 @@
 #version 450
 #extension GL_ARB_separate_shader_objects : enable
 
+layout(set = 0, binding = 0) uniform Frame {
+    mat4 viewProjection;
+} frame;
+
+layout(push_constant) uniform Object {
+    mat4 transform;
+} object;
+
 layout(location = 0) in vec2 inPosition;
 layout(location = 1) in vec3 inColor;
 
 layout(location = 0) out vec3 fragColor;
 
+// same depth in depth prepass and main pass
+invariant gl_Position;
+
 void main() {
-    gl_Position = vec4(inPosition, 0.0, 1.0);
+    gl_Position = frame.viewProjection * object.transform * vec4(inPosition, 0.0, 1.0);
     fragColor = inColor;
 }
@@ -0,0 +1,16 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+layout(constant_id = 0) const float vignette = 0.0;
+
+layout(set = 0, binding = 0) uniform sampler2D source;
+
+layout(location = 0) in vec2 fragTexCoord;
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    vec2 center = fragTexCoord - vec2(0.5);
+
+    outColor = vec4(texture(source, fragTexCoord).rgb * (1.0 - vignette * dot(center, center)), 1.0);
+}
@@ -0,0 +1,17 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+layout(constant_id = 0) const float vignette = 0.0;
+
+// same pixel of the previous subpass (stays on-chip on tile-based GPUs)
+layout(input_attachment_index = 0, set = 0, binding = 0) uniform subpassInput source;
+
+layout(location = 0) in vec2 fragTexCoord;
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    vec2 center = fragTexCoord - vec2(0.5);
+
+    outColor = vec4(subpassLoad(source).rgb * (1.0 - vignette * dot(center, center)), 1.0);
+}
@@ -0,0 +1,239 @@
+/*
+ * WrapperBench.cpp
+ *
+ * Microbenchmark measuring the creation and destruction of the wrappers for the Vulkan API.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#include "WrapperBench.hpp"
+
+namespace spacelite::Bench {
+
+/* STATIC CONSTANTS */
+const Struct::AppInfo WrapperBench::appInfo("vulkan-triangle-bench", 1, 0, 0);
+const Struct::EngineInfo WrapperBench::engineInfo(
+		ENGINE_NAME,
+		ENGINE_VERSION_MAJOR,
+		ENGINE_VERSION_MINOR,
+		ENGINE_VERSION_PATCH,
+		ENGINE_VULKAN_VERSION
+);
+const Struct::VulkanRequirements WrapperBench::vulkanRequirements(
+		{ "VK_LAYER_KHRONOS_validation" },
+		{ VK_KHR_SWAPCHAIN_EXTENSION_NAME }
+);
+const Struct::ShaderFiles WrapperBench::shaderFiles = {
+		"shd/bin/default.vert.spv",
+		"shd/bin/default.frag.spv"
+};
+const unsigned long WrapperBench::bufferSize = 1024 * 1024;
+const unsigned int WrapperBench::numberOfCommandBuffers = 3;
+/* END STATIC CONSTANTS */
+
+// constructor: parse the command line
+WrapperBench::WrapperBench(int argc, char * argv[]) : repetitions(20), outputFile("bench.json") {
+	for(int n = 1; n < argc; ++n) {
+		const std::string argument(argv[n]);
+		const auto separator = argument.find('=');
+		const std::string option(argument.substr(0, separator));
+		const std::string value(separator == std::string::npos ? "" : argument.substr(separator + 1));
+
+		try {
+			if(option == "--repetitions")
+				this->repetitions = std::stoul(value);
+			else if(option == "--output" && !value.empty())
+				this->outputFile = value;
+			else
+				throw Exception("Invalid argument: " + argument);
+		}
+		catch(const std::exception&) {
+			throw Exception("Invalid argument: " + argument);
+		}
+	}
+
+	if(!(this->repetitions))
+		throw Exception("Invalid number of repetitions: 0");
+}
+
+// run the benchmark, keeping the wrappers needed by the measured ones alive
+int WrapperBench::run() {
+	try {
+		// hidden window (also initializing GLFW, which is needed to get the extensions required by the instance)
+		Main::Window window(Struct::WinProp(WrapperBench::appInfo.name, 800, 600, false));
+
+		// instance
+		this->measure("VulkanInstance", [this]() { return this->createInstance(); });
+
+		auto vulkanInstance = this->createInstance();
+
+		Wrapper::VulkanSurface vulkanSurface(*vulkanInstance, window);
+		Wrapper::VulkanPhysicalDevice vulkanPhysicalDevice(
+				*vulkanInstance,
+				vulkanSurface,
+				WrapperBench::vulkanRequirements.deviceExtensions
+		);
+
+		// device
+		this->measure("VulkanDevice", [&vulkanPhysicalDevice]() {
+			return std::make_unique<Wrapper::VulkanDevice>(vulkanPhysicalDevice, WrapperBench::vulkanRequirements);
+		});
+
+		Wrapper::VulkanDevice vulkanDevice(vulkanPhysicalDevice, WrapperBench::vulkanRequirements);
+
+		// swap chain
+		this->measure("VulkanSwapChain", [&]() {
+			return std::make_unique<Wrapper::VulkanSwapChain>(
+					vulkanDevice,
+					window,
+					vulkanSurface,
+					vulkanPhysicalDevice,
+					2
+			);
+		});
+
+		Wrapper::VulkanSwapChain vulkanSwapChain(vulkanDevice, window, vulkanSurface, vulkanPhysicalDevice, 2);
+		Wrapper::VulkanRenderPass vulkanRenderPass(vulkanDevice, vulkanSwapChain.getImageFormat());
+
+		// pipeline (without pipeline cache, i.e. compiling the shaders each time)
+		this->measure("VulkanPipeline", [&vulkanDevice, &vulkanRenderPass]() {
+			return std::make_unique<Wrapper::VulkanPipeline>(vulkanDevice, vulkanRenderPass, WrapperBench::shaderFiles);
+		});
+
+		Wrapper::VulkanCommandPool vulkanCommandPool(
+				vulkanDevice,
+				vulkanDevice.getGraphicsQueue(),
+				VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT
+		);
+
+		// buffer (device-local, including the allocation of its memory)
+		this->measure("VulkanBuffer", [&]() {
+			return std::make_unique<Wrapper::VulkanBuffer>(
+					vulkanDevice,
+					vulkanPhysicalDevice,
+					vulkanCommandPool,
+					WrapperBench::bufferSize,
+					true,
+					VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+					VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+			);
+		});
+
+		// command buffers
+		this->measure("VulkanCommandBuffers", [&vulkanDevice, &vulkanCommandPool]() {
+			return std::make_unique<Wrapper::VulkanCommandBuffers>(
+					vulkanDevice,
+					vulkanCommandPool,
+					WrapperBench::numberOfCommandBuffers
+			);
+		});
+
+		this->print();
+		this->write(vulkanPhysicalDevice.getProperties());
+	}
+	catch(const Main::Exception& exception) {
+		Helper::Log::error() << exception.what();
+
+		return EXIT_FAILURE;
+	}
+	catch(const std::exception& exception) {
+		Helper::Log::error() << "Unexpected error: " << exception.what();
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+// print the results to stdout (median times of all repetitions but the first one)
+//  NOTE:	The table is written directly instead of being logged, so that it can be redirected on its own,
+//			but only after all messages logged so far, so that they will not be interleaved with it.
+void WrapperBench::print() const {
+	Helper::Log::flush();
+
+	std::cout	<< std::setw(24) << std::left << "wrapper"
+				<< std::setw(12) << std::right << "first [ms]"
+				<< std::setw(14) << "create [ms]"
+				<< std::setw(15) << "destroy [ms]"
+				<< '\n';
+
+	for(const auto& result : this->results) {
+		const std::vector<double> creationTimes(result.creationTimes.begin() + 1, result.creationTimes.end());
+		const std::vector<double> destructionTimes(result.destructionTimes.begin() + 1, result.destructionTimes.end());
+
+		std::cout	<< std::setw(24) << std::left << result.name
+					<< std::setw(12) << std::right << result.creationTimes.front()
+					<< std::setw(14) << Helper::Statistics::percentile(creationTimes, 0.5)
+					<< std::setw(15) << Helper::Statistics::percentile(destructionTimes, 0.5)
+					<< '\n';
+	}
+
+	std::cout << std::flush;
+}
+
+// write the results as JSON (e.g. to be used as baseline for later runs)
+void WrapperBench::write(const VkPhysicalDeviceProperties& deviceProperties) const {
+	Helper::JsonWriter json;
+
+	json.beginObject();
+
+	json.add("repetitions", static_cast<unsigned long long>(this->repetitions));
+
+	json.beginObject("device");
+
+	json.add("name", deviceProperties.deviceName);
+	json.add("vendor_id", static_cast<unsigned long long>(deviceProperties.vendorID));
+	json.add("device_id", static_cast<unsigned long long>(deviceProperties.deviceID));
+	json.add("driver_version", static_cast<unsigned long long>(deviceProperties.driverVersion));
+
+	json.endObject();
+
+	json.beginObject("results");
+
+	for(const auto& result : this->results) {
+		json.beginObject(result.name);
+
+		for(const bool isCreation : { true, false }) {
+			const std::vector<double>& times = isCreation ? result.creationTimes : result.destructionTimes;
+			const std::vector<double> measured(times.begin() + 1, times.end());
+
+			json.beginObject(isCreation ? "create" : "destroy");
+
+			json.add("first_ms", times.front());
+			json.add("min_ms", Helper::Statistics::percentile(measured, 0.));
+			json.add("p50_ms", Helper::Statistics::percentile(measured, 0.5));
+			json.add("mean_ms", Helper::Statistics::mean(measured));
+			json.add("p90_ms", Helper::Statistics::percentile(measured, 0.9));
+			json.add("max_ms", Helper::Statistics::percentile(measured, 1.));
+			json.add("stddev_ms", Helper::Statistics::standardDeviation(measured));
+
+			json.endObject();
+		}
+
+		json.endObject();
+	}
+
+	json.endObject();
+
+	json.endObject();
+
+	Helper::File::writeText(this->outputFile, json.str());
+
+	Helper::Log::info() << "(results written to " << this->outputFile << ")";
+}
+
+// create an instance of the Vulkan API (with validation layers if debugging)
+std::unique_ptr<Wrapper::VulkanInstance> WrapperBench::createInstance() {
+	return std::make_unique<Wrapper::VulkanInstance>(
+			WrapperBench::appInfo,
+			WrapperBench::engineInfo
+#ifndef NDEBUG
+			,
+			WrapperBench::vulkanRequirements,
+			this->vulkanDebugInfo
+#endif
+	);
+}
+
+} /* spacelite::Bench */
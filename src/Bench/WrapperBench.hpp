@@ -0,0 +1,143 @@
+/*
+ * WrapperBench.hpp
+ *
+ * Microbenchmark measuring the creation and destruction of the wrappers for the Vulkan API.
+ *
+ * Each wrapper is created and destroyed repeatedly while the wrappers it depends on are kept alive.
+ *  The first repetition is reported separately, because it usually includes one-time costs of the driver.
+ *
+ * Usage:	--repetitions=<n>	number of repetitions per wrapper (default: 20)
+ * 			--output=<file>		file to write the JSON results to (default: bench.json)
+ *
+ * The swap chain is created for a hidden window (i.e. it still needs a display server, e.g. Xvfb).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_BENCH_WRAPPERBENCH_HPP_
+#define SRC_BENCH_WRAPPERBENCH_HPP_
+
+#include "../Engine/Version.hpp"
+#include "../Helper/File.hpp"
+#include "../Helper/JsonWriter.hpp"
+#include "../Helper/Log.hpp"
+#include "../Helper/Statistics.hpp"
+#include "../Helper/TimerHighRes.hpp"
+#include "../Main/Exception.hpp"
+#include "../Main/Window.hpp"
+#include "../Struct/AppInfo.hpp"
+#include "../Struct/EngineInfo.hpp"
+#include "../Struct/ShaderFiles.hpp"
+#include "../Struct/VulkanRequirements.hpp"
+#include "../Struct/WinProp.hpp"
+#include "../Wrapper/VulkanBuffer.hpp"
+#include "../Wrapper/VulkanCommandBuffers.hpp"
+#include "../Wrapper/VulkanCommandPool.hpp"
+#include "../Wrapper/VulkanDevice.hpp"
+#include "../Wrapper/VulkanInstance.hpp"
+#include "../Wrapper/VulkanPhysicalDevice.hpp"
+#include "../Wrapper/VulkanPipeline.hpp"
+#include "../Wrapper/VulkanRenderPass.hpp"
+#include "../Wrapper/VulkanSurface.hpp"
+#include "../Wrapper/VulkanSwapChain.hpp"
+
+#ifndef NDEBUG
+	#include "../Wrapper/VulkanDebugInfo.hpp"
+#endif
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdlib>		// EXIT_FAILURE, EXIT_SUCCESS
+#include <exception>	// std::exception
+#include <iomanip>		// std::setw
+#include <iostream>		// std::cout, std::flush
+#include <memory>		// std::make_unique, std::unique_ptr
+#include <string>		// std::stoul, std::string
+#include <vector>		// std::vector
+
+namespace spacelite::Bench {
+
+	class WrapperBench {
+		/* STATIC CONSTANTS */
+		static const Struct::AppInfo appInfo;
+		static const Struct::EngineInfo engineInfo;
+		static const Struct::VulkanRequirements vulkanRequirements;
+		static const Struct::ShaderFiles shaderFiles;
+		static const unsigned long bufferSize;
+		static const unsigned int numberOfCommandBuffers;
+		/* END STATIC CONSTANTS */
+
+	public:
+		WrapperBench(int argc, char * argv[]);
+
+		// run the benchmark
+		int run();
+
+		// not copyable, not moveable
+		WrapperBench(const WrapperBench&) = delete;
+		WrapperBench(WrapperBench&&) = delete;
+		WrapperBench& operator=(const WrapperBench&) = delete;
+		WrapperBench& operator=(WrapperBench&&) = delete;
+
+	private:
+		// measured creation and destruction times of a wrapper (in ms)
+		struct Result {
+			std::string name;
+			std::vector<double> creationTimes;
+			std::vector<double> destructionTimes;
+		};
+
+		unsigned int repetitions;
+		std::string outputFile;
+		std::vector<Result> results;
+
+#ifndef NDEBUG
+		Wrapper::VulkanDebugInfo vulkanDebugInfo;
+#endif
+
+		// measure the creation and destruction of a wrapper
+		template<typename F> void measure(const std::string& name, F&& create);
+
+		// output the results
+		void print() const;
+		void write(const VkPhysicalDeviceProperties& deviceProperties) const;
+
+		// create an instance of the Vulkan API
+		std::unique_ptr<Wrapper::VulkanInstance> createInstance();
+
+		// exception sub-class
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	// measure the creation and destruction of a wrapper (created by the given function as unique pointer)
+	template<typename F> void WrapperBench::measure(const std::string& name, F&& create) {
+		Result result;
+
+		result.name = name;
+
+		result.creationTimes.reserve(this->repetitions);
+		result.destructionTimes.reserve(this->repetitions);
+
+		Helper::TimerHighRes timer;
+
+		for(unsigned int n = 0; n < this->repetitions; ++n) {
+			timer.reset();
+
+			auto wrapper = create();
+
+			result.creationTimes.push_back(static_cast<double>(timer.since()) / 1000);
+
+			timer.reset();
+
+			wrapper.reset();
+
+			result.destructionTimes.push_back(static_cast<double>(timer.since()) / 1000);
+		}
+
+		this->results.emplace_back(result);
+	}
+
+} /* spacelite::Bench */
+
+#endif /* SRC_BENCH_WRAPPERBENCH_HPP_ */
@@ -0,0 +1,739 @@
+/*
+ * ComputePostProcessing.hpp
+ *
+ * Post-processing of the (HDR) scene by compute shaders on the compute queue: a blur pyramid for bloom,
+ *  tonemapping and FXAA, resulting in an LDR image to be composited (e.g. by the fullscreen passes).
+ *
+ * Each slot has its own images, descriptor sets and command buffer, so that the post-processing of a frame
+ *  can run on the compute queue while the graphics queue already renders the geometry of the next frame.
+ *  The scene and the output of each slot are shared by all queue families, so that their ownership
+ *  does not need to be transferred between the queues.
+ *
+ * If supported, timestamps are written at the beginning and the end of both the scene and the post-processing,
+ *  so that the overlap between the post-processing of a frame and the geometry of the next frame can be measured.
+ *  NOTE:	Comparing timestamps of different queues assumes that they use the same clock,
+ *			which is the case on common implementations, but not guaranteed by the Vulkan API.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_ENGINE_COMPUTEPOSTPROCESSING_HPP_
+#define SRC_ENGINE_COMPUTEPOSTPROCESSING_HPP_
+
+#include "../Helper/Trace.hpp"
+#include "../Main/Exception.hpp"
+#include "../Struct/VulkanDescriptorBinding.hpp"
+#include "../Struct/VulkanSpecialization.hpp"
+#include "../Wrapper/VulkanClockCalibration.hpp"
+#include "../Wrapper/VulkanCommandBuffer.hpp"
+#include "../Wrapper/VulkanCommandBuffers.hpp"
+#include "../Wrapper/VulkanCommandPool.hpp"
+#include "../Wrapper/VulkanComputePipeline.hpp"
+#include "../Wrapper/VulkanDescriptorAllocator.hpp"
+#include "../Wrapper/VulkanDescriptorPool.hpp"
+#include "../Wrapper/VulkanDevice.hpp"
+#include "../Wrapper/VulkanImage.hpp"
+#include "../Wrapper/VulkanPhysicalDevice.hpp"
+#include "../Wrapper/VulkanQueryPool.hpp"
+#include "../Wrapper/VulkanSampler.hpp"
+#include "../Wrapper/VulkanSwapChain.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <algorithm>	// std::max, std::min
+#include <cstdint>		// std::uint32_t
+#include <memory>		// std::make_unique, std::unique_ptr
+#include <string>		// std::string
+#include <vector>		// std::vector
+
+namespace spacelite::Engine {
+
+	/*
+	 * DECLARATION
+	 */
+	class ComputePostProcessing {
+	public:
+		static constexpr VkFormat sceneFormat = VK_FORMAT_R16G16B16A16_SFLOAT;
+		static constexpr VkFormat outputFormat = VK_FORMAT_R8G8B8A8_UNORM;
+
+		// compute shaders used (e.g. for preloading them)
+		static constexpr const char * downsampleShader = "shd/bin/bloom_down.comp.spv";
+		static constexpr const char * upsampleShader = "shd/bin/bloom_up.comp.spv";
+		static constexpr const char * tonemapShader = "shd/bin/tonemap.comp.spv";
+		static constexpr const char * fxaaShader = "shd/bin/fxaa.comp.spv";
+
+		static std::vector<std::string> getShaderFiles();
+
+		ComputePostProcessing(
+				Wrapper::VulkanDevice& device,
+				Wrapper::VulkanPhysicalDevice& physicalDevice,
+				Wrapper::VulkanSwapChain& swapChain,
+				Wrapper::VulkanDescriptorAllocator& descriptorAllocator,
+				Wrapper::VulkanSampler& sampler,
+				unsigned int numberOfSlots
+		);
+		virtual ~ComputePostProcessing();
+
+		// creation and destruction of the images and descriptor sets (depending on the extent of the swap chain)
+		void create();
+		void destroy();
+
+		// record the timestamps of the scene into a command buffer of the graphics queue
+		void beginScene(VkCommandBuffer commandBuffer, unsigned int slot);
+		void endScene(VkCommandBuffer commandBuffer, unsigned int slot);
+
+		// record the post-processing of a slot into its command buffer (returns the command buffer)
+		Wrapper::VulkanCommandBuffer& record(unsigned int slot);
+
+		// measure the overlap between the post-processing and the scene of the next frame (both need to be finished)
+		//  and add both to the trace (if enabled and the GPU timestamps can be converted)
+		void measure(
+				unsigned int slot,
+				unsigned int nextSlot,
+				const Wrapper::VulkanClockCalibration * calibration = nullptr
+		);
+
+		// getters
+		unsigned int getNumberOfSlots() const;
+		const Wrapper::VulkanImage& getSceneImage(unsigned int slot) const;
+		const Wrapper::VulkanImage& getOutputImage(unsigned int slot) const;
+		unsigned long getNumberOfMeasurements() const;
+		double getAverageTime() const;
+		double getAverageOverlap() const;
+
+		// not copyable, not moveable
+		ComputePostProcessing(const ComputePostProcessing&) = delete;
+		ComputePostProcessing(ComputePostProcessing&&) = delete;
+		ComputePostProcessing& operator=(const ComputePostProcessing&) = delete;
+		ComputePostProcessing& operator=(ComputePostProcessing&&) = delete;
+
+	private:
+		static constexpr unsigned int bloomLevels = 5;
+		static constexpr std::uint32_t groupSize = 8; // needs to match the local size of the compute shaders
+		static constexpr float bloomThreshold = 1.0f;
+		static constexpr float bloomStrength = 0.05f;
+		static constexpr float exposure = 1.0f;
+
+		// images and descriptor sets of a slot
+		struct Slot {
+			std::unique_ptr<Wrapper::VulkanImage> scene;
+			std::vector<std::unique_ptr<Wrapper::VulkanImage>> bloom;
+			std::unique_ptr<Wrapper::VulkanImage> tonemapped;
+			std::unique_ptr<Wrapper::VulkanImage> output;
+			std::vector<VkDescriptorSet> downsampleSets;
+			std::vector<VkDescriptorSet> upsampleSets;
+			VkDescriptorSet tonemapSet = VK_NULL_HANDLE;
+			VkDescriptorSet fxaaSet = VK_NULL_HANDLE;
+			std::unique_ptr<Wrapper::VulkanQueryPool> queries; // scene (#0, #1) and post-processing (#2, #3)
+		};
+
+		Wrapper::VulkanDevice& parent;
+		Wrapper::VulkanPhysicalDevice& physical;
+		Wrapper::VulkanSwapChain& chain;
+		Wrapper::VulkanDescriptorAllocator& allocator;
+		Wrapper::VulkanSampler& linearSampler;
+
+		Wrapper::VulkanCommandPool commandPool;
+		Wrapper::VulkanCommandBuffers commandBuffers;
+		Wrapper::VulkanComputePipeline thresholdPipeline;
+		Wrapper::VulkanComputePipeline downsamplePipeline;
+		Wrapper::VulkanComputePipeline upsamplePipeline;
+		Wrapper::VulkanComputePipeline tonemapPipeline;
+		Wrapper::VulkanComputePipeline fxaaPipeline;
+		std::unique_ptr<Wrapper::VulkanDescriptorPool> descriptorPool;
+		std::vector<Slot> slots;
+		bool timestamps;
+
+		// overlap statistics (in nanoseconds)
+		unsigned long measurements;
+		double totalTime;
+		double totalOverlap;
+
+		// record a dispatch covering an image
+		void dispatch(
+				VkCommandBuffer commandBuffer,
+				const Wrapper::VulkanComputePipeline& pipeline,
+				VkDescriptorSet set,
+				const VkExtent2D& extent
+		);
+
+		// record a barrier between two dispatches
+		static void barrier(VkCommandBuffer commandBuffer);
+
+		// record layout transitions of images
+		static void transition(
+				VkCommandBuffer commandBuffer,
+				const std::vector<VkImage>& images,
+				VkImageLayout oldLayout,
+				VkImageLayout newLayout,
+				VkPipelineStageFlags srcStages,
+				VkAccessFlags srcAccess,
+				VkPipelineStageFlags dstStages,
+				VkAccessFlags dstAccess
+		);
+
+		// get a descriptor binding for an image
+		Struct::VulkanDescriptorBinding getBinding(
+				std::uint32_t binding,
+				VkDescriptorType type,
+				const Wrapper::VulkanImage& image,
+				VkImageLayout layout
+		) const;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the command buffers and the pipelines, the rest is outsourced to create()
+	inline ComputePostProcessing::ComputePostProcessing(
+			Wrapper::VulkanDevice& device,
+			Wrapper::VulkanPhysicalDevice& physicalDevice,
+			Wrapper::VulkanSwapChain& swapChain,
+			Wrapper::VulkanDescriptorAllocator& descriptorAllocator,
+			Wrapper::VulkanSampler& sampler,
+			unsigned int numberOfSlots
+	) :		parent(device),
+			physical(physicalDevice),
+			chain(swapChain),
+			allocator(descriptorAllocator),
+			linearSampler(sampler),
+			commandPool(
+					device,
+					device.getComputeQueue(),
+					VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT // command buffers are re-recorded for each frame
+			),
+			commandBuffers(device, commandPool, numberOfSlots),
+			thresholdPipeline(
+					device,
+					ComputePostProcessing::downsampleShader,
+					Struct::VulkanSpecialization().set(0, ComputePostProcessing::bloomThreshold)
+			),
+			downsamplePipeline(device, ComputePostProcessing::downsampleShader),
+			upsamplePipeline(device, ComputePostProcessing::upsampleShader),
+			tonemapPipeline(
+					device,
+					ComputePostProcessing::tonemapShader,
+					Struct::VulkanSpecialization()
+							.set(0, ComputePostProcessing::exposure)
+							.set(1, ComputePostProcessing::bloomStrength)
+			),
+			fxaaPipeline(device, ComputePostProcessing::fxaaShader),
+			slots(numberOfSlots),
+			timestamps(physicalDevice.getProperties().limits.timestampComputeAndGraphics == VK_TRUE),
+			measurements(0),
+			totalTime(0.),
+			totalOverlap(0.) {
+		this->create();
+	}
+
+	// destructor: outsourced to destroy()
+	inline ComputePostProcessing::~ComputePostProcessing() {
+		this->destroy();
+	}
+
+	// create the images (the bloom pyramid halving the extent of the swap chain with each level)
+	//  and the descriptor sets of all slots
+	inline void ComputePostProcessing::create() {
+		const VkExtent2D& vulkanExtent = this->chain.getExtent();
+		const unsigned int numberOfSlots = static_cast<unsigned int>(this->slots.size());
+
+		// descriptor pool for the sets of all slots
+		const unsigned int setsPerSlot = 2 * ComputePostProcessing::bloomLevels + 1;
+
+		this->descriptorPool = std::make_unique<Wrapper::VulkanDescriptorPool>(
+				this->parent,
+				numberOfSlots * setsPerSlot,
+				std::vector<VkDescriptorPoolSize>{
+					{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, numberOfSlots * (setsPerSlot + 1) },
+					{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, numberOfSlots * setsPerSlot }
+				}
+		);
+
+		for(auto& slot : this->slots) {
+			// images
+			slot.scene = std::make_unique<Wrapper::VulkanImage>(
+					this->parent,
+					this->physical,
+					vulkanExtent,
+					ComputePostProcessing::sceneFormat,
+					VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+					VK_IMAGE_ASPECT_COLOR_BIT,
+					VK_SAMPLE_COUNT_1_BIT,
+					false,
+					true /* shared (rendered on the graphics queue) */
+			);
+
+			for(unsigned int level = 0; level < ComputePostProcessing::bloomLevels; ++level)
+				slot.bloom.emplace_back(
+						std::make_unique<Wrapper::VulkanImage>(
+								this->parent,
+								this->physical,
+								VkExtent2D{
+									std::max(vulkanExtent.width >> (level + 1), 1U),
+									std::max(vulkanExtent.height >> (level + 1), 1U)
+								},
+								ComputePostProcessing::sceneFormat,
+								VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+								VK_IMAGE_ASPECT_COLOR_BIT
+						)
+				);
+
+			slot.tonemapped = std::make_unique<Wrapper::VulkanImage>(
+					this->parent,
+					this->physical,
+					vulkanExtent,
+					ComputePostProcessing::outputFormat,
+					VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+					VK_IMAGE_ASPECT_COLOR_BIT
+			);
+
+			slot.output = std::make_unique<Wrapper::VulkanImage>(
+					this->parent,
+					this->physical,
+					vulkanExtent,
+					ComputePostProcessing::outputFormat,
+					VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+					VK_IMAGE_ASPECT_COLOR_BIT,
+					VK_SAMPLE_COUNT_1_BIT,
+					false,
+					true /* shared (composited on the graphics queue) */
+			);
+
+			// descriptor sets (the scene is sampled in the layout it has been left in by the graphics queue)
+			for(unsigned int level = 0; level < ComputePostProcessing::bloomLevels; ++level) {
+				const Wrapper::VulkanComputePipeline& pipeline =
+						level ? this->downsamplePipeline : this->thresholdPipeline;
+
+				VkDescriptorSet vulkanSet = VK_NULL_HANDLE;
+
+				if(!(this->descriptorPool->allocate(pipeline.getSetLayout(0), vulkanSet)))
+					throw Exception("Could not allocate descriptor set for downsampling");
+
+				this->allocator.write(
+						vulkanSet,
+						{
+							level ?
+									this->getBinding(
+											0,
+											VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+											*(slot.bloom[level - 1]),
+											VK_IMAGE_LAYOUT_GENERAL
+									)
+									: this->getBinding(
+											0,
+											VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+											*(slot.scene),
+											VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+									),
+							this->getBinding(
+									1,
+									VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+									*(slot.bloom[level]),
+									VK_IMAGE_LAYOUT_GENERAL
+							)
+						}
+				);
+
+				slot.downsampleSets.push_back(vulkanSet);
+			}
+
+			for(unsigned int level = 0; level + 1 < ComputePostProcessing::bloomLevels; ++level) {
+				VkDescriptorSet vulkanSet = VK_NULL_HANDLE;
+
+				if(!(this->descriptorPool->allocate(this->upsamplePipeline.getSetLayout(0), vulkanSet)))
+					throw Exception("Could not allocate descriptor set for upsampling");
+
+				this->allocator.write(
+						vulkanSet,
+						{
+							this->getBinding(
+									0,
+									VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+									*(slot.bloom[level + 1]),
+									VK_IMAGE_LAYOUT_GENERAL
+							),
+							this->getBinding(
+									1,
+									VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+									*(slot.bloom[level]),
+									VK_IMAGE_LAYOUT_GENERAL
+							)
+						}
+				);
+
+				slot.upsampleSets.push_back(vulkanSet);
+			}
+
+			if(!(this->descriptorPool->allocate(this->tonemapPipeline.getSetLayout(0), slot.tonemapSet)))
+				throw Exception("Could not allocate descriptor set for tonemapping");
+
+			this->allocator.write(
+					slot.tonemapSet,
+					{
+						this->getBinding(
+								0,
+								VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+								*(slot.scene),
+								VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+						),
+						this->getBinding(
+								1,
+								VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+								*(slot.bloom.front()),
+								VK_IMAGE_LAYOUT_GENERAL
+						),
+						this->getBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, *(slot.tonemapped), VK_IMAGE_LAYOUT_GENERAL)
+					}
+			);
+
+			if(!(this->descriptorPool->allocate(this->fxaaPipeline.getSetLayout(0), slot.fxaaSet)))
+				throw Exception("Could not allocate descriptor set for FXAA");
+
+			this->allocator.write(
+					slot.fxaaSet,
+					{
+						this->getBinding(
+								0,
+								VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+								*(slot.tonemapped),
+								VK_IMAGE_LAYOUT_GENERAL
+						),
+						this->getBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, *(slot.output), VK_IMAGE_LAYOUT_GENERAL)
+					}
+			);
+
+			// timestamp queries
+			if(this->timestamps)
+				slot.queries = std::make_unique<Wrapper::VulkanQueryPool>(this->parent, this->physical, 4);
+		}
+	}
+
+	// destroy the images and descriptor sets of all slots (keeps the overlap statistics)
+	inline void ComputePostProcessing::destroy() {
+		for(auto& slot : this->slots)
+			slot = Slot();
+
+		this->descriptorPool.reset();
+	}
+
+	// record the reset of the timestamps of a slot and the timestamp at the beginning of its scene
+	inline void ComputePostProcessing::beginScene(VkCommandBuffer commandBuffer, unsigned int slot) {
+		Slot& current = this->slots.at(slot);
+
+		if(!(current.queries))
+			return;
+
+		current.queries->reset(commandBuffer);
+		current.queries->write(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0);
+	}
+
+	// record the timestamp at the end of the scene of a slot
+	inline void ComputePostProcessing::endScene(VkCommandBuffer commandBuffer, unsigned int slot) {
+		Slot& current = this->slots.at(slot);
+
+		if(current.queries)
+			current.queries->write(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 1);
+	}
+
+	// record the post-processing of a slot into its command buffer (returns the command buffer)
+	//  NOTE:	The scene needs to be in the layout VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+	//			the output will be left in the same layout.
+	inline Wrapper::VulkanCommandBuffer& ComputePostProcessing::record(unsigned int slot) {
+		Slot& current = this->slots.at(slot);
+		Wrapper::VulkanCommandBuffer& commandBuffer = this->commandBuffers.get(slot);
+		VkCommandBuffer vulkanCommandBuffer = commandBuffer.get();
+
+		commandBuffer.begin();
+
+		if(current.queries)
+			current.queries->write(vulkanCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 2);
+
+		// the contents of the previous frame are not needed anymore
+		std::vector<VkImage> vulkanImages;
+
+		for(const auto& level : current.bloom)
+			vulkanImages.push_back(level->get());
+
+		vulkanImages.push_back(current.tonemapped->get());
+		vulkanImages.push_back(current.output->get());
+
+		ComputePostProcessing::transition(
+				vulkanCommandBuffer,
+				vulkanImages,
+				VK_IMAGE_LAYOUT_UNDEFINED,
+				VK_IMAGE_LAYOUT_GENERAL,
+				VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+				0,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT
+		);
+
+		// bloom: downsample the bright parts of the scene into the pyramid, then add up the levels from the smallest
+		for(unsigned int level = 0; level < ComputePostProcessing::bloomLevels; ++level) {
+			this->dispatch(
+					vulkanCommandBuffer,
+					level ? this->downsamplePipeline : this->thresholdPipeline,
+					current.downsampleSets[level],
+					current.bloom[level]->getExtent()
+			);
+
+			ComputePostProcessing::barrier(vulkanCommandBuffer);
+		}
+
+		for(unsigned int level = ComputePostProcessing::bloomLevels - 1; level > 0; --level) {
+			this->dispatch(
+					vulkanCommandBuffer,
+					this->upsamplePipeline,
+					current.upsampleSets[level - 1],
+					current.bloom[level - 1]->getExtent()
+			);
+
+			ComputePostProcessing::barrier(vulkanCommandBuffer);
+		}
+
+		// tonemapping (including the bloom) and anti-aliasing
+		this->dispatch(vulkanCommandBuffer, this->tonemapPipeline, current.tonemapSet, current.tonemapped->getExtent());
+
+		ComputePostProcessing::barrier(vulkanCommandBuffer);
+
+		this->dispatch(vulkanCommandBuffer, this->fxaaPipeline, current.fxaaSet, current.output->getExtent());
+
+		// the output will be sampled on the graphics queue (the semaphore takes care of the rest)
+		ComputePostProcessing::transition(
+				vulkanCommandBuffer,
+				{ current.output->get() },
+				VK_IMAGE_LAYOUT_GENERAL,
+				VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				VK_ACCESS_SHADER_WRITE_BIT,
+				VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+				0
+		);
+
+		if(current.queries)
+			current.queries->write(vulkanCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 3);
+
+		commandBuffer.end();
+
+		return commandBuffer;
+	}
+
+	// measure the overlap between the post-processing of a slot and the scene of the next frame
+	//  (ignored if timestamps are not supported or not available)
+	inline void ComputePostProcessing::measure(
+			unsigned int slot,
+			unsigned int nextSlot,
+			const Wrapper::VulkanClockCalibration * calibration
+	) {
+		const Slot& current = this->slots.at(slot);
+		const Slot& next = this->slots.at(nextSlot);
+
+		if(!(current.queries) || !(next.queries))
+			return;
+
+		// the post-processing of the next frame might still be running
+		std::vector<double> currentTimestamps;
+		std::vector<double> nextTimestamps;
+
+		if(!(current.queries->getResults(2, 2, currentTimestamps)) || !(next.queries->getResults(0, 2, nextTimestamps)))
+			return;
+
+		const double postProcessingStart = currentTimestamps[0];
+		const double postProcessingEnd = currentTimestamps[1];
+		const double nextSceneStart = nextTimestamps[0];
+		const double nextSceneEnd = nextTimestamps[1];
+
+		if(postProcessingEnd < postProcessingStart)
+			return;
+
+		if(calibration && calibration->isAvailable() && Helper::Trace::isEnabled()) {
+			static const std::uint32_t computeTrack = Helper::Trace::getTrack("GPU (compute queue)");
+			static const std::uint32_t graphicsTrack = Helper::Trace::getTrack("GPU (graphics queue)");
+
+			Helper::Trace::add(
+					"post-processing",
+					calibration->toTraceTime(postProcessingStart),
+					calibration->toTraceTime(postProcessingEnd),
+					computeTrack
+			);
+			Helper::Trace::add(
+					"scene",
+					calibration->toTraceTime(nextSceneStart),
+					calibration->toTraceTime(nextSceneEnd),
+					graphicsTrack
+			);
+		}
+
+		this->totalTime += postProcessingEnd - postProcessingStart;
+		this->totalOverlap += std::max(
+				std::min(postProcessingEnd, nextSceneEnd) - std::max(postProcessingStart, nextSceneStart),
+				0.
+		);
+
+		++(this->measurements);
+	}
+
+	// get the files of the compute shaders used
+	inline std::vector<std::string> ComputePostProcessing::getShaderFiles() {
+		return {
+			ComputePostProcessing::downsampleShader,
+			ComputePostProcessing::upsampleShader,
+			ComputePostProcessing::tonemapShader,
+			ComputePostProcessing::fxaaShader
+		};
+	}
+
+	// get the number of slots
+	inline unsigned int ComputePostProcessing::getNumberOfSlots() const {
+		return static_cast<unsigned int>(this->slots.size());
+	}
+
+	// get const reference to the scene image of a slot
+	inline const Wrapper::VulkanImage& ComputePostProcessing::getSceneImage(unsigned int slot) const {
+		return *(this->slots.at(slot).scene);
+	}
+
+	// get const reference to the output image of a slot
+	inline const Wrapper::VulkanImage& ComputePostProcessing::getOutputImage(unsigned int slot) const {
+		return *(this->slots.at(slot).output);
+	}
+
+	// get the number of frames whose overlap has been measured
+	inline unsigned long ComputePostProcessing::getNumberOfMeasurements() const {
+		return this->measurements;
+	}
+
+	// get the average time of the post-processing in milliseconds
+	inline double ComputePostProcessing::getAverageTime() const {
+		return this->measurements ? this->totalTime / this->measurements / 1000000. : 0.;
+	}
+
+	// get the average share of the post-processing that overlapped with the scene of the next frame (0 to 1)
+	inline double ComputePostProcessing::getAverageOverlap() const {
+		return this->totalTime > 0. ? this->totalOverlap / this->totalTime : 0.;
+	}
+
+	// record a dispatch covering an image (one invocation per pixel)
+	inline void ComputePostProcessing::dispatch(
+			VkCommandBuffer commandBuffer,
+			const Wrapper::VulkanComputePipeline& pipeline,
+			VkDescriptorSet set,
+			const VkExtent2D& extent
+	) {
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline.get());
+		vkCmdBindDescriptorSets(
+				commandBuffer,
+				VK_PIPELINE_BIND_POINT_COMPUTE,
+				pipeline.getLayout(),
+				0,
+				1,
+				&set,
+				0,
+				nullptr
+		);
+		vkCmdDispatch(
+				commandBuffer,
+				(extent.width + ComputePostProcessing::groupSize - 1) / ComputePostProcessing::groupSize,
+				(extent.height + ComputePostProcessing::groupSize - 1) / ComputePostProcessing::groupSize,
+				1
+		);
+	}
+
+	// record a barrier between two dispatches (the results of the first one are read by the second one)
+	inline void ComputePostProcessing::barrier(VkCommandBuffer commandBuffer) {
+		VkMemoryBarrier vulkanBarrier = {};
+
+		vulkanBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		vulkanBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		vulkanBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+		vkCmdPipelineBarrier(
+				commandBuffer,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				0,
+				1,
+				&vulkanBarrier,
+				0,
+				nullptr,
+				0,
+				nullptr
+		);
+	}
+
+	// record layout transitions of images
+	inline void ComputePostProcessing::transition(
+			VkCommandBuffer commandBuffer,
+			const std::vector<VkImage>& images,
+			VkImageLayout oldLayout,
+			VkImageLayout newLayout,
+			VkPipelineStageFlags srcStages,
+			VkAccessFlags srcAccess,
+			VkPipelineStageFlags dstStages,
+			VkAccessFlags dstAccess
+	) {
+		std::vector<VkImageMemoryBarrier> vulkanBarriers;
+
+		vulkanBarriers.reserve(images.size());
+
+		for(const auto vulkanImage : images) {
+			VkImageMemoryBarrier vulkanBarrier = {};
+
+			vulkanBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			vulkanBarrier.srcAccessMask = srcAccess;
+			vulkanBarrier.dstAccessMask = dstAccess;
+			vulkanBarrier.oldLayout = oldLayout;
+			vulkanBarrier.newLayout = newLayout;
+			vulkanBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			vulkanBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			vulkanBarrier.image = vulkanImage;
+			vulkanBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			vulkanBarrier.subresourceRange.baseMipLevel = 0;
+			vulkanBarrier.subresourceRange.levelCount = 1;
+			vulkanBarrier.subresourceRange.baseArrayLayer = 0;
+			vulkanBarrier.subresourceRange.layerCount = 1;
+
+			vulkanBarriers.push_back(vulkanBarrier);
+		}
+
+		vkCmdPipelineBarrier(
+				commandBuffer,
+				srcStages,
+				dstStages,
+				0,
+				0,
+				nullptr,
+				0,
+				nullptr,
+				static_cast<std::uint32_t>(vulkanBarriers.size()),
+				vulkanBarriers.data()
+		);
+	}
+
+	// get a descriptor binding for an image (sampled images are combined with the linear sampler)
+	inline Struct::VulkanDescriptorBinding ComputePostProcessing::getBinding(
+			std::uint32_t binding,
+			VkDescriptorType type,
+			const Wrapper::VulkanImage& image,
+			VkImageLayout layout
+	) const {
+		Struct::VulkanDescriptorBinding result;
+
+		result.binding = binding;
+		result.type = type;
+		result.image.imageView = image.getView().get();
+		result.image.imageLayout = layout;
+
+		if(type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
+			result.image.sampler = this->linearSampler.get();
+
+		return result;
+	}
+
+} /* spacelite::Engine */
+
+#endif /* SRC_ENGINE_COMPUTEPOSTPROCESSING_HPP_ */
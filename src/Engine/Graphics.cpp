@@ -21,7 +21,27 @@ const Struct::EngineInfo Graphics::engineInfo(
 );
 const Struct::VulkanRequirements Graphics::vulkanRequirements(
 		{ "VK_LAYER_KHRONOS_validation" },
-		{ VK_KHR_SWAPCHAIN_EXTENSION_NAME }
+		{ VK_KHR_SWAPCHAIN_EXTENSION_NAME },
+		{ // optional extensions (only enabled if supported by the device)
+#ifdef VK_KHR_timeline_semaphore
+				VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
+#endif
+#ifdef VK_KHR_synchronization2
+				VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME,
+#endif
+#ifdef VK_KHR_dynamic_rendering
+				VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME, // only with Vulkan 1.2 or newer (see VulkanDevice::negotiate)
+#endif
+#ifdef VK_KHR_buffer_device_address
+				VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME,
+#endif
+#ifdef VK_EXT_memory_budget
+				VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+#endif
+#ifdef VK_EXT_calibrated_timestamps
+				VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME,
+#endif
+		}
 );
 const unsigned int Graphics::maxFramesInFlight = 2;
 const std::vector<Struct::Vertex> Graphics::vertices = { // temporary (for testing)
@@ -33,77 +53,324 @@ const Struct::ShaderFiles Graphics::shaderFiles = {
 		"shd/bin/default.vert.spv",
 		"shd/bin/default.frag.spv"
 };
+const VkSampleCountFlagBits Graphics::msaaSamples = VK_SAMPLE_COUNT_4_BIT; // clamped to what the device supports
+const bool Graphics::depthPrepass = false; // only worth it for heavy fragment shaders
+const std::vector<Struct::VulkanPipelineRequest> Graphics::pipelineRequests = [] {
+	// default pipeline (needs to be the first one)
+	Struct::VulkanPipelineRequest defaultRequest;
+
+	defaultRequest.shaderFiles = Graphics::shaderFiles;
+
+	defaultRequest.constants.fragmentShader.set(0, false); // grayscale
+
+	// variants of the default pipeline
+	Struct::VulkanPipelineRequest grayscaleRequest(defaultRequest);
+
+	grayscaleRequest.constants.fragmentShader.set(0, true);
+
+	Struct::VulkanPipelineRequest blendingRequest(defaultRequest);
+
+	blendingRequest.state.alphaBlending = true;
+
+	Struct::VulkanPipelineRequest doubleSidedRequest(defaultRequest);
+
+	doubleSidedRequest.state.cullMode = VK_CULL_MODE_NONE;
+
+	std::vector<Struct::VulkanPipelineRequest> result{
+		defaultRequest,
+		grayscaleRequest,
+		blendingRequest,
+		doubleSidedRequest
+	};
+
+	// with a depth prepass, opaque fragments are only shaded if they are visible (i.e. exactly at the prepass depth)
+	if(Graphics::depthPrepass)
+		for(auto& request : result)
+			if(!request.state.alphaBlending) {
+				request.state.depthWrite = false;
+				request.state.depthCompareOp = VK_COMPARE_OP_EQUAL;
+			}
+
+	return result;
+}();
+const std::vector<Struct::VulkanPipelineRequest> Graphics::postProcessingRequests = [] {
+	// fullscreen triangle reading the image written by the previous pass
+	Struct::VulkanPipelineRequest vignetteRequest;
+
+	vignetteRequest.shaderFiles = { "shd/bin/fullscreen.vert.spv", "shd/bin/post.frag.spv" };
+
+	vignetteRequest.state.vertexInput = false;
+	vignetteRequest.state.cullMode = VK_CULL_MODE_NONE;
+	vignetteRequest.state.depthTest = false;
+	vignetteRequest.state.depthWrite = false;
+
+	vignetteRequest.constants.fragmentShader.set(0, 0.5f); // vignette
+
+	return std::vector<Struct::VulkanPipelineRequest>{ vignetteRequest };
+}();
+const Struct::ShaderFiles Graphics::fusedPostProcessingShaderFiles = { // reading the scene as input attachment
+		"shd/bin/fullscreen.vert.spv",
+		"shd/bin/post_fused.frag.spv"
+};
+const bool Graphics::fusePostProcessing = true; // keeps scene and first post-processing step on-chip on tile-based GPUs
+const bool Graphics::asyncPostProcessing = true; // overlaps post-processing with the next frame (replaces fusing)
+const bool Graphics::animated = false; // the scene does not change by itself, i.e. needs frames only on demand
+const std::string Graphics::pipelineCacheFile = "pipeline_cache.bin"; // loaded on startup, saved on shutdown
+const std::string Graphics::backgroundStage = "background tasks";
 /* END STATIC CONSTANTS */
 
 
 // constructor: create objects and show header with application and engine
-Graphics::Graphics(const Struct::AppInfo& appInfo, Main::Window& window)
+Graphics::Graphics(const Struct::AppInfo& appInfo, Main::Window& window, const std::string& scene)
 		:	counter(0),
 			speed(0.),
-			targetWindow(window),
-			vulkanInstance(
-					appInfo,
-					Graphics::engineInfo
+			framesNeeded(0),
+			startupTime(0.),
+			targetWindow(startupStages.next("thread pool", window)),
+			startupTasks(threadPool),
+			vulkanInstance(this->startup(appInfo)), // opens the window, too
 #ifndef NDEBUG
-					,
-					Graphics::vulkanRequirements,
-					vulkanDebugInfo
+			vulkanDebug(startupStages.next("debug messenger", vulkanInstance), vulkanDebugInfo),
 #endif
+			vulkanSurface(startupStages.next("surface", vulkanInstance), targetWindow),
+			vulkanPhysicalDevice(
+					startupStages.next("physical device", vulkanInstance),
+					vulkanSurface,
+					Graphics::vulkanRequirements.deviceExtensions,
+					&threadPool // rates the devices in parallel
 			),
-#ifndef NDEBUG
-			vulkanDebug(vulkanInstance, vulkanDebugInfo),
-#endif
-			vulkanSurface(vulkanInstance, targetWindow),
-			vulkanPhysicalDevice(vulkanInstance, vulkanSurface, Graphics::vulkanRequirements.deviceExtensions),
-			vulkanDevice(vulkanPhysicalDevice, Graphics::vulkanRequirements),
-			vulkanSwapChain(vulkanDevice, targetWindow, vulkanSurface, vulkanPhysicalDevice, Graphics::maxFramesInFlight),
-			vulkanRenderPass(vulkanDevice, vulkanSwapChain.getImageFormat()),
-			vulkanPipeline(vulkanDevice, vulkanRenderPass, vulkanSwapChain.getExtent(), Graphics::shaderFiles),
-			vulkanFrameBuffers(vulkanDevice, vulkanSwapChain, vulkanRenderPass),
-			vulkanCommandPool(vulkanDevice, vulkanPhysicalDevice.findQueueFamilies()),
-			vulkanVertexBuffer(
+			vulkanDevice(startupStages.next("device", vulkanPhysicalDevice), Graphics::vulkanRequirements),
+			vulkanClockCalibration(vulkanInstance, vulkanPhysicalDevice, vulkanDevice),
+			vulkanSwapChain(
+					startupStages.next("swap chain", vulkanDevice),
+					targetWindow,
+					vulkanSurface,
+					vulkanPhysicalDevice,
+					Graphics::maxFramesInFlight
+			),
+			vulkanAsyncPostProcessing(
+					Graphics::asyncPostProcessing
+					&& vulkanDevice.getCapabilities().timelineSemaphores
+					&& !(Graphics::postProcessingRequests.empty()) // needed to composite the post-processed image
+			),
+			vulkanSceneFormat(ComputePostProcessing::sceneFormat),
+			vulkanRenderPass(
+					startupStages.next("render passes", vulkanDevice),
+					vulkanAsyncPostProcessing ? vulkanSceneFormat : vulkanSwapChain.getImageFormat(),
+					vulkanPhysicalDevice.findDepthFormat(),
+					vulkanPhysicalDevice.findSampleCount(Graphics::msaaSamples),
+					true, // use dynamic rendering if supported (and not needed for post-processing)
+					Graphics::fusePostProcessing
+					&& !(Graphics::postProcessingRequests.empty())
+					&& !vulkanAsyncPostProcessing,
+					VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL // transitioned by the render graph
+			),
+			vulkanPostRenderPass(
 					vulkanDevice,
+					vulkanSwapChain.getImageFormat(),
+					VK_FORMAT_UNDEFINED,
+					VK_SAMPLE_COUNT_1_BIT,
+					true, // use dynamic rendering if supported
+					false,
+					VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL // transitioned by the render graph
+			),
+			vulkanPipelineCache(
+					startupTasks.waitForAll(startupStages.next("pipelines", vulkanDevice)), // needs all files loaded
+					vulkanRenderPass,
+					pipelineCacheData
+			),
+			vulkanPostPipelineCache(vulkanDevice, vulkanPostRenderPass),
+			vulkanPipelines(vulkanPipelineCache.addBatch(Graphics::pipelineRequests, threadPool)), // waits for all pipelines
+			vulkanDraws(Graphics::createScene(startupStages.next("scene", scene), vulkanPipelines.at(0))),
+			vulkanFrameBuffers(
+					startupStages.next("framebuffers", vulkanDevice),
 					vulkanPhysicalDevice,
-					vulkanCommandPool,
-					true,
+					vulkanSwapChain,
+					vulkanRenderPass
+			),
+			vulkanPostFrameBuffers(vulkanDevice, vulkanPhysicalDevice, vulkanSwapChain, vulkanPostRenderPass),
+			vulkanSampler(startupStages.next("sampler", vulkanDevice)),
+			vulkanCommandPool(
+					startupStages.next("command pools", vulkanDevice),
+					vulkanDevice.getGraphicsQueue(),
+					VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT // command buffers are re-recorded for each frame
+			),
+			vulkanTransferCommandPool(
+					vulkanDevice,
+					vulkanDevice.getTransferQueue(),
+					VK_COMMAND_POOL_CREATE_TRANSIENT_BIT // command buffers are only used for single uploads
+			),
+			vulkanVertexBuffer(
+					startupStages.next("vertex upload", vulkanDevice),
+					vulkanPhysicalDevice,
+					vulkanTransferCommandPool,
+					false, // uploaded on the transfer queue, used on the graphics queue
 					sizeof(Graphics::vertices[0]) * Graphics::vertices.size(),
 					Graphics::vertices.data()
 			),
+			vulkanUniformBuffer(
+					startupStages.next("uniform buffer", vulkanDevice),
+					vulkanPhysicalDevice,
+					vulkanCommandPool,
+					sizeof(Struct::FrameUniforms),
+					vulkanSwapChain.getInFlightMax()
+			),
+			vulkanDescriptorAllocator(
+					startupStages.next("descriptor allocator", vulkanDevice),
+					vulkanSwapChain.getInFlightMax(),
+					threadPool.getNumberOfThreads() + 1 // worker threads and main thread
+			),
+			vulkanFrameSet(VK_NULL_HANDLE),
 			vulkanCommandBuffers(
-					vulkanDevice,
+					startupStages.next("command buffers", vulkanDevice),
 					vulkanCommandPool,
-					vulkanRenderPass,
-					vulkanFrameBuffers,
-					vulkanSwapChain.getExtent(),
-					vulkanPipeline,
-					vulkanVertexBuffer,
-					Graphics::vertices.size()
+					vulkanSwapChain.getInFlightMax()
 			),
+			vulkanCompositeCommandBuffers(vulkanDevice, vulkanCommandPool, vulkanSwapChain.getInFlightMax()),
+			renderGraph(vulkanDevice, vulkanPhysicalDevice),
+			renderGraphSwapChainImage(RenderGraph::none),
+			sceneGraph(vulkanDevice, vulkanPhysicalDevice),
+			sceneGraphImage(RenderGraph::none),
 			vulkanDeviceWaitIdle(vulkanDevice),
-			vulkanCurrentFrame(0) {
-	// print application info to stdout
-	std::cout	<< appInfo.name
-				<< " v"
-				<< appInfo.verMajor
-				<< '.'
-				<< appInfo.verMinor
-				<< '.'
-				<< appInfo.verPatch
-				<< " on "
-				<< Graphics::engineInfo.name.c_str()
-				<< " v"
-				<< Graphics::engineInfo.verMajor
-				<< '.'
-				<< Graphics::engineInfo.verMinor
-				<< '.'
-				<< Graphics::engineInfo.verPatch
-				<< "\n using "
-				<< Main::Window::getInfo()
-				<< "\n using Vulkan API v"
-				<< VK_VERSION_MAJOR(Graphics::engineInfo.vulkanVersion)
-				<< "."
-				<< VK_VERSION_MINOR(Graphics::engineInfo.vulkanVersion)
-				<< "\n";
+			vulkanCurrentFrame(0),
+			vulkanImageIndex(0),
+			vulkanFrameOffset(0),
+			vulkanAsyncFrame(0) {
+	// log application info
+	Helper::Log::info()	<< appInfo.name
+						<< " v"
+						<< appInfo.verMajor
+						<< '.'
+						<< appInfo.verMinor
+						<< '.'
+						<< appInfo.verPatch
+						<< " on "
+						<< Graphics::engineInfo.name.c_str()
+						<< " v"
+						<< Graphics::engineInfo.verMajor
+						<< '.'
+						<< Graphics::engineInfo.verMinor
+						<< '.'
+						<< Graphics::engineInfo.verPatch
+						<< "\n using "
+						<< Main::Window::getInfo()
+						<< "\n using Vulkan API v"
+						<< VK_VERSION_MAJOR(Graphics::engineInfo.vulkanVersion)
+						<< "."
+						<< VK_VERSION_MINOR(Graphics::engineInfo.vulkanVersion)
+						<< "\n using device with "
+						<< this->vulkanDevice.getCapabilities().str();
+
+	// break down the creation of the pipelines into loading and compiling shaders (summed over all threads)
+	Struct::StartupStage * pipelinesStage = this->startupStages.find("pipelines");
+
+	if(pipelinesStage) {
+		pipelinesStage->children.push_back({ "shader I/O", Wrapper::VulkanPipeline::getLoadingTime() });
+		pipelinesStage->children.push_back({ "shader compilation", Wrapper::VulkanPipeline::getCompilationTime() });
+	}
+
+	// create the particle system (for particle scenes), drawing the particles directly from the buffer it writes
+	const unsigned int numberOfParticles = Graphics::getNumberOfParticles(scene);
+
+	if(numberOfParticles) {
+		this->startupStages.next("particles");
+
+		this->particleSystem = std::make_unique<ParticleSystem>(
+				this->vulkanDevice,
+				this->vulkanPhysicalDevice,
+				this->vulkanCommandPool,
+				this->vulkanDescriptorAllocator,
+				numberOfParticles,
+				this->vulkanSwapChain.getInFlightMax()
+		);
+
+		const auto particlePipelines = this->vulkanPipelineCache.addBatch(
+				{ ParticleSystem::getPipelineRequest() },
+				this->threadPool
+		);
+
+		this->vulkanDraws.emplace_back(this->particleSystem->getDraw(particlePipelines.at(0)));
+	}
+
+	// measure the remaining stages of the startup (the members having been initialized already)
+	this->startupStages.next("depth prepass and sorting");
+
+	// add the draws of the depth prepass (if enabled), using depth-only variants of the pipelines of all opaque draws
+	if(Graphics::depthPrepass) {
+		std::vector<Struct::VulkanPipelineRequest> prepassRequests;
+		std::vector<Struct::VulkanDraw> prepassDraws;
+
+		for(const auto& draw : this->vulkanDraws)
+			for(std::size_t n = 0; n < this->vulkanPipelines.size(); ++n)
+				if(this->vulkanPipelines[n] == draw.pipeline) {
+					if(Graphics::pipelineRequests[n].state.alphaBlending)
+						break;
+
+					Struct::VulkanPipelineRequest prepassRequest(Graphics::pipelineRequests[n]);
+
+					prepassRequest.state.depthOnly = true;
+					prepassRequest.state.depthWrite = true;
+					prepassRequest.state.depthCompareOp = VK_COMPARE_OP_LESS;
+
+					prepassRequests.emplace_back(prepassRequest);
+					prepassDraws.emplace_back(draw);
+
+					prepassDraws.back().pass = 0;
+
+					break;
+				}
+
+		const auto prepassPipelines = this->vulkanPipelineCache.addBatch(prepassRequests, this->threadPool);
+
+		for(std::size_t n = 0; n < prepassDraws.size(); ++n) {
+			prepassDraws[n].pipeline = prepassPipelines[n];
+
+			this->vulkanDraws.emplace_back(prepassDraws[n]);
+		}
+	}
+
+	// sort draws by pass and pipeline (keeping their order otherwise) to minimize the number of pipeline binds
+	std::stable_sort(this->vulkanDraws.begin(), this->vulkanDraws.end());
+
+	this->startupStages.next("post-processing pipelines");
+
+	// use the default pipeline while other pipelines are created in the background
+	this->vulkanPipelineCache.setFallback(this->vulkanPipelines.at(0));
+
+	// create the pipelines of the post-processing steps
+	//  (the first one is fused into the render pass as its post-processing subpass, if possible)
+	for(std::size_t n = 0; n < Graphics::postProcessingRequests.size(); ++n) {
+		const Struct::VulkanPipelineRequest& request = Graphics::postProcessingRequests[n];
+
+		if(n == 0 && this->vulkanRenderPass.hasPostProcessingSubpass()) {
+			Struct::VulkanPipelineState fusedState(request.state);
+
+			fusedState.subpass = 1;
+
+			this->vulkanPostPipelines.push_back(
+					this->vulkanPipelineCache.add(Graphics::fusedPostProcessingShaderFiles, fusedState, request.constants)
+			);
+		}
+		else
+			this->vulkanPostPipelines.push_back(
+					this->vulkanPostPipelineCache.add(request.shaderFiles, request.state, request.constants)
+			);
+	}
+
+	this->startupStages.next("frame resources");
+
+	// get the (long-lived) per-frame descriptor set
+	//  (one for all frames, because the uniform buffer is bound with dynamic offsets)
+	Struct::VulkanDescriptorBinding frameBinding;
+
+	frameBinding.binding = 0;
+	frameBinding.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+	frameBinding.buffer = this->vulkanUniformBuffer.getDescriptorInfo(sizeof(Struct::FrameUniforms));
+
+	this->vulkanFrameSet = this->vulkanDescriptorAllocator.get(
+			this->vulkanPipelineCache.getPipeline(this->vulkanPipelines.at(0)).getSetLayout(0),
+			{ frameBinding }
+	);
 
 	// create Vulkan API-specific synchronization objects (to be wrapped)
 	for(unsigned short n = 0; n < this->vulkanSwapChain.getInFlightMax(); ++n) {
@@ -112,27 +379,102 @@ Graphics::Graphics(const Struct::AppInfo& appInfo, Main::Window& window)
 		this->vulkanInFlightFences.emplace_back(this->vulkanDevice);
 	}
 
-	std::cout	<< "(started in " << (double) this->timer.since() / 1000 << "ms)"
-				<< std::endl;
+	// create the post-processing on the compute queue and the timeline semaphores synchronizing it (if supported)
+	if(this->vulkanAsyncPostProcessing) {
+		this->computePostProcessing = std::make_unique<ComputePostProcessing>(
+				this->vulkanDevice,
+				this->vulkanPhysicalDevice,
+				this->vulkanSwapChain,
+				this->vulkanDescriptorAllocator,
+				this->vulkanSampler,
+				this->vulkanSwapChain.getInFlightMax() + 1 // one more frame is in flight until it has been composited
+		);
+
+		this->vulkanGraphicsTimeline = std::make_unique<Wrapper::VulkanTimelineSemaphore>(this->vulkanDevice);
+		this->vulkanComputeTimeline = std::make_unique<Wrapper::VulkanTimelineSemaphore>(this->vulkanDevice);
+
+		this->vulkanGraphicsValues.resize(this->vulkanSwapChain.getInFlightMax(), 0);
+		this->vulkanComputeValues.resize(this->vulkanSwapChain.getInFlightMax(), 0);
+		this->vulkanPostProcessedValues.resize(this->computePostProcessing->getNumberOfSlots(), 0);
+	}
+
+	this->startupStages.next("render graph");
+
+	// build the render graph
+	this->vulkanBuildRenderGraph();
+
+	this->startupStages.end();
+
+	// add the tasks that have been run in the background (summed over all threads)
+	this->startupTasks.finish();
+
+	Struct::StartupStage backgroundStage{ Graphics::backgroundStage, 0. };
+
+	backgroundStage.children = this->startupTasks.getStages();
+	backgroundStage.time = Helper::StageTimer::sum(backgroundStage.children);
+
+	this->startupStages.add(backgroundStage);
+
+	// the preloaded files are not needed anymore
+	Helper::FileCache::clear();
+	this->pipelineCacheData.clear();
+
+	this->startupTime = (double) this->timer.since() / 1000;
+
+	Helper::Log::info()	<< "(started in "
+						<< this->startupTime
+						<< "ms, critical path: "
+						<< this->startupTasks.getCriticalPath()
+						<< "ms, sequentially: "
+						<< this->startupTasks.getSequentialTime()
+						<< "ms)";
 
 	this->timer.reset();
 }
 
-// destructor: show memory debugging stats (if necessary)
+// destructor: save the pipeline cache and show memory and validation debugging stats (if necessary)
 Graphics::~Graphics() {
-	std::cout	<< "(average speed was "
-				<< this->speed
-				<< "tps)"
-				<< std::endl;
+	try {
+		Helper::File::writeBinary(Graphics::pipelineCacheFile, this->vulkanPipelineCache.getData());
+	}
+	catch(const Main::Exception& exception) {
+		Helper::Log::warning() << "(WARNING: " << exception.what() << ")";
+	}
+
+	Helper::Log::info()	<< "(average speed was "
+						<< this->speed
+						<< "tps)";
 
 #ifndef NDEBUG
-	std::cout	<< "(allocated "
-				<< Helper::VulkanAllocator::getAllocated()
-				<< ", reallocated "
-				<< Helper::VulkanAllocator::getReAllocated()
-				<< " bytes)"
-				<< std::endl;
+	Helper::Log::info()	<< "(allocated "
+						<< Helper::VulkanAllocator::getAllocated()
+						<< ", reallocated "
+						<< Helper::VulkanAllocator::getReAllocated()
+						<< " bytes)";
+
+	const std::string debugSummary(Wrapper::VulkanDebugInfo::getSummary());
+
+	if(!debugSummary.empty())
+		Helper::Log::info()	<< "(validation messages by ID, "
+							<< Wrapper::VulkanDebugInfo::getNumberOfErrors()
+							<< " error(s) in total:\n"
+							<< debugSummary
+							<< ")";
 #endif
+
+	if(this->computePostProcessing && this->computePostProcessing->getNumberOfMeasurements())
+		Helper::Log::info()	<< "(post-processing took "
+							<< this->computePostProcessing->getAverageTime()
+							<< "ms on average, "
+							<< 100. * this->computePostProcessing->getAverageOverlap()
+							<< "% of it overlapping the geometry of the next frame)";
+
+	if(this->particleSystem && this->particleSystem->getNumberOfMeasurements())
+		Helper::Log::info()	<< "(simulating "
+							<< this->particleSystem->getNumberOfParticles()
+							<< " particles took "
+							<< this->particleSystem->getAverageTime()
+							<< "ms on average)";
 }
 
 // tick: draw a frame
@@ -145,34 +487,303 @@ void Graphics::tick() {
 
 	++(this->counter);
 
+	if(this->framesNeeded)
+		--(this->framesNeeded);
+
+	// measure the first frame as the last stage of the startup
+	if(this->counter == 1)
+		this->startupStages.begin("first frame");
+
+	Helper::Trace::Zone frameZone("frame");
+
 	this->vulkanDrawFrame();
+
+	frameZone.end();
+
+	if(this->startupStages.isRunning())
+		this->startupStages.end();
+}
+
+// mark the scene as changed, i.e. it needs to be drawn again
+//  (post-processing on the compute queue delays the presentation by one frame)
+void Graphics::invalidate() {
+	this->framesNeeded = this->computePostProcessing ? 2 : 1;
+}
+
+// get whether a frame needs to be drawn
+//  (because the scene has changed, is animated, consists of moving particles or has not been presented yet)
+bool Graphics::needsFrame() const {
+	return Graphics::animated || this->particleSystem || this->framesNeeded;
+}
+
+// get the time needed for the startup (in ms)
+double Graphics::getStartupTime() const {
+	return this->startupTime;
+}
+
+// get the time the startup would have needed with unlimited threads (in ms)
+double Graphics::getStartupCriticalPath() const {
+	return this->startupTasks.getCriticalPath();
+}
+
+// get the time the startup would have needed without any parallelism (in ms)
+double Graphics::getStartupSequentialTime() const {
+	return this->startupTasks.getSequentialTime();
+}
+
+// get the number of simulated particles (zero if the scene has none)
+unsigned int Graphics::getNumberOfParticles() const {
+	return this->particleSystem ? this->particleSystem->getNumberOfParticles() : 0;
+}
+
+// get the average GPU time of the particle simulation (in ms, zero if it has not been measured)
+double Graphics::getParticleSimulationTime() const {
+	return this->particleSystem ? this->particleSystem->getAverageTime() : 0.;
+}
+
+// get the stages of the startup and the time they needed
+const std::vector<Struct::StartupStage>& Graphics::getStartupStages() const {
+	return this->startupStages.get();
+}
+
+// get the render graph of a frame (e.g. for exporting it)
+const RenderGraph& Graphics::getRenderGraph() const {
+	return this->renderGraph;
+}
+
+// get the properties of the used device
+const VkPhysicalDeviceProperties& Graphics::getDeviceProperties() const {
+	return this->vulkanPhysicalDevice.getProperties();
+}
+
+// get the optional capabilities of the used device as string
+std::string Graphics::getDeviceCapabilities() const {
+	return this->vulkanDevice.getCapabilities().str();
+}
+
+// get the average speed (in ticks per second)
+double Graphics::getSpeed() const {
+	return this->speed;
+}
+
+// start the tasks of the startup and create the Vulkan API instance on a worker thread,
+//  while opening the window on the main thread (as needed by GLFW)
+Wrapper::VulkanInstance Graphics::startup(const Struct::AppInfo& appInfo) {
+	std::optional<Wrapper::VulkanInstance> instance;
+
+	const std::size_t instanceTask = this->startupTasks.add("instance", [this, &appInfo, &instance]() {
+		instance.emplace(
+				appInfo,
+				Graphics::engineInfo
+#ifndef NDEBUG
+				,
+				Graphics::vulkanRequirements,
+				this->vulkanDebugInfo
+#endif
+		);
+	});
+
+	// load the data of the pipeline cache and all shaders in the meantime (needed when creating the pipelines)
+	this->startupTasks.add("pipeline cache I/O", [this]() {
+		if(Helper::File::exists(Graphics::pipelineCacheFile))
+			this->pipelineCacheData = Helper::File::readBinary(Graphics::pipelineCacheFile);
+	});
+
+	for(const auto& fileName : Graphics::getShaderFiles())
+		this->startupTasks.add("shader I/O", [fileName]() { Helper::FileCache::preload(fileName); });
+
+	this->startupStages.next("window");
+
+	try {
+		this->targetWindow.open();
+	}
+	catch(...) {
+		// the instance is still needed by its task
+		try {
+			this->startupTasks.wait(instanceTask);
+		}
+		catch(...) {}
+
+		throw;
+	}
+
+	this->startupStages.next("instance");
+
+	this->startupTasks.wait(instanceTask);
+
+	return std::move(*instance);
+}
+
+// get all shaders used (without duplicates)
+std::vector<std::string> Graphics::getShaderFiles() {
+	std::vector<std::string> result;
+
+	const auto add = [&result](const std::string& fileName) {
+		if(std::find(result.begin(), result.end(), fileName) == result.end())
+			result.push_back(fileName);
+	};
+
+	for(const auto& request : Graphics::pipelineRequests) {
+		add(request.shaderFiles.vertexShader);
+		add(request.shaderFiles.fragmentShader);
+	}
+
+	for(const auto& request : Graphics::postProcessingRequests) {
+		add(request.shaderFiles.vertexShader);
+		add(request.shaderFiles.fragmentShader);
+	}
+
+	add(Graphics::fusedPostProcessingShaderFiles.vertexShader);
+	add(Graphics::fusedPostProcessingShaderFiles.fragmentShader);
+
+	for(const auto& fileName : ComputePostProcessing::getShaderFiles())
+		add(fileName);
+
+	for(const auto& fileName : ParticleSystem::getShaderFiles())
+		add(fileName);
+
+	return result;
+}
+
+// create the draws of a (synthetic) scene, all using the default pipeline
+//  triangle (or empty):	the default triangle
+//  grid:					a grid of 32x32 small triangles (bound by the number of draws)
+//  overdraw:				64 triangles covering the whole screen (bound by the fill rate)
+//  particles[-<n>]:		no draws, the particles are added by the particle system (default: about one million)
+std::vector<Struct::VulkanDraw> Graphics::createScene(const std::string& name, std::size_t pipeline) {
+	const auto numberOfVertices = static_cast<unsigned int>(Graphics::vertices.size());
+
+	std::vector<Struct::VulkanDraw> draws;
+
+	if(name.empty() || name == "triangle")
+		draws.push_back({ pipeline, 0, numberOfVertices });
+	else if(name == "grid") {
+		const unsigned int size = 32;
+		const float cell = 2.0f / size;
+
+		draws.reserve(size * size);
+
+		for(unsigned int y = 0; y < size; ++y)
+			for(unsigned int x = 0; x < size; ++x) {
+				Struct::VulkanDraw draw{ pipeline, 0, numberOfVertices };
+
+				draw.transform = glm::scale(
+						glm::translate(
+								glm::mat4(1.0f),
+								glm::vec3(-1.0f + (x + 0.5f) * cell, -1.0f + (y + 0.5f) * cell, 0.0f)
+						),
+						glm::vec3(cell, cell, 1.0f)
+				);
+
+				draws.emplace_back(draw);
+			}
+	}
+	else if(name == "overdraw") {
+		const unsigned int layers = 64;
+
+		draws.reserve(layers);
+
+		for(unsigned int layer = 0; layer < layers; ++layer) {
+			Struct::VulkanDraw draw{ pipeline, 0, numberOfVertices };
+
+			draw.transform = glm::scale(glm::mat4(1.0f), glm::vec3(16.0f, 16.0f, 1.0f)); // also covers wide screens
+
+			draws.emplace_back(draw);
+		}
+	}
+	else if(!Graphics::getNumberOfParticles(name))
+		throw Exception("Unknown scene: " + name);
+
+	return draws;
+}
+
+// get the number of particles simulated for a scene, i.e. "particles" or "particles-<n>" (zero for other scenes)
+unsigned int Graphics::getNumberOfParticles(const std::string& scene) {
+	const std::string prefix("particles");
+
+	if(scene.compare(0, prefix.size(), prefix) != 0)
+		return 0;
+
+	if(scene.size() == prefix.size())
+		return ParticleSystem::defaultNumberOfParticles;
+
+	const std::string number(scene.substr(prefix.size() + 1));
+	unsigned long result = 0;
+
+	if(scene[prefix.size()] != '-' || number.empty() || number.find_first_not_of("0123456789") != std::string::npos)
+		throw Exception("Unknown scene: " + scene);
+
+	try {
+		result = std::stoul(number);
+	}
+	catch(const std::exception&) {
+		throw Exception("Invalid number of particles: " + number);
+	}
+
+	if(!result || result > std::numeric_limits<std::uint32_t>::max())
+		throw Exception("Invalid number of particles: " + number);
+
+	return static_cast<unsigned int>(result);
 }
 
 // draw a frame using the Vulkan API
 void Graphics::vulkanDrawFrame() {
+	if(this->computePostProcessing) {
+		this->vulkanDrawFrameAsync();
+
+		return;
+	}
+
+	Helper::Trace::Zone waitZone("fence wait");
+
 	(this->vulkanInFlightFences)[this->vulkanCurrentFrame].waitFor();
 
+	waitZone.end();
+
+	// measure the last particle simulation of the frame (finished now)
+	if(this->particleSystem)
+		this->particleSystem->measure(this->vulkanCurrentFrame, &(this->vulkanClockCalibration));
+
 	// acquire image from swap chain
-	unsigned int vulkanImageIndex = 0;
+	if(!(this->vulkanAcquireImage()))
+		return;
 
-	VkResult vulkanResult = vkAcquireNextImageKHR(
-			this->vulkanDevice.get(),
-			this->vulkanSwapChain.get(),
-			std::numeric_limits<unsigned int>::max(),
-			this->vulkanImageAvailableSemaphores[this->vulkanCurrentFrame].get(),
-			VK_NULL_HANDLE,
-			&vulkanImageIndex
+	this->vulkanBeginFrame();
+
+	// record command buffer (by executing the render graph)
+	Helper::Trace::Zone recordZone("command recording");
+
+	Wrapper::VulkanCommandBuffer& vulkanCommandBuffer = this->vulkanCommandBuffers.get(this->vulkanCurrentFrame);
+
+	this->renderGraph.setImported(
+			this->renderGraphSwapChainImage,
+			this->vulkanSwapChain.getImage(this->vulkanImageIndex),
+			this->vulkanSwapChain.getImageView(this->vulkanImageIndex).get()
 	);
 
-	if(vulkanResult == VK_ERROR_OUT_OF_DATE_KHR) {
-		this->vulkanRecreateSwapChain();
+	const bool measureRecording = this->startupStages.isRunning(); // measure recording the first frame
 
-		return;
-	}
-	else if(vulkanResult != VK_SUCCESS && vulkanResult != VK_SUBOPTIMAL_KHR)
-		throw Exception("Could not acquire swap chain image: " + Wrapper::VulkanError(vulkanResult).str());
+	if(measureRecording)
+		this->startupStages.begin("command recording");
+
+	vulkanCommandBuffer.begin();
+
+	// simulate the particles before they are drawn (if any)
+	if(this->particleSystem)
+		this->particleSystem->record(vulkanCommandBuffer.get(), this->vulkanCurrentFrame);
+
+	this->renderGraph.execute(vulkanCommandBuffer.get());
+
+	vulkanCommandBuffer.end();
+
+	if(measureRecording)
+		this->startupStages.end();
+
+	recordZone.end();
 
 	// submit command buffer
+	Helper::Trace::Zone submitZone("submit");
+
 	VkSubmitInfo vulkanSubmitInfo = {};
 
 	vulkanSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -184,7 +795,7 @@ void Graphics::vulkanDrawFrame() {
 	vulkanSubmitInfo.pWaitSemaphores = vulkanWaitSemaphores;
 	vulkanSubmitInfo.pWaitDstStageMask = vulkanWaitStages;
 	vulkanSubmitInfo.commandBufferCount = 1;
-	vulkanSubmitInfo.pCommandBuffers = &(this->vulkanCommandBuffers.get(vulkanImageIndex).get());
+	vulkanSubmitInfo.pCommandBuffers = &(this->vulkanCommandBuffers.get(this->vulkanCurrentFrame).get());
 
 	VkSemaphore vulkanSignalSemaphores[] = { this->vulkanRenderFinishedSemaphores[this->vulkanCurrentFrame].get() };
 
@@ -193,32 +804,288 @@ void Graphics::vulkanDrawFrame() {
 
 	vkResetFences(this->vulkanDevice.get(), 1, &((this->vulkanInFlightFences)[this->vulkanCurrentFrame].get()));
 
-	vulkanResult = vkQueueSubmit(
-			this->vulkanDevice.getGraphicsQueue(),
-			1,
-			&vulkanSubmitInfo,
+	this->vulkanDevice.getGraphicsQueue().submit(
+			vulkanSubmitInfo,
 			this->vulkanInFlightFences[this->vulkanCurrentFrame].get()
 	);
 
-	if(vulkanResult != VK_SUCCESS)
-		throw Exception("Could not submit command buffer: " + Wrapper::VulkanError(vulkanResult).str());
+	submitZone.end();
 
 	// submit result back to swap chain
+	if(!(this->vulkanPresent()))
+		return;
+
+	this->vulkanCurrentFrame = (this->vulkanCurrentFrame + 1) % this->vulkanSwapChain.getInFlightMax();
+}
+
+// draw a frame using the Vulkan API, post-processing it on the compute queue
+//  (while the compute queue post-processes the frame, the graphics queue renders the geometry of the next frame
+//   and composites the frame afterwards, i.e. each frame is presented one frame later than without)
+void Graphics::vulkanDrawFrameAsync() {
+#ifdef VK_KHR_timeline_semaphore
+	const unsigned short frame = this->vulkanCurrentFrame;
+	const unsigned int numberOfSlots = this->computePostProcessing->getNumberOfSlots();
+	const unsigned int slot = this->vulkanAsyncFrame % numberOfSlots;
+	const unsigned int previousSlot = (slot + numberOfSlots - 1) % numberOfSlots;
+	const bool composite = this->vulkanAsyncFrame > 0; // nothing to composite and present for the first frame
+
+	// wait for the work submitted the last time this frame was in flight (on both queues)
+	Helper::Trace::Zone waitZone("timeline wait");
+
+	this->vulkanGraphicsTimeline->wait(this->vulkanGraphicsValues[frame]);
+	this->vulkanComputeTimeline->wait(this->vulkanComputeValues[frame]);
+
+	waitZone.end();
+
+	// measure the overlap of the last post-processing using the slot with the geometry of the frame after it
+	//  (both have been finished now, the timestamps of the slot are reset when recording the geometry)
+	if(this->vulkanAsyncFrame >= numberOfSlots)
+		this->computePostProcessing->measure(slot, (slot + 1) % numberOfSlots, &(this->vulkanClockCalibration));
+
+	// measure the last particle simulation of the frame (finished now, too)
+	if(this->particleSystem)
+		this->particleSystem->measure(frame, &(this->vulkanClockCalibration));
+
+	// acquire image from swap chain (for compositing the previous frame)
+	if(composite && !(this->vulkanAcquireImage()))
+		return;
+
+	this->vulkanBeginFrame();
+
+	// record the geometry of the frame (by executing the render graph of the scene)
+	Helper::Trace::Zone recordZone("command recording");
+
+	const bool measureRecording = this->startupStages.isRunning(); // measure recording the first frame
+
+	if(measureRecording)
+		this->startupStages.begin("command recording");
+
+	Wrapper::VulkanCommandBuffer& vulkanSceneCommandBuffer = this->vulkanCommandBuffers.get(frame);
+	const Wrapper::VulkanImage& sceneImage = this->computePostProcessing->getSceneImage(slot);
+
+	this->sceneGraph.setImported(this->sceneGraphImage, sceneImage.get(), sceneImage.getView().get());
+
+	vulkanSceneCommandBuffer.begin();
+
+	// simulate the particles before the geometry is drawn (if any)
+	if(this->particleSystem)
+		this->particleSystem->record(vulkanSceneCommandBuffer.get(), frame);
+
+	this->computePostProcessing->beginScene(vulkanSceneCommandBuffer.get(), slot);
+
+	this->sceneGraph.execute(vulkanSceneCommandBuffer.get());
+
+	this->computePostProcessing->endScene(vulkanSceneCommandBuffer.get(), slot);
+
+	vulkanSceneCommandBuffer.end();
+
+	// record the compositing of the previous frame (by executing the render graph of the frame)
+	Wrapper::VulkanCommandBuffer& vulkanCompositeCommandBuffer = this->vulkanCompositeCommandBuffers.get(frame);
+
+	if(composite) {
+		const Wrapper::VulkanImage& postProcessedImage = this->computePostProcessing->getOutputImage(previousSlot);
+
+		this->renderGraph.setImported(
+				this->renderGraphSwapChainImage,
+				this->vulkanSwapChain.getImage(this->vulkanImageIndex),
+				this->vulkanSwapChain.getImageView(this->vulkanImageIndex).get()
+		);
+		this->renderGraph.setImported(
+				this->renderGraphTargets.front(),
+				postProcessedImage.get(),
+				postProcessedImage.getView().get()
+		);
+
+		vulkanCompositeCommandBuffer.begin();
+
+		this->renderGraph.execute(vulkanCompositeCommandBuffer.get());
+
+		vulkanCompositeCommandBuffer.end();
+	}
+
+	// record the post-processing of the frame
+	Wrapper::VulkanCommandBuffer& vulkanComputeCommandBuffer = this->computePostProcessing->record(slot);
+
+	if(measureRecording)
+		this->startupStages.end();
+
+	recordZone.end();
+
+	// submit the geometry of the frame and the compositing of the previous frame
+	//  (the latter waiting for the swap chain image and the post-processing of the previous frame)
+	Helper::Trace::Zone submitZone("submit");
+
+	const std::uint64_t vulkanSceneValue = this->vulkanGraphicsTimeline->next();
+
+	VkTimelineSemaphoreSubmitInfoKHR vulkanSceneTimelineInfo = {};
+
+	vulkanSceneTimelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+	vulkanSceneTimelineInfo.signalSemaphoreValueCount = 1;
+	vulkanSceneTimelineInfo.pSignalSemaphoreValues = &vulkanSceneValue;
+
+	VkSubmitInfo vulkanSubmitInfos[2] = {};
+
+	vulkanSubmitInfos[0].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	vulkanSubmitInfos[0].pNext = &vulkanSceneTimelineInfo;
+	vulkanSubmitInfos[0].commandBufferCount = 1;
+	vulkanSubmitInfos[0].pCommandBuffers = &(vulkanSceneCommandBuffer.get());
+	vulkanSubmitInfos[0].signalSemaphoreCount = 1;
+	vulkanSubmitInfos[0].pSignalSemaphores = &(this->vulkanGraphicsTimeline->get());
+
+	VkSemaphore vulkanWaitSemaphores[] = {
+			this->vulkanImageAvailableSemaphores[frame].get(),
+			this->vulkanComputeTimeline->get()
+	};
+	VkPipelineStageFlags vulkanWaitStages[] = {
+			VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+	};
+	VkSemaphore vulkanSignalSemaphores[] = {
+			this->vulkanRenderFinishedSemaphores[frame].get(),
+			this->vulkanGraphicsTimeline->get()
+	};
+
+	const std::uint64_t vulkanWaitValues[] = { 0, this->vulkanPostProcessedValues[previousSlot] }; // binary: ignored
+	const std::uint64_t vulkanSignalValues[] = { 0, composite ? this->vulkanGraphicsTimeline->next() : 0 };
+
+	VkTimelineSemaphoreSubmitInfoKHR vulkanCompositeTimelineInfo = {};
+
+	vulkanCompositeTimelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+	vulkanCompositeTimelineInfo.waitSemaphoreValueCount = 2;
+	vulkanCompositeTimelineInfo.pWaitSemaphoreValues = vulkanWaitValues;
+	vulkanCompositeTimelineInfo.signalSemaphoreValueCount = 2;
+	vulkanCompositeTimelineInfo.pSignalSemaphoreValues = vulkanSignalValues;
+
+	vulkanSubmitInfos[1].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	vulkanSubmitInfos[1].pNext = &vulkanCompositeTimelineInfo;
+	vulkanSubmitInfos[1].waitSemaphoreCount = 2;
+	vulkanSubmitInfos[1].pWaitSemaphores = vulkanWaitSemaphores;
+	vulkanSubmitInfos[1].pWaitDstStageMask = vulkanWaitStages;
+	vulkanSubmitInfos[1].commandBufferCount = 1;
+	vulkanSubmitInfos[1].pCommandBuffers = &(vulkanCompositeCommandBuffer.get());
+	vulkanSubmitInfos[1].signalSemaphoreCount = 2;
+	vulkanSubmitInfos[1].pSignalSemaphores = vulkanSignalSemaphores;
+
+	this->vulkanDevice.getGraphicsQueue().submit(composite ? 2 : 1, vulkanSubmitInfos, VK_NULL_HANDLE);
+
+	this->vulkanGraphicsValues[frame] = this->vulkanGraphicsTimeline->getLast();
+
+	// submit the post-processing of the frame (waiting for its geometry)
+	const std::uint64_t vulkanComputeValue = this->vulkanComputeTimeline->next();
+	const VkPipelineStageFlags vulkanComputeWaitStage = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+	VkTimelineSemaphoreSubmitInfoKHR vulkanComputeTimelineInfo = {};
+
+	vulkanComputeTimelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+	vulkanComputeTimelineInfo.waitSemaphoreValueCount = 1;
+	vulkanComputeTimelineInfo.pWaitSemaphoreValues = &vulkanSceneValue;
+	vulkanComputeTimelineInfo.signalSemaphoreValueCount = 1;
+	vulkanComputeTimelineInfo.pSignalSemaphoreValues = &vulkanComputeValue;
+
+	VkSubmitInfo vulkanComputeSubmitInfo = {};
+
+	vulkanComputeSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	vulkanComputeSubmitInfo.pNext = &vulkanComputeTimelineInfo;
+	vulkanComputeSubmitInfo.waitSemaphoreCount = 1;
+	vulkanComputeSubmitInfo.pWaitSemaphores = &(this->vulkanGraphicsTimeline->get());
+	vulkanComputeSubmitInfo.pWaitDstStageMask = &vulkanComputeWaitStage;
+	vulkanComputeSubmitInfo.commandBufferCount = 1;
+	vulkanComputeSubmitInfo.pCommandBuffers = &(vulkanComputeCommandBuffer.get());
+	vulkanComputeSubmitInfo.signalSemaphoreCount = 1;
+	vulkanComputeSubmitInfo.pSignalSemaphores = &(this->vulkanComputeTimeline->get());
+
+	this->vulkanDevice.getComputeQueue().submit(vulkanComputeSubmitInfo, VK_NULL_HANDLE);
+
+	submitZone.end();
+
+	this->vulkanComputeValues[frame] = vulkanComputeValue;
+	this->vulkanPostProcessedValues[slot] = vulkanComputeValue;
+
+	++(this->vulkanAsyncFrame);
+
+	// submit the previous frame back to swap chain
+	if(composite && !(this->vulkanPresent()))
+		return;
+
+	this->vulkanCurrentFrame = (this->vulkanCurrentFrame + 1) % this->vulkanSwapChain.getInFlightMax();
+#else
+	throw Exception("Timeline semaphores are not supported by the Vulkan API headers");
+#endif
+}
+
+// acquire the next image from the swap chain (returns false if the swap chain has been re-created instead)
+bool Graphics::vulkanAcquireImage() {
+	Helper::Trace::Zone acquireZone("acquire");
+
+	VkResult vulkanResult = vkAcquireNextImageKHR(
+			this->vulkanDevice.get(),
+			this->vulkanSwapChain.get(),
+			std::numeric_limits<unsigned int>::max(),
+			this->vulkanImageAvailableSemaphores[this->vulkanCurrentFrame].get(),
+			VK_NULL_HANDLE,
+			&(this->vulkanImageIndex)
+	);
+
+	acquireZone.end();
+
+	if(vulkanResult == VK_ERROR_OUT_OF_DATE_KHR) {
+		this->vulkanRecreateSwapChain();
+
+		return false;
+	}
+	else if(vulkanResult != VK_SUCCESS && vulkanResult != VK_SUBOPTIMAL_KHR)
+		throw Exception("Could not acquire swap chain image: " + Wrapper::VulkanError(vulkanResult).str());
+
+	return true;
+}
+
+// prepare the current frame for recording (it may not be in use by the GPU anymore)
+void Graphics::vulkanBeginFrame() {
+	// take over pipelines that have been created in the background in the meantime
+	this->vulkanPipelineCache.poll();
+
+	// free the transient descriptor sets of the frame (the frame is not in use by the GPU anymore)
+	this->vulkanDescriptorAllocator.beginFrame(this->vulkanCurrentFrame);
+
+	// update per-frame uniforms (keeping the aspect ratio of the scene)
+	const VkExtent2D& vulkanExtent = this->vulkanSwapChain.getExtent();
+	const float aspectRatio = static_cast<float>(vulkanExtent.width) / static_cast<float>(vulkanExtent.height);
+
+	Struct::FrameUniforms frameUniforms;
+
+	frameUniforms.viewProjection = glm::scale(
+			glm::mat4(1.0f),
+			aspectRatio > 1.0f ? glm::vec3(1.0f / aspectRatio, 1.0f, 1.0f) : glm::vec3(1.0f, aspectRatio, 1.0f)
+	);
+
+	this->vulkanUniformBuffer.begin(this->vulkanCurrentFrame);
+
+	this->vulkanFrameOffset = this->vulkanUniformBuffer.push(frameUniforms);
+}
+
+// submit the rendered image back to the swap chain (returns false if the swap chain has been re-created afterwards)
+bool Graphics::vulkanPresent() {
 	VkPresentInfoKHR vulkanPresentInfo = {};
 
 	vulkanPresentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
 
+	VkSemaphore vulkanWaitSemaphores[] = { this->vulkanRenderFinishedSemaphores[this->vulkanCurrentFrame].get() };
+
 	vulkanPresentInfo.waitSemaphoreCount = 1;
-	vulkanPresentInfo.pWaitSemaphores = vulkanSignalSemaphores;
+	vulkanPresentInfo.pWaitSemaphores = vulkanWaitSemaphores;
 
 	VkSwapchainKHR vulkanSwapChains[] = { this->vulkanSwapChain.get() };
 
 	vulkanPresentInfo.swapchainCount = 1;
 	vulkanPresentInfo.pSwapchains = vulkanSwapChains;
-	vulkanPresentInfo.pImageIndices = &vulkanImageIndex;
+	vulkanPresentInfo.pImageIndices = &(this->vulkanImageIndex);
 	vulkanPresentInfo.pResults = nullptr;
 
-	vulkanResult = vkQueuePresentKHR(this->vulkanDevice.getPresentQueue(), &vulkanPresentInfo);
+	Helper::Trace::Zone presentZone("present");
+
+	VkResult vulkanResult = this->vulkanDevice.getPresentQueue().present(vulkanPresentInfo);
+
+	presentZone.end();
 
 	if(
 			vulkanResult == VK_ERROR_OUT_OF_DATE_KHR
@@ -229,35 +1096,251 @@ void Graphics::vulkanDrawFrame() {
 
 		this->vulkanRecreateSwapChain();
 
-		return;
+		return false;
 	}
 	else if(vulkanResult != VK_SUCCESS)
     	throw Exception("Could not present swap chain image: " + Wrapper::VulkanError(vulkanResult).str());
 
-	this->vulkanCurrentFrame = (this->vulkanCurrentFrame + 1) % this->vulkanSwapChain.getInFlightMax();
+	return true;
 }
 
 // re-create the swap chain, e.g. after changes to the window
 void Graphics::vulkanRecreateSwapChain() {
+	const Helper::Trace::Zone recreateZone("swap chain recreation");
+
 	// wait for the device to become idle
 	this->vulkanDeviceWaitIdle.wait();
 
-	// destroy old swap chain
-	this->vulkanCommandBuffers.destroy();
+	// destroy old swap chain (the command buffers do not need to be re-created, because they are recorded for each frame)
+	this->vulkanPostFrameBuffers.destroy();
 	this->vulkanFrameBuffers.destroy();
-	this->vulkanPipeline.destroy();
+
+	if(this->computePostProcessing)
+		this->computePostProcessing->destroy();
+
+	this->vulkanPostRenderPass.destroy();
 	this->vulkanRenderPass.destroy();
 	this->vulkanSwapChain.destroy();
 
-	// reset command pool memory
-	this->vulkanCommandPool.reset(); // saving some memory (TODO: reset command pool more often?!)
-
 	// create new swap chain
 	this->vulkanSwapChain.create();
 	this->vulkanRenderPass.create();
-	this->vulkanPipeline.create();
+	this->vulkanPostRenderPass.create();
+	this->vulkanPipelineCache.update(); // re-creates the pipelines only if the render pass is not compatible anymore
+	this->vulkanPostPipelineCache.update();
 	this->vulkanFrameBuffers.create();
-	this->vulkanCommandBuffers.create();
+	this->vulkanPostFrameBuffers.create();
+
+	// re-create the post-processing on the compute queue (starting over with the first frame)
+	if(this->computePostProcessing) {
+		this->computePostProcessing->create();
+
+		this->vulkanAsyncFrame = 0;
+	}
+
+	// draw the scene again for the new swap chain
+	this->invalidate();
+
+	// re-build the render graph for the new swap chain
+	this->vulkanBuildRenderGraph();
+}
+
+// build and compile the render graph of a frame
+void Graphics::vulkanBuildRenderGraph() {
+	this->renderGraph.clear();
+	this->sceneGraph.clear();
+
+	// swap chain image (imported, needs to be presented afterwards)
+	Struct::RenderGraphResource swapChainImage;
+
+	swapChainImage.name = "swap chain image";
+	swapChainImage.format = this->vulkanSwapChain.getImageFormat();
+	swapChainImage.extent = this->vulkanSwapChain.getExtent();
+	swapChainImage.imported = true;
+	swapChainImage.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+	this->renderGraphSwapChainImage = this->renderGraph.addResource(swapChainImage);
+
+	this->renderGraph.setOutput(this->renderGraphSwapChainImage);
+
+	// the scene pass is followed by the post-processing steps that are not fused into it
+	const bool fused = this->vulkanRenderPass.hasPostProcessingSubpass();
+	const std::size_t numberOfPasses = 1 + Graphics::postProcessingRequests.size() - (fused ? 1 : 0);
+
+	// offscreen images written by all passes but the last one, which writes the swap chain image
+	//  (when post-processing on the compute queue, the first one is imported from there instead)
+	this->renderGraphTargets.clear();
+
+	for(std::size_t pass = 0; pass + 1 < numberOfPasses; ++pass) {
+		if(!pass && this->vulkanAsyncPostProcessing) {
+			Struct::RenderGraphResource postProcessedImage;
+
+			postProcessedImage.name = "post-processed image";
+			postProcessedImage.format = ComputePostProcessing::outputFormat;
+			postProcessedImage.extent = this->vulkanSwapChain.getExtent();
+			postProcessedImage.imported = true;
+			postProcessedImage.initialLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+			this->renderGraphTargets.push_back(this->renderGraph.addResource(postProcessedImage));
+
+			continue;
+		}
+
+		Struct::RenderGraphResource offscreenImage;
+
+		offscreenImage.name = "offscreen image #" + std::to_string(pass + 1);
+		offscreenImage.format = this->vulkanSwapChain.getImageFormat();
+		offscreenImage.extent = this->vulkanSwapChain.getExtent();
+
+		this->renderGraphTargets.push_back(this->renderGraph.addResource(offscreenImage));
+	}
+
+	this->renderGraphTargets.push_back(this->renderGraphSwapChainImage);
+
+	// scene pass (including the first post-processing step, if fused)
+	//  (when post-processing on the compute queue, the scene is rendered by its own render graph)
+	RenderGraph& scenePassGraph = this->vulkanAsyncPostProcessing ? this->sceneGraph : this->renderGraph;
+
+	const std::size_t scenePass = scenePassGraph.addPass("scene", [this, fused](VkCommandBuffer commandBuffer) {
+		Wrapper::VulkanCommandBuffer vulkanCommandBuffer(commandBuffer);
+		const Struct::VulkanRenderTarget vulkanTarget = this->vulkanGetTarget(0);
+		const Wrapper::VulkanPipeline * postProcessingPipeline = nullptr;
+		VkDescriptorSet vulkanPostProcessingSet = VK_NULL_HANDLE;
+
+		if(fused) {
+			postProcessingPipeline = &(this->vulkanPipelineCache.getPipeline(this->vulkanPostPipelines.at(0)));
+
+			vulkanPostProcessingSet = this->vulkanGetPostProcessingSet(
+					*postProcessingPipeline,
+					VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT,
+					vulkanTarget.inputImageView
+			);
+		}
+
+		vulkanCommandBuffer.recordPass(
+				this->vulkanRenderPass,
+				vulkanTarget,
+				this->vulkanPipelineCache,
+				this->vulkanVertexBuffer,
+				this->vulkanFrameSet,
+				this->vulkanFrameOffset,
+				this->vulkanDraws,
+				postProcessingPipeline,
+				vulkanPostProcessingSet
+		);
+	});
+
+	if(this->vulkanAsyncPostProcessing) {
+		// scene image (imported from the current slot of the post-processing, needs to be sampled afterwards)
+		Struct::RenderGraphResource sceneImage;
+
+		sceneImage.name = "scene image";
+		sceneImage.format = this->vulkanSceneFormat;
+		sceneImage.extent = this->vulkanSwapChain.getExtent();
+		sceneImage.imported = true;
+		sceneImage.finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+		this->sceneGraphImage = this->sceneGraph.addResource(sceneImage);
+
+		this->sceneGraph.setOutput(this->sceneGraphImage);
+		this->sceneGraph.write(scenePass, this->sceneGraphImage, RenderGraph::Usage::colorAttachment);
+		this->sceneGraph.compile();
+
+		// add the scene images of all slots as targets of the scene pass
+		this->vulkanSceneTargets.clear();
+
+		for(unsigned int slot = 0; slot < this->computePostProcessing->getNumberOfSlots(); ++slot) {
+			const Wrapper::VulkanImage& slotImage = this->computePostProcessing->getSceneImage(slot);
+
+			this->vulkanSceneTargets.push_back(
+					this->vulkanFrameBuffers.addOffscreenTarget(slotImage.get(), slotImage.getView().get())
+			);
+		}
+	}
+	else
+		this->renderGraph.write(scenePass, this->renderGraphTargets.front(), RenderGraph::Usage::colorAttachment);
+
+	// remaining post-processing steps (each sampling the image written by the previous pass)
+	for(std::size_t pass = 1; pass < numberOfPasses; ++pass) {
+		const std::size_t step = fused ? pass : pass - 1;
+
+		const std::size_t postProcessingPass = this->renderGraph.addPass(
+				"post-processing #" + std::to_string(step + 1),
+				[this, pass, step](VkCommandBuffer commandBuffer) {
+					Wrapper::VulkanCommandBuffer vulkanCommandBuffer(commandBuffer);
+					const Wrapper::VulkanPipeline& pipeline = this->vulkanPostPipelineCache.getPipeline(
+							this->vulkanPostPipelines.at(step)
+					);
+
+					vulkanCommandBuffer.recordFullscreenPass(
+							this->vulkanPostRenderPass,
+							this->vulkanGetTarget(pass),
+							pipeline,
+							this->vulkanGetPostProcessingSet(
+									pipeline,
+									VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+									this->renderGraph.getImageView(this->renderGraphTargets.at(pass - 1))
+							)
+					);
+				}
+		);
+
+		this->renderGraph.read(postProcessingPass, this->renderGraphTargets[pass - 1], RenderGraph::Usage::sampled);
+		this->renderGraph.write(postProcessingPass, this->renderGraphTargets[pass], RenderGraph::Usage::colorAttachment);
+	}
+
+	this->renderGraph.compile();
+
+	// add the (now created) offscreen images as targets of the passes writing them
+	this->vulkanTargets.assign(numberOfPasses, 0);
+
+	for(std::size_t pass = this->vulkanAsyncPostProcessing ? 1 : 0; pass + 1 < numberOfPasses; ++pass)
+		this->vulkanTargets[pass] = (pass ? this->vulkanPostFrameBuffers : this->vulkanFrameBuffers).addOffscreenTarget(
+				this->renderGraph.getImage(this->renderGraphTargets[pass]),
+				this->renderGraph.getImageView(this->renderGraphTargets[pass])
+		);
+}
+
+// get the target of a pass of the render graph (the scene pass being the first one)
+Struct::VulkanRenderTarget Graphics::vulkanGetTarget(std::size_t pass) const {
+	const Wrapper::VulkanFrameBuffers& frameBuffers = pass ? this->vulkanPostFrameBuffers : this->vulkanFrameBuffers;
+
+	if(!pass && this->vulkanAsyncPostProcessing)
+		return frameBuffers.getTarget(
+				this->vulkanSceneTargets.at(this->vulkanAsyncFrame % this->computePostProcessing->getNumberOfSlots())
+		);
+
+	if(this->renderGraphTargets.at(pass) == this->renderGraphSwapChainImage)
+		return frameBuffers.getTarget(this->vulkanImageIndex);
+
+	return frameBuffers.getTarget(this->vulkanTargets.at(pass));
+}
+
+// get a (transient) descriptor set for reading the source of a post-processing step in the current frame
+VkDescriptorSet Graphics::vulkanGetPostProcessingSet(
+		const Wrapper::VulkanPipeline& pipeline,
+		VkDescriptorType type,
+		VkImageView source
+) {
+	VkDescriptorSet vulkanSet = this->vulkanDescriptorAllocator.allocate(
+			this->vulkanCurrentFrame,
+			this->threadPool.getNumberOfThreads(), // main thread
+			pipeline.getSetLayout(0)
+	);
+
+	Struct::VulkanDescriptorBinding sourceBinding;
+
+	sourceBinding.binding = 0;
+	sourceBinding.type = type;
+	sourceBinding.image.imageView = source;
+	sourceBinding.image.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+	if(type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
+		sourceBinding.image.sampler = this->vulkanSampler.get();
+
+	this->vulkanDescriptorAllocator.write(vulkanSet, { sourceBinding });
+
+	return vulkanSet;
 }
 
 } /* namespace spacelite::Engine */
@@ -10,23 +10,43 @@
 #ifndef SRC_ENGINE_GRAPHICS_HPP_
 #define SRC_ENGINE_GRAPHICS_HPP_
 
+#include "ComputePostProcessing.hpp"
+#include "ParticleSystem.hpp"
+#include "RenderGraph.hpp"
 #include "Version.hpp"
 
 #include "../Helper/File.hpp"
+#include "../Helper/FileCache.hpp"
+#include "../Helper/Log.hpp"
 #include "../Helper/SingletonDestructor.hpp"
+#include "../Helper/StageTimer.hpp"
+#include "../Helper/TaskGraph.hpp"
+#include "../Helper/ThreadPool.hpp"
 #include "../Helper/TimerHighRes.hpp"
+#include "../Helper/Trace.hpp"
 #include "../Helper/VulkanAllocator.hpp"
 #include "../Main/Exception.hpp"
 #include "../Main/Window.hpp"
 #include "../Struct/AppInfo.hpp"
 #include "../Struct/EngineInfo.hpp"
+#include "../Struct/FrameUniforms.hpp"
+#include "../Struct/RenderGraphResource.hpp"
 #include "../Struct/ShaderFiles.hpp"
+#include "../Struct/StartupStage.hpp"
+#include "../Struct/VulkanDescriptorBinding.hpp"
 #include "../Struct/Vertex.hpp"
+#include "../Struct/VulkanDraw.hpp"
+#include "../Struct/VulkanPipelineRequest.hpp"
+#include "../Struct/VulkanPipelineState.hpp"
 #include "../Struct/VulkanQueueFamilies.hpp"
+#include "../Struct/VulkanRenderTarget.hpp"
 #include "../Struct/VulkanRequirements.hpp"
+#include "../Struct/VulkanSpecialization.hpp"
 #include "../Struct/VulkanSwapChainSupport.hpp"
+#include "../Wrapper/VulkanClockCalibration.hpp"
 #include "../Wrapper/VulkanCommandBuffers.hpp"
 #include "../Wrapper/VulkanCommandPool.hpp"
+#include "../Wrapper/VulkanDescriptorAllocator.hpp"
 #include "../Wrapper/VulkanDevice.hpp"
 #include "../Wrapper/VulkanDeviceMemory.hpp"
 #include "../Wrapper/VulkanDeviceWaitIdle.hpp"
@@ -36,10 +56,14 @@
 #include "../Wrapper/VulkanInstance.hpp"
 #include "../Wrapper/VulkanPhysicalDevice.hpp"
 #include "../Wrapper/VulkanPipeline.hpp"
+#include "../Wrapper/VulkanPipelineCache.hpp"
 #include "../Wrapper/VulkanRenderPass.hpp"
+#include "../Wrapper/VulkanSampler.hpp"
 #include "../Wrapper/VulkanSemaphore.hpp"
 #include "../Wrapper/VulkanSurface.hpp"
 #include "../Wrapper/VulkanSwapChain.hpp"
+#include "../Wrapper/VulkanTimelineSemaphore.hpp"
+#include "../Wrapper/VulkanUniformRingBuffer.hpp"
 #include "../Wrapper/VulkanVertexBuffer.hpp"
 
 #ifndef GLFW_INCLUDE_VULKAN
@@ -52,13 +76,20 @@
 #endif
 
 #include <GLFW/glfw3.h>	// includes the Vulkan API, too (-DGLFW_INCLUDE_VULKAN required!)
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
 
+#include <algorithm>	// std::find, std::stable_sort
 #include <cassert>	// assert
+#include <cstdint>	// std::uint32_t, std::uint64_t
 #include <cstring>	// std::memcpy
-#include <iostream>	// std::cout, std::endl, std::flush
+#include <exception>	// std::exception
 #include <limits>	// std::numeric_limits
+#include <memory>	// std::make_unique, std::unique_ptr
+#include <optional>	// std::optional
 #include <set>		// std::set
-#include <string>	// std::string, std::to_string
+#include <string>	// std::stoul, std::string, std::to_string
+#include <utility>	// std::move
 #include <vector>	// std::vector
 
 namespace spacelite::Engine {
@@ -70,6 +101,15 @@ namespace spacelite::Engine {
 		static const unsigned int maxFramesInFlight;
 		static const std::vector<Struct::Vertex> vertices;
 		static const Struct::ShaderFiles shaderFiles;
+		static const VkSampleCountFlagBits msaaSamples;
+		static const bool depthPrepass;
+		static const std::vector<Struct::VulkanPipelineRequest> pipelineRequests;
+		static const std::vector<Struct::VulkanPipelineRequest> postProcessingRequests;
+		static const Struct::ShaderFiles fusedPostProcessingShaderFiles;
+		static const bool fusePostProcessing;
+		static const bool asyncPostProcessing;
+		static const bool animated;
+		static const std::string pipelineCacheFile;
 		/* END STATIC CONSTANTS */
 
 		/* QUASI-SINGLETON W/ POINTER AND DESTRUCTOR */
@@ -77,6 +117,7 @@ namespace spacelite::Engine {
 		static Graphics& getInstance(
 				const Struct::AppInfo& appInfo,
 				Main::Window& window,
+				const std::string& scene,
 				Helper::SingletonDestructor<Graphics> * destructor = nullptr
 		) {
 			static class SingletonHolder {
@@ -84,9 +125,10 @@ namespace spacelite::Engine {
 				SingletonHolder(
 						const Struct::AppInfo& appInfo,
 						Main::Window& window,
+						const std::string& scene,
 						Helper::SingletonDestructor<Graphics> * destructor
 				) : ptr(nullptr), destructionDelegated(false) {
-					this->ptr = new Graphics(appInfo, window);
+					this->ptr = new Graphics(appInfo, window, scene);
 
 					assert(this->ptr);
 
@@ -112,7 +154,7 @@ namespace spacelite::Engine {
 				Graphics * ptr;
 
 				bool destructionDelegated;
-			} holder(appInfo, window, destructor);
+			} holder(appInfo, window, scene, destructor);
 
 			return holder.get();
 		}
@@ -120,15 +162,34 @@ namespace spacelite::Engine {
 		virtual ~Graphics();
 
 	private:
-		Graphics(const Struct::AppInfo& appInfo, Main::Window& window);
+		Graphics(const Struct::AppInfo& appInfo, Main::Window& window, const std::string& scene);
 
 	public:
 		Graphics(const Graphics&) = delete;
 		void operator=(const Graphics&) = delete;
 		/* END SINGLETON */
 
+		// name of the startup stage containing the tasks run in the background (summed over all threads)
+		static const std::string backgroundStage;
+
 		void tick();
 
+		// on-demand rendering
+		void invalidate();
+		bool needsFrame() const;
+
+		// getters (e.g. for reports)
+		double getStartupTime() const;
+		double getStartupCriticalPath() const;
+		double getStartupSequentialTime() const;
+		unsigned int getNumberOfParticles() const;
+		double getParticleSimulationTime() const;
+		const std::vector<Struct::StartupStage>& getStartupStages() const;
+		const RenderGraph& getRenderGraph() const;
+		const VkPhysicalDeviceProperties& getDeviceProperties() const;
+		std::string getDeviceCapabilities() const;
+		double getSpeed() const;
+
 		// not moveable
 		Graphics(Graphics&&) = delete;
 		Graphics& operator=(Graphics&&) = delete;
@@ -139,12 +200,50 @@ namespace spacelite::Engine {
 		unsigned long long counter;
 		double speed; // speed in average ticks per second
 
+		// number of frames still needed to show the current state of the scene
+		unsigned short framesNeeded;
+
+		// time needed for the startup (in ms) and its stages (including the first frame)
+		double startupTime;
+		Helper::StageTimer startupStages;
+
 		// reference to target window
 		Main::Window& targetWindow;
 
+		// thread pool (e.g. for creating pipelines in parallel)
+		Helper::ThreadPool threadPool;
+
+		// tasks of the startup running in the background (e.g. loading files) and the pipeline cache data loaded by them
+		//  (the data needs to be declared first, so that it will be destroyed after all tasks have finished)
+		std::vector<char> pipelineCacheData;
+		Helper::TaskGraph startupTasks;
+
+		// start the tasks of the startup and create the Vulkan API instance while opening the window
+		Wrapper::VulkanInstance startup(const Struct::AppInfo& appInfo);
+
+		// get all shaders used (e.g. for preloading them)
+		static std::vector<std::string> getShaderFiles();
+
+		// create the draws of a (synthetic) scene
+		static std::vector<Struct::VulkanDraw> createScene(const std::string& name, std::size_t pipeline);
+
+		// get the number of particles simulated for a scene (zero if it is not a particle scene)
+		static unsigned int getNumberOfParticles(const std::string& scene);
+
 		// Vulkan API-specific functions
 		void vulkanDrawFrame();
+		void vulkanDrawFrameAsync();
+		bool vulkanAcquireImage();
+		void vulkanBeginFrame();
+		bool vulkanPresent();
 		void vulkanRecreateSwapChain();
+		void vulkanBuildRenderGraph();
+		Struct::VulkanRenderTarget vulkanGetTarget(std::size_t pass) const;
+		VkDescriptorSet vulkanGetPostProcessingSet(
+				const Wrapper::VulkanPipeline& pipeline,
+				VkDescriptorType type,
+				VkImageView source
+		);
 
 		// Vulkan API-related wrappers
 #ifndef NDEBUG
@@ -157,22 +256,65 @@ namespace spacelite::Engine {
 		Wrapper::VulkanSurface vulkanSurface;
 		Wrapper::VulkanPhysicalDevice vulkanPhysicalDevice;
 		Wrapper::VulkanDevice vulkanDevice;
+		Wrapper::VulkanClockCalibration vulkanClockCalibration; // for adding GPU timestamps to the trace
 		Wrapper::VulkanSwapChain vulkanSwapChain;
+
+		// post-processing by compute shaders on the compute queue (if supported), rendering the scene in HDR
+		const bool vulkanAsyncPostProcessing;
+		VkFormat vulkanSceneFormat;
+
 		Wrapper::VulkanRenderPass vulkanRenderPass;
-		Wrapper::VulkanPipeline vulkanPipeline;
+		Wrapper::VulkanRenderPass vulkanPostRenderPass;
+		Wrapper::VulkanPipelineCache vulkanPipelineCache;
+		Wrapper::VulkanPipelineCache vulkanPostPipelineCache;
+		std::vector<std::size_t> vulkanPipelines;
+		std::vector<std::size_t> vulkanPostPipelines;
+		std::vector<Struct::VulkanDraw> vulkanDraws;
 		Wrapper::VulkanFrameBuffers vulkanFrameBuffers;
+		Wrapper::VulkanFrameBuffers vulkanPostFrameBuffers;
+		Wrapper::VulkanSampler vulkanSampler;
 		Wrapper::VulkanCommandPool vulkanCommandPool;
+		Wrapper::VulkanCommandPool vulkanTransferCommandPool;
 		Wrapper::VulkanVertexBuffer vulkanVertexBuffer;
+		Wrapper::VulkanUniformRingBuffer vulkanUniformBuffer;
+		Wrapper::VulkanDescriptorAllocator vulkanDescriptorAllocator;
+		VkDescriptorSet vulkanFrameSet;
 		Wrapper::VulkanCommandBuffers vulkanCommandBuffers;
+		Wrapper::VulkanCommandBuffers vulkanCompositeCommandBuffers; // compositing the previous frame (async only)
 		std::vector<Wrapper::VulkanSemaphore> vulkanImageAvailableSemaphores;
 		std::vector<Wrapper::VulkanSemaphore> vulkanRenderFinishedSemaphores;
 		std::vector<Wrapper::VulkanFence> vulkanInFlightFences;
 
+		// post-processing on the compute queue, synchronized by timeline semaphores instead of fences (async only)
+		std::unique_ptr<ComputePostProcessing> computePostProcessing;
+		std::unique_ptr<Wrapper::VulkanTimelineSemaphore> vulkanGraphicsTimeline;
+		std::unique_ptr<Wrapper::VulkanTimelineSemaphore> vulkanComputeTimeline;
+		std::vector<std::uint64_t> vulkanGraphicsValues;	// last values signaled for each frame in flight
+		std::vector<std::uint64_t> vulkanComputeValues;		// last values signaled for each frame in flight
+		std::vector<std::uint64_t> vulkanPostProcessedValues;	// values signaled for each slot of the post-processing
+
+		// particles simulated by a compute shader on the graphics queue (particle scenes only)
+		std::unique_ptr<ParticleSystem> particleSystem;
+
+		// render graph of a frame (with the imported swap chain image and the images written by its passes)
+		RenderGraph renderGraph;
+		std::size_t renderGraphSwapChainImage;
+		std::vector<std::size_t> renderGraphTargets;
+		std::vector<unsigned int> vulkanTargets; // targets of the frame buffers for offscreen images
+
+		// render graph of the scene rendered for post-processing on the compute queue (async only)
+		RenderGraph sceneGraph;
+		std::size_t sceneGraphImage;
+		std::vector<unsigned int> vulkanSceneTargets; // targets of the frame buffers for the scene images
+
 		// wait for the device before starting to destruct Vulkan API-related objects
 		const Wrapper::VulkanDeviceWaitIdle vulkanDeviceWaitIdle;
 
 		// rendering state
 		unsigned short vulkanCurrentFrame;
+		unsigned int vulkanImageIndex;
+		std::uint32_t vulkanFrameOffset;
+		unsigned long long vulkanAsyncFrame; // frames rendered since the post-processing has been (re-)created
 
 		// exception sub-class
 		MAIN_EXCEPTION_CLASS();
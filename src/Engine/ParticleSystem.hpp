@@ -0,0 +1,407 @@
+/*
+ * ParticleSystem.hpp
+ *
+ * Particles simulated by a compute shader on the GPU and drawn as points, orbiting an attractor in the center.
+ *
+ * The simulation writes the vertices of the particles (i.e. position and color) into a storage buffer,
+ *  which is then used as vertex buffer by the draw of the particles, so that the particles never need to be
+ *  copied back to the host. The velocities are kept in a second storage buffer that is only used by the simulation.
+ *
+ * The simulation is recorded into the command buffer of each frame (on the graphics queue) before the render pass,
+ *  so that it is ordered by a barrier against both the draw of the current frame and the draw of the previous one.
+ *  The particles are initialized by the same compute shader when the simulation is recorded for the first time.
+ *
+ * If supported, timestamps are written before and after the simulation, so that its GPU time can be measured.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_ENGINE_PARTICLESYSTEM_HPP_
+#define SRC_ENGINE_PARTICLESYSTEM_HPP_
+
+#include "../Helper/TimerHighRes.hpp"
+#include "../Helper/Trace.hpp"
+#include "../Main/Exception.hpp"
+#include "../Struct/VulkanDescriptorBinding.hpp"
+#include "../Struct/VulkanDraw.hpp"
+#include "../Struct/VulkanPipelineRequest.hpp"
+#include "../Struct/VulkanSpecialization.hpp"
+#include "../Wrapper/VulkanClockCalibration.hpp"
+#include "../Wrapper/VulkanCommandPool.hpp"
+#include "../Wrapper/VulkanComputePipeline.hpp"
+#include "../Wrapper/VulkanDescriptorAllocator.hpp"
+#include "../Wrapper/VulkanDescriptorPool.hpp"
+#include "../Wrapper/VulkanDevice.hpp"
+#include "../Wrapper/VulkanPhysicalDevice.hpp"
+#include "../Wrapper/VulkanQueryPool.hpp"
+#include "../Wrapper/VulkanStorageBuffer.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <algorithm>	// std::min
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::uint32_t
+#include <memory>		// std::make_unique, std::unique_ptr
+#include <string>		// std::string, std::to_string
+#include <vector>		// std::vector
+
+namespace spacelite::Engine {
+
+	/*
+	 * DECLARATION
+	 */
+	class ParticleSystem {
+	public:
+		static constexpr std::uint32_t defaultNumberOfParticles = 1048576;
+
+		// shaders used (e.g. for preloading them)
+		static constexpr const char * simulationShader = "shd/bin/particles.comp.spv";
+		static constexpr const char * vertexShader = "shd/bin/particle.vert.spv";
+		static constexpr const char * fragmentShader = "shd/bin/default.frag.spv";
+
+		static std::vector<std::string> getShaderFiles();
+
+		// get the request for the pipeline drawing the particles (as points, using the simulated vertices)
+		static Struct::VulkanPipelineRequest getPipelineRequest();
+
+		ParticleSystem(
+				Wrapper::VulkanDevice& device,
+				Wrapper::VulkanPhysicalDevice& physicalDevice,
+				Wrapper::VulkanCommandPool& commandPool,
+				Wrapper::VulkanDescriptorAllocator& descriptorAllocator,
+				std::uint32_t numberOfParticles,
+				unsigned int numberOfFrames
+		);
+		virtual ~ParticleSystem();
+
+		// record the simulation of the particles for a frame into its command buffer (before drawing the particles)
+		void record(VkCommandBuffer commandBuffer, unsigned int frame);
+
+		// measure the last simulation recorded for a frame (which needs to be finished)
+		//  and add it to the trace (if enabled and the GPU timestamps can be converted)
+		void measure(unsigned int frame, const Wrapper::VulkanClockCalibration * calibration = nullptr);
+
+		// get the draw of the particles using the specified pipeline (created from the pipeline request)
+		Struct::VulkanDraw getDraw(std::size_t pipeline) const;
+
+		// getters
+		std::uint32_t getNumberOfParticles() const;
+		unsigned long getNumberOfMeasurements() const;
+		double getAverageTime() const;
+
+		// not copyable, not moveable
+		ParticleSystem(const ParticleSystem&) = delete;
+		ParticleSystem(ParticleSystem&&) = delete;
+		ParticleSystem& operator=(const ParticleSystem&) = delete;
+		ParticleSystem& operator=(ParticleSystem&&) = delete;
+
+	private:
+		static constexpr std::uint32_t groupSize = 256; // needs to match the local size of the compute shader
+		static constexpr std::uint32_t floatsPerVertex = 5; // needs to match the vertex format (position and color)
+		static constexpr float attraction = 0.5f;
+		static constexpr float damping = 0.1f;
+		static constexpr float maxTimeStep = 1.f / 30; // in s (e.g. after the window has not been drawn for a while)
+
+		// push constants of the compute shader
+		struct Simulation {
+			float timeStep;			// in s
+			std::uint32_t count;
+			std::uint32_t reset;	// non-zero: (re-)initialize all particles instead
+		};
+
+		std::uint32_t count;
+
+		Wrapper::VulkanStorageBuffer vertices;
+		Wrapper::VulkanStorageBuffer velocities;
+		Wrapper::VulkanComputePipeline pipeline;
+		Wrapper::VulkanDescriptorPool descriptorPool;
+		VkDescriptorSet set;
+
+		// timestamps of each frame (none if not supported) and whether they have been recorded since measuring them
+		std::vector<std::unique_ptr<Wrapper::VulkanQueryPool>> queries;
+		std::vector<bool> recorded;
+
+		// time since the last simulation and whether the particles have been initialized
+		Helper::TimerHighRes timer;
+		bool initialized;
+
+		// statistics (in nanoseconds)
+		unsigned long measurements;
+		double totalTime;
+
+		// check whether the particles can be simulated by a single dispatch
+		static std::uint32_t check(std::uint32_t numberOfParticles, const Wrapper::VulkanPhysicalDevice& physicalDevice);
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the buffers, the pipeline and the descriptor set
+	inline ParticleSystem::ParticleSystem(
+			Wrapper::VulkanDevice& device,
+			Wrapper::VulkanPhysicalDevice& physicalDevice,
+			Wrapper::VulkanCommandPool& commandPool,
+			Wrapper::VulkanDescriptorAllocator& descriptorAllocator,
+			std::uint32_t numberOfParticles,
+			unsigned int numberOfFrames
+	) :		count(ParticleSystem::check(numberOfParticles, physicalDevice)),
+			vertices(
+					device,
+					physicalDevice,
+					commandPool,
+					true, // only used on the graphics queue
+					static_cast<unsigned long>(numberOfParticles) * ParticleSystem::floatsPerVertex * sizeof(float),
+					VK_BUFFER_USAGE_VERTEX_BUFFER_BIT
+			),
+			velocities(
+					device,
+					physicalDevice,
+					commandPool,
+					true,
+					static_cast<unsigned long>(numberOfParticles) * 2 * sizeof(float)
+			),
+			pipeline(
+					device,
+					ParticleSystem::simulationShader,
+					Struct::VulkanSpecialization()
+							.set(0, ParticleSystem::attraction)
+							.set(1, ParticleSystem::damping)
+			),
+			descriptorPool(device, 1, std::vector<VkDescriptorPoolSize>{ { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2 } }),
+			set(VK_NULL_HANDLE),
+			recorded(numberOfFrames, false),
+			initialized(false),
+			measurements(0),
+			totalTime(0.) {
+		// descriptor set of the simulation
+		if(!(this->descriptorPool.allocate(this->pipeline.getSetLayout(0), this->set)))
+			throw Exception("Could not allocate descriptor set for the particle simulation");
+
+		Struct::VulkanDescriptorBinding verticesBinding;
+
+		verticesBinding.binding = 0;
+		verticesBinding.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		verticesBinding.buffer = this->vertices.getDescriptorInfo();
+
+		Struct::VulkanDescriptorBinding velocitiesBinding;
+
+		velocitiesBinding.binding = 1;
+		velocitiesBinding.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		velocitiesBinding.buffer = this->velocities.getDescriptorInfo();
+
+		descriptorAllocator.write(this->set, { verticesBinding, velocitiesBinding });
+
+		// timestamp queries
+		if(physicalDevice.getProperties().limits.timestampComputeAndGraphics == VK_TRUE)
+			for(unsigned int frame = 0; frame < numberOfFrames; ++frame)
+				this->queries.emplace_back(std::make_unique<Wrapper::VulkanQueryPool>(device, physicalDevice, 2));
+	}
+
+	// destructor stub
+	inline ParticleSystem::~ParticleSystem() {}
+
+	// record the simulation of the particles for a frame (initializing them the first time)
+	inline void ParticleSystem::record(VkCommandBuffer commandBuffer, unsigned int frame) {
+		Simulation simulation;
+
+		simulation.timeStep = std::min(
+				static_cast<float>(this->timer.since()) / 1000000.f,
+				ParticleSystem::maxTimeStep
+		);
+		simulation.count = this->count;
+		simulation.reset = this->initialized ? 0 : 1;
+
+		this->timer.reset();
+
+		if(!(this->queries.empty())) {
+			this->queries.at(frame)->reset(commandBuffer);
+			this->queries[frame]->write(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, 0);
+		}
+
+		// wait for the previous simulation (read and written again) and the previous draw (reading the vertices)
+		VkMemoryBarrier vulkanBarrier = {};
+
+		vulkanBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		vulkanBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		vulkanBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+		vkCmdPipelineBarrier(
+				commandBuffer,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				0,
+				1,
+				&vulkanBarrier,
+				0,
+				nullptr,
+				0,
+				nullptr
+		);
+
+		// simulate (one invocation per particle)
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, this->pipeline.get());
+		vkCmdBindDescriptorSets(
+				commandBuffer,
+				VK_PIPELINE_BIND_POINT_COMPUTE,
+				this->pipeline.getLayout(),
+				0,
+				1,
+				&(this->set),
+				0,
+				nullptr
+		);
+		vkCmdPushConstants(
+				commandBuffer,
+				this->pipeline.getLayout(),
+				VK_SHADER_STAGE_COMPUTE_BIT,
+				0,
+				sizeof(simulation),
+				&simulation
+		);
+		vkCmdDispatch(commandBuffer, (this->count + ParticleSystem::groupSize - 1) / ParticleSystem::groupSize, 1, 1);
+
+		// the vertices will be read by the draw of the particles
+		VkBufferMemoryBarrier vulkanBufferBarrier = {};
+
+		vulkanBufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		vulkanBufferBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		vulkanBufferBarrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+		vulkanBufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		vulkanBufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		vulkanBufferBarrier.buffer = this->vertices.get();
+		vulkanBufferBarrier.offset = 0;
+		vulkanBufferBarrier.size = VK_WHOLE_SIZE;
+
+		vkCmdPipelineBarrier(
+				commandBuffer,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+				0,
+				0,
+				nullptr,
+				1,
+				&vulkanBufferBarrier,
+				0,
+				nullptr
+		);
+
+		if(!(this->queries.empty())) {
+			this->queries[frame]->write(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 1);
+
+			this->recorded.at(frame) = true;
+		}
+
+		this->initialized = true;
+	}
+
+	// measure the last simulation recorded for a frame (ignored if timestamps are not supported or not available)
+	inline void ParticleSystem::measure(unsigned int frame, const Wrapper::VulkanClockCalibration * calibration) {
+		if(this->queries.empty() || !(this->recorded.at(frame)))
+			return;
+
+		std::vector<double> timestamps;
+
+		if(!(this->queries[frame]->getResults(0, 2, timestamps)))
+			return;
+
+		this->recorded[frame] = false;
+
+		if(timestamps[1] < timestamps[0])
+			return;
+
+		if(calibration && calibration->isAvailable() && Helper::Trace::isEnabled()) {
+			static const std::uint32_t graphicsTrack = Helper::Trace::getTrack("GPU (graphics queue)");
+
+			Helper::Trace::add(
+					"particle simulation",
+					calibration->toTraceTime(timestamps[0]),
+					calibration->toTraceTime(timestamps[1]),
+					graphicsTrack
+			);
+		}
+
+		this->totalTime += timestamps[1] - timestamps[0];
+
+		++(this->measurements);
+	}
+
+	// get the draw of the particles (one point per particle, using the vertices written by the simulation)
+	inline Struct::VulkanDraw ParticleSystem::getDraw(std::size_t pipeline) const {
+		Struct::VulkanDraw draw{ pipeline, 0, this->count };
+
+		draw.vertexBuffer = this->vertices.get();
+
+		return draw;
+	}
+
+	// get the files of the shaders used
+	inline std::vector<std::string> ParticleSystem::getShaderFiles() {
+		return {
+			ParticleSystem::simulationShader,
+			ParticleSystem::vertexShader,
+			ParticleSystem::fragmentShader
+		};
+	}
+
+	// get the request for the pipeline drawing the particles (as points without depth, in the order of the particles)
+	inline Struct::VulkanPipelineRequest ParticleSystem::getPipelineRequest() {
+		Struct::VulkanPipelineRequest request;
+
+		request.shaderFiles = { ParticleSystem::vertexShader, ParticleSystem::fragmentShader };
+
+		request.state.topology = VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
+		request.state.cullMode = VK_CULL_MODE_NONE;
+		request.state.depthTest = false;
+		request.state.depthWrite = false;
+
+		request.constants.fragmentShader.set(0, false); // grayscale
+
+		return request;
+	}
+
+	// get the number of particles
+	inline std::uint32_t ParticleSystem::getNumberOfParticles() const {
+		return this->count;
+	}
+
+	// get the number of measured simulations
+	inline unsigned long ParticleSystem::getNumberOfMeasurements() const {
+		return this->measurements;
+	}
+
+	// get the average GPU time of the simulation in milliseconds
+	inline double ParticleSystem::getAverageTime() const {
+		return this->measurements ? this->totalTime / this->measurements / 1000000. : 0.;
+	}
+
+	// check whether the particles can be simulated by a single dispatch (throws an exception otherwise)
+	inline std::uint32_t ParticleSystem::check(
+			std::uint32_t numberOfParticles,
+			const Wrapper::VulkanPhysicalDevice& physicalDevice
+	) {
+		const unsigned long long maxParticles =
+				static_cast<unsigned long long>(physicalDevice.getProperties().limits.maxComputeWorkGroupCount[0])
+				* ParticleSystem::groupSize;
+
+		if(!numberOfParticles)
+			throw Exception("No particles to simulate");
+
+		if(numberOfParticles > maxParticles)
+			throw Exception(
+					"Too many particles: "
+					+ std::to_string(numberOfParticles)
+					+ " (maximum: "
+					+ std::to_string(maxParticles)
+					+ ")"
+			);
+
+		return numberOfParticles;
+	}
+
+} /* spacelite::Engine */
+
+#endif /* SRC_ENGINE_PARTICLESYSTEM_HPP_ */
@@ -0,0 +1,998 @@
+/*
+ * RenderGraph.hpp
+ *
+ * Graph of the passes rendering a frame and the images they read and write.
+ *
+ * When compiled, the passes are sorted by their dependencies and passes that do not contribute to any output
+ *  (and have no side effects) are culled. The barriers and layout transitions needed between the passes
+ *  are computed once, while transient images whose lifetimes do not overlap share the same memory.
+ *
+ * Reading an image depends on the last pass declared before that writes it, or on the first pass declared
+ *  after that writes it (if there is none before), so that passes can be declared in any order.
+ *
+ * The graph can be exported as DOT (e.g. for Graphviz) and as JSON for inspection.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_ENGINE_RENDERGRAPH_HPP_
+#define SRC_ENGINE_RENDERGRAPH_HPP_
+
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Main/Exception.hpp"
+#include "../Struct/RenderGraphAccess.hpp"
+#include "../Struct/RenderGraphResource.hpp"
+#include "../Wrapper/VulkanDevice.hpp"
+#include "../Wrapper/VulkanDeviceMemory.hpp"
+#include "../Wrapper/VulkanError.hpp"
+#include "../Wrapper/VulkanImageView.hpp"
+#include "../Wrapper/VulkanPhysicalDevice.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <algorithm>	// std::max
+#include <cstddef>		// std::size_t
+#include <functional>	// std::function
+#include <limits>		// std::numeric_limits
+#include <memory>		// std::make_unique, std::unique_ptr
+#include <set>			// std::set
+#include <sstream>		// std::ostringstream
+#include <string>		// std::string, std::to_string
+#include <utility>		// std::pair
+#include <vector>		// std::vector
+
+namespace spacelite::Engine {
+
+	/*
+	 * DECLARATION
+	 */
+	class RenderGraph {
+	public:
+		using Callback = std::function<void(VkCommandBuffer)>;
+		using Usage = Struct::RenderGraphAccess::Usage;
+
+		static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+		RenderGraph(Wrapper::VulkanDevice& device, Wrapper::VulkanPhysicalDevice& physicalDevice);
+		virtual ~RenderGraph();
+
+		// declaration of resources and passes
+		std::size_t addResource(const Struct::RenderGraphResource& resource);
+		std::size_t addPass(const std::string& name, const Callback& callback, bool hasSideEffects = false);
+		void read(
+				std::size_t pass,
+				std::size_t resource,
+				Usage usage,
+				VkImageLayout layoutAfter = VK_IMAGE_LAYOUT_UNDEFINED
+		);
+		void write(
+				std::size_t pass,
+				std::size_t resource,
+				Usage usage,
+				VkImageLayout layoutAfter = VK_IMAGE_LAYOUT_UNDEFINED
+		);
+		void setOutput(std::size_t resource);
+
+		// compilation, execution and clearing
+		void compile();
+		void setImported(std::size_t resource, VkImage image, VkImageView imageView);
+		void execute(VkCommandBuffer commandBuffer) const;
+		void clear() noexcept;
+
+		// getters
+		VkImage getImage(std::size_t resource) const;
+		VkImageView getImageView(std::size_t resource) const;
+		bool isCulled(std::size_t pass) const;
+		std::size_t getNumberOfPasses() const;
+		std::size_t getNumberOfBarriers() const;
+		std::size_t getNumberOfMemoryBlocks() const;
+
+		// export for inspection
+		std::string toDot() const;
+		std::string toJson() const;
+
+		// not copyable, not moveable
+		RenderGraph(const RenderGraph&) = delete;
+		RenderGraph(RenderGraph&&) = delete;
+		RenderGraph& operator=(const RenderGraph&) = delete;
+		RenderGraph& operator=(RenderGraph&&) = delete;
+
+	private:
+		// declared pass
+		struct Pass {
+			std::string name;
+			Callback callback;
+			bool sideEffects = false;
+			std::vector<Struct::RenderGraphAccess> accesses;
+
+			// set when compiling
+			std::set<std::size_t> dependencies;	// passes whose results are used
+			std::set<std::size_t> predecessors;	// passes that need to be executed before (including dependencies)
+			bool culled = true;
+		};
+
+		// declared resource (with its image, if it has been created by the graph or imported)
+		struct Resource {
+			Struct::RenderGraphResource description;
+			bool output = false;
+
+			// set when compiling
+			VkImageUsageFlags usage = 0;
+			VkImage image = VK_NULL_HANDLE;
+			std::unique_ptr<Wrapper::VulkanImageView> view;
+			VkImageView importedView = VK_NULL_HANDLE;
+			std::size_t memory = RenderGraph::none;
+			std::size_t first = RenderGraph::none;
+			std::size_t last = RenderGraph::none;
+		};
+
+		// barrier recorded before a pass (or at the end of the graph)
+		struct Barrier {
+			std::size_t resource = 0;
+			VkImageLayout oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			VkImageLayout newLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			VkAccessFlags srcAccess = 0;
+			VkAccessFlags dstAccess = 0;
+		};
+
+		// execution step, i.e. a pass and the barriers recorded before it
+		struct Step {
+			std::size_t pass = RenderGraph::none;
+			VkPipelineStageFlags srcStages = 0;
+			VkPipelineStageFlags dstStages = 0;
+			VkAccessFlags srcMemoryAccess = 0;	// global memory barrier (for images transitioned by the pass)
+			VkAccessFlags dstMemoryAccess = 0;
+			std::vector<Barrier> barriers;
+
+			bool empty() const {
+				return this->barriers.empty() && !(this->srcMemoryAccess) && !(this->dstMemoryAccess)
+						&& !(this->srcStages);
+			}
+		};
+
+		Wrapper::VulkanDevice& device;
+		Wrapper::VulkanPhysicalDevice& physicalDevice;
+		std::vector<Pass> passes;
+		std::vector<Resource> resources;
+		std::vector<std::size_t> order;
+		std::vector<Step> steps;
+		std::vector<std::unique_ptr<Wrapper::VulkanDeviceMemory>> memories;
+		bool compiled;
+
+		// private helper functions
+		void access(std::size_t pass, std::size_t resource, Usage usage, bool isWrite, VkImageLayout layoutAfter);
+		void sort();
+		void cull();
+		void allocate();
+		void synchronize();
+		void recordBarriers(VkCommandBuffer commandBuffer, const Step& step) const;
+		void destroyImages() noexcept;
+
+		// static private helper functions
+		static VkAccessFlags getWriteAccess(VkAccessFlags access);
+		static std::string escape(const std::string& str);
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor stub
+	inline RenderGraph::RenderGraph(Wrapper::VulkanDevice& device, Wrapper::VulkanPhysicalDevice& physicalDevice)
+			: device(device), physicalDevice(physicalDevice), compiled(false) {}
+
+	// destructor: destroy the images created by the graph
+	inline RenderGraph::~RenderGraph() {
+		this->destroyImages();
+	}
+
+	// add a resource to the graph, return its ID
+	inline std::size_t RenderGraph::addResource(const Struct::RenderGraphResource& resource) {
+		this->compiled = false;
+
+		this->resources.emplace_back();
+
+		this->resources.back().description = resource;
+
+		return this->resources.size() - 1;
+	}
+
+	// add a pass to the graph, return its ID
+	//  NOTE:	Passes with side effects (e.g. writing to buffers) will never be culled.
+	inline std::size_t RenderGraph::addPass(const std::string& name, const Callback& callback, bool hasSideEffects) {
+		this->compiled = false;
+
+		this->passes.emplace_back();
+
+		this->passes.back().name = name;
+		this->passes.back().callback = callback;
+		this->passes.back().sideEffects = hasSideEffects;
+
+		return this->passes.size() - 1;
+	}
+
+	// declare that a pass reads a resource
+	//  (specify the layout after the pass if the pass transitions the image itself, e.g. using a render pass object)
+	inline void RenderGraph::read(std::size_t pass, std::size_t resource, Usage usage, VkImageLayout layoutAfter) {
+		this->access(pass, resource, usage, false, layoutAfter);
+	}
+
+	// declare that a pass writes a resource
+	//  (specify the layout after the pass if the pass transitions the image itself, e.g. using a render pass object)
+	inline void RenderGraph::write(std::size_t pass, std::size_t resource, Usage usage, VkImageLayout layoutAfter) {
+		this->access(pass, resource, usage, true, layoutAfter);
+	}
+
+	// declare a resource as output of the graph (passes not contributing to any output will be culled)
+	inline void RenderGraph::setOutput(std::size_t resource) {
+		this->compiled = false;
+
+		this->resources.at(resource).output = true;
+	}
+
+	// compile the graph: sort and cull the passes, create the transient images and compute the barriers
+	inline void RenderGraph::compile() {
+		this->destroyImages();
+
+		this->sort();
+		this->cull();
+		this->allocate();
+		this->synchronize();
+
+		this->compiled = true;
+	}
+
+	// set the image of an imported resource (needs to be done before every execution, if the image changes)
+	inline void RenderGraph::setImported(std::size_t resource, VkImage image, VkImageView imageView) {
+		Resource& target = this->resources.at(resource);
+
+		if(!target.description.imported)
+			throw Exception("Could not set image of render graph resource: \"" + target.description.name + "\" is not imported");
+
+		target.image = image;
+		target.importedView = imageView;
+	}
+
+	// record the graph into a command buffer (the command buffer needs to be recording)
+	inline void RenderGraph::execute(VkCommandBuffer commandBuffer) const {
+		if(!(this->compiled))
+			throw Exception("Could not execute render graph: not compiled");
+
+		for(const auto& step : this->steps) {
+			this->recordBarriers(commandBuffer, step);
+
+			if(step.pass != RenderGraph::none && this->passes[step.pass].callback)
+				this->passes[step.pass].callback(commandBuffer);
+		}
+	}
+
+	// remove all passes and resources from the graph (may not throw an exception as it is used by the destructor, too)
+	inline void RenderGraph::clear() noexcept {
+		this->destroyImages();
+
+		this->passes.clear();
+		this->resources.clear();
+		this->order.clear();
+		this->steps.clear();
+
+		this->compiled = false;
+	}
+
+	// get the image of a resource
+	inline VkImage RenderGraph::getImage(std::size_t resource) const {
+		return this->resources.at(resource).image;
+	}
+
+	// get the image view of a resource
+	inline VkImageView RenderGraph::getImageView(std::size_t resource) const {
+		const Resource& target = this->resources.at(resource);
+
+		if(target.description.imported)
+			return target.importedView;
+
+		return target.view ? target.view->get() : VK_NULL_HANDLE;
+	}
+
+	// check whether a pass has been culled (i.e. will not be executed)
+	inline bool RenderGraph::isCulled(std::size_t pass) const {
+		return this->passes.at(pass).culled;
+	}
+
+	// get the number of passes
+	inline std::size_t RenderGraph::getNumberOfPasses() const {
+		return this->passes.size();
+	}
+
+	// get the number of image barriers recorded for each execution
+	inline std::size_t RenderGraph::getNumberOfBarriers() const {
+		std::size_t result = 0;
+
+		for(const auto& step : this->steps)
+			result += step.barriers.size();
+
+		return result;
+	}
+
+	// get the number of memory blocks shared by the transient images
+	inline std::size_t RenderGraph::getNumberOfMemoryBlocks() const {
+		return this->memories.size();
+	}
+
+	// export the graph in DOT format (culled passes are dashed, edges are labelled with their usage)
+	inline std::string RenderGraph::toDot() const {
+		std::ostringstream out;
+
+		out << "digraph \"render graph\" {\n\trankdir=LR;\n";
+
+		for(std::size_t n = 0; n < this->resources.size(); ++n) {
+			const Resource& resource = this->resources[n];
+
+			out << "\tr" << n << " [shape=ellipse, label=\"" << RenderGraph::escape(resource.description.name);
+
+			if(resource.description.imported)
+				out << "\\n(imported)";
+			else if(resource.memory != RenderGraph::none)
+				out << "\\n(memory #" << resource.memory << ")";
+
+			out << "\"";
+
+			if(resource.output)
+				out << ", peripheries=2";
+
+			out << "];\n";
+		}
+
+		for(std::size_t n = 0; n < this->passes.size(); ++n) {
+			const Pass& pass = this->passes[n];
+
+			out << "\tp" << n << " [shape=box, label=\"" << RenderGraph::escape(pass.name) << "\"";
+
+			if(pass.culled)
+				out << ", style=dashed";
+
+			out << "];\n";
+
+			for(const auto& access : pass.accesses) {
+				if(access.write)
+					out << "\tp" << n << " -> r" << access.resource;
+				else
+					out << "\tr" << access.resource << " -> p" << n;
+
+				out << " [label=\"" << access.getUsageName() << "\"];\n";
+			}
+		}
+
+		out << "}\n";
+
+		return out.str();
+	}
+
+	// export the graph in JSON format (including the execution order, the barriers and the memory aliasing)
+	inline std::string RenderGraph::toJson() const {
+		std::ostringstream out;
+
+		out << "{\n\t\"passes\": [";
+
+		for(std::size_t n = 0; n < this->passes.size(); ++n) {
+			const Pass& pass = this->passes[n];
+
+			if(n)
+				out << ",";
+
+			out << "\n\t\t{ \"name\": \"" << RenderGraph::escape(pass.name) << "\", \"culled\": "
+				<< (pass.culled ? "true" : "false") << ", \"reads\": [";
+
+			bool first = true;
+
+			for(const auto& access : pass.accesses)
+				if(!access.write) {
+					out << (first ? "" : ", ") << access.resource;
+
+					first = false;
+				}
+
+			out << "], \"writes\": [";
+
+			first = true;
+
+			for(const auto& access : pass.accesses)
+				if(access.write) {
+					out << (first ? "" : ", ") << access.resource;
+
+					first = false;
+				}
+
+			out << "] }";
+		}
+
+		out << "\n\t],\n\t\"resources\": [";
+
+		for(std::size_t n = 0; n < this->resources.size(); ++n) {
+			const Resource& resource = this->resources[n];
+
+			if(n)
+				out << ",";
+
+			out << "\n\t\t{ \"name\": \"" << RenderGraph::escape(resource.description.name) << "\", \"imported\": "
+				<< (resource.description.imported ? "true" : "false") << ", \"output\": "
+				<< (resource.output ? "true" : "false") << ", \"memory\": ";
+
+			if(resource.memory == RenderGraph::none)
+				out << "null";
+			else
+				out << resource.memory;
+
+			out << " }";
+		}
+
+		out << "\n\t],\n\t\"order\": [";
+
+		for(std::size_t n = 0; n < this->order.size(); ++n)
+			out << (n ? ", " : "") << this->order[n];
+
+		out	<< "],\n\t\"barriers\": " << this->getNumberOfBarriers()
+			<< ",\n\t\"memoryBlocks\": " << this->memories.size() << "\n}\n";
+
+		return out.str();
+	}
+
+	// add an access of a pass to a resource
+	inline void RenderGraph::access(
+			std::size_t pass,
+			std::size_t resource,
+			Usage usage,
+			bool isWrite,
+			VkImageLayout layoutAfter
+	) {
+		if(resource >= this->resources.size())
+			throw Exception("Could not add access to render graph resource #" + std::to_string(resource) + ": not found");
+
+		Pass& target = this->passes.at(pass);
+
+		this->compiled = false;
+
+		// a pass may access each resource only once (reading and writing it with the same usage)
+		for(auto& existing : target.accesses)
+			if(existing.resource == resource) {
+				if(existing.usage != usage)
+					throw Exception(
+							"Could not add access to render graph resource \""
+							+ this->resources[resource].description.name
+							+ "\": already used differently by pass \""
+							+ target.name
+							+ "\""
+					);
+
+				existing.write = existing.write || isWrite;
+
+				if(layoutAfter != VK_IMAGE_LAYOUT_UNDEFINED)
+					existing.layoutAfter = layoutAfter;
+
+				return;
+			}
+
+		Struct::RenderGraphAccess newAccess;
+
+		newAccess.resource = resource;
+		newAccess.usage = usage;
+		newAccess.write = isWrite;
+		newAccess.layoutAfter = layoutAfter;
+
+		target.accesses.push_back(newAccess);
+	}
+
+	// sort the passes topologically (keeping the order of declaration where possible)
+	inline void RenderGraph::sort() {
+		std::vector<std::size_t> lastWriter(this->resources.size(), RenderGraph::none);
+		std::vector<std::vector<std::size_t>> readers(this->resources.size());		// readers since the last write
+		std::vector<std::vector<std::size_t>> earlyReaders(this->resources.size());	// readers before the first write
+
+		for(auto& pass : this->passes) {
+			pass.dependencies.clear();
+			pass.predecessors.clear();
+		}
+
+		const auto depend = [this](std::size_t pass, std::size_t on, bool isData) {
+			if(pass == on)
+				return;
+
+			this->passes[pass].predecessors.insert(on);
+
+			if(isData)
+				this->passes[pass].dependencies.insert(on);
+		};
+
+		for(std::size_t n = 0; n < this->passes.size(); ++n)
+			for(const auto& access : this->passes[n].accesses) {
+				const std::size_t r = access.resource;
+
+				if(access.write) {
+					// write after write (keeping the previous contents) and write after read
+					if(lastWriter[r] != RenderGraph::none)
+						depend(n, lastWriter[r], true);
+
+					for(const auto reader : readers[r])
+						depend(n, reader, false);
+
+					// readers declared before the first writer depend on it
+					if(lastWriter[r] == RenderGraph::none)
+						for(const auto reader : earlyReaders[r])
+							depend(reader, n, true);
+
+					lastWriter[r] = n;
+
+					readers[r].clear();
+				}
+				else if(lastWriter[r] != RenderGraph::none) {
+					// read after write
+					depend(n, lastWriter[r], true);
+
+					readers[r].push_back(n);
+				}
+				else
+					earlyReaders[r].push_back(n);
+			}
+
+		// sort (using the order of declaration for passes without dependencies between them)
+		std::vector<std::size_t> remaining(this->passes.size(), 0);
+		std::vector<std::vector<std::size_t>> successors(this->passes.size());
+		std::set<std::size_t> ready;
+
+		for(std::size_t n = 0; n < this->passes.size(); ++n) {
+			remaining[n] = this->passes[n].predecessors.size();
+
+			for(const auto predecessor : this->passes[n].predecessors)
+				successors[predecessor].push_back(n);
+
+			if(!remaining[n])
+				ready.insert(n);
+		}
+
+		this->order.clear();
+
+		while(!ready.empty()) {
+			const std::size_t next = *(ready.begin());
+
+			ready.erase(ready.begin());
+
+			this->order.push_back(next);
+
+			for(const auto successor : successors[next])
+				if(!(--remaining[successor]))
+					ready.insert(successor);
+		}
+
+		if(this->order.size() < this->passes.size())
+			throw Exception("Could not sort render graph: cyclic dependencies between its passes");
+	}
+
+	// cull the passes that do not contribute to any output of the graph (and have no side effects)
+	inline void RenderGraph::cull() {
+		std::vector<std::size_t> stack;
+
+		for(std::size_t n = 0; n < this->passes.size(); ++n) {
+			Pass& pass = this->passes[n];
+
+			pass.culled = !pass.sideEffects;
+
+			for(const auto& access : pass.accesses)
+				if(access.write && this->resources[access.resource].output)
+					pass.culled = false;
+
+			if(!pass.culled)
+				stack.push_back(n);
+		}
+
+		while(!stack.empty()) {
+			const std::size_t next = stack.back();
+
+			stack.pop_back();
+
+			for(const auto dependency : this->passes[next].dependencies)
+				if(this->passes[dependency].culled) {
+					this->passes[dependency].culled = false;
+
+					stack.push_back(dependency);
+				}
+		}
+
+		// remove the culled passes from the execution order
+		std::vector<std::size_t> alive;
+
+		for(const auto pass : this->order)
+			if(!(this->passes[pass].culled))
+				alive.push_back(pass);
+
+		this->order.swap(alive);
+	}
+
+	// create the transient images, letting images whose lifetimes do not overlap share the same memory
+	inline void RenderGraph::allocate() {
+		// get the lifetimes and usages of all resources
+		for(auto& resource : this->resources) {
+			resource.first = RenderGraph::none;
+			resource.last = RenderGraph::none;
+			resource.usage = 0;
+			resource.memory = RenderGraph::none;
+		}
+
+		for(std::size_t n = 0; n < this->order.size(); ++n)
+			for(const auto& access : this->passes[this->order[n]].accesses) {
+				Resource& resource = this->resources[access.resource];
+
+				if(resource.first == RenderGraph::none)
+					resource.first = n;
+
+				resource.last = n;
+				resource.usage |= access.getImageUsage();
+			}
+
+		// create the images (without memory)
+		struct Block {
+			VkDeviceSize size = 0;
+			unsigned int typeBits = 0;
+			std::vector<std::pair<std::size_t, std::size_t>> lifetimes;
+		};
+
+		std::vector<Block> blocks;
+
+		for(auto& resource : this->resources) {
+			if(resource.description.imported || resource.first == RenderGraph::none)
+				continue;
+
+			VkImageCreateInfo vulkanImageInfo = {};
+
+			vulkanImageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+			vulkanImageInfo.imageType = VK_IMAGE_TYPE_2D;
+			vulkanImageInfo.extent.width = resource.description.extent.width;
+			vulkanImageInfo.extent.height = resource.description.extent.height;
+			vulkanImageInfo.extent.depth = 1;
+			vulkanImageInfo.mipLevels = 1;
+			vulkanImageInfo.arrayLayers = 1;
+			vulkanImageInfo.format = resource.description.format;
+			vulkanImageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+			vulkanImageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			vulkanImageInfo.usage = resource.usage;
+			vulkanImageInfo.samples = resource.description.samples;
+			vulkanImageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+			VkResult vulkanResult = vkCreateImage(
+					this->device.get(),
+					&vulkanImageInfo,
+					Helper::VulkanAllocator::ptr,
+					&(resource.image)
+			);
+
+			if(vulkanResult != VK_SUCCESS)
+				throw Exception(
+						"Could not create image for render graph resource \""
+						+ resource.description.name
+						+ "\": "
+						+ Wrapper::VulkanError(vulkanResult).str()
+				);
+
+			// find a memory block that is compatible and not used during the lifetime of the image
+			VkMemoryRequirements vulkanMemRequirements;
+
+			vkGetImageMemoryRequirements(this->device.get(), resource.image, &vulkanMemRequirements);
+
+			for(std::size_t n = 0; n < blocks.size(); ++n) {
+				const unsigned int typeBits = blocks[n].typeBits & vulkanMemRequirements.memoryTypeBits;
+
+				if(!(this->physicalDevice.hasMemoryType(typeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)))
+					continue;
+
+				bool overlaps = false;
+
+				for(const auto& lifetime : blocks[n].lifetimes)
+					if(resource.first <= lifetime.second && lifetime.first <= resource.last) {
+						overlaps = true;
+
+						break;
+					}
+
+				if(overlaps)
+					continue;
+
+				resource.memory = n;
+
+				blocks[n].size = std::max(blocks[n].size, vulkanMemRequirements.size);
+				blocks[n].typeBits = typeBits;
+
+				break;
+			}
+
+			if(resource.memory == RenderGraph::none) {
+				resource.memory = blocks.size();
+
+				blocks.emplace_back();
+
+				blocks.back().size = vulkanMemRequirements.size;
+				blocks.back().typeBits = vulkanMemRequirements.memoryTypeBits;
+			}
+
+			blocks[resource.memory].lifetimes.emplace_back(resource.first, resource.last);
+		}
+
+		// allocate the memory blocks and bind the images to them
+		for(const auto& block : blocks) {
+			this->memories.emplace_back(std::make_unique<Wrapper::VulkanDeviceMemory>(this->device));
+
+			this->memories.back()->allocate(
+					block.size,
+					this->physicalDevice.findMemoryType(block.typeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+			);
+		}
+
+		for(auto& resource : this->resources) {
+			if(resource.memory == RenderGraph::none)
+				continue;
+
+			VkResult vulkanResult = vkBindImageMemory(
+					this->device.get(),
+					resource.image,
+					this->memories[resource.memory]->get(),
+					0
+			);
+
+			if(vulkanResult != VK_SUCCESS)
+				throw Exception(
+						"Could not bind memory to render graph resource \""
+						+ resource.description.name
+						+ "\": "
+						+ Wrapper::VulkanError(vulkanResult).str()
+				);
+
+			resource.view = std::make_unique<Wrapper::VulkanImageView>(
+					this->device,
+					resource.image,
+					resource.description.format,
+					resource.description.aspect
+			);
+		}
+	}
+
+	// compute the barriers and layout transitions needed before each pass (and at the end of the graph)
+	inline void RenderGraph::synchronize() {
+		// state of a resource (or a memory block) while executing the graph
+		struct State {
+			VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+			VkPipelineStageFlags stages = 0;	// stages that accessed the resource since the last barrier
+			VkAccessFlags writes = 0;			// writes not made available yet
+			bool used = false;
+		};
+
+		std::vector<State> states(this->resources.size());
+		std::vector<State> blockStates(this->memories.size());
+
+		for(std::size_t n = 0; n < this->resources.size(); ++n)
+			if(this->resources[n].description.imported)
+				states[n].layout = this->resources[n].description.initialLayout;
+
+		this->steps.clear();
+
+		for(const auto pass : this->order) {
+			Step step;
+
+			step.pass = pass;
+
+			for(const auto& access : this->passes[pass].accesses) {
+				State& state = states[access.resource];
+				const Resource& resource = this->resources[access.resource];
+
+				const VkPipelineStageFlags dstStages = access.getStages();
+				const VkAccessFlags dstAccess = access.getAccess();
+
+				// wait for the previous user of aliased memory before using the image for the first time
+				if(!state.used && resource.memory != RenderGraph::none && blockStates[resource.memory].used) {
+					step.srcStages |= blockStates[resource.memory].stages;
+					step.dstStages |= dstStages;
+					step.srcMemoryAccess |= blockStates[resource.memory].writes;
+					step.dstMemoryAccess |= dstAccess;
+				}
+
+				if(access.isSelfTransitioned()) {
+					// the pass transitions the image itself: only synchronize with previous accesses
+					if(state.used && (state.writes || access.write)) {
+						step.srcStages |= state.stages;
+						step.dstStages |= dstStages;
+						step.srcMemoryAccess |= state.writes;
+						step.dstMemoryAccess |= dstAccess;
+					}
+
+					state.layout = access.layoutAfter;
+				}
+				else {
+					const VkImageLayout newLayout = access.getLayout();
+
+					// the contents of transient images are undefined when they are used for the first time
+					const VkImageLayout oldLayout =
+							state.used || resource.description.imported ? state.layout : VK_IMAGE_LAYOUT_UNDEFINED;
+
+					if(oldLayout != newLayout || (state.used && (state.writes || access.write))) {
+						Barrier barrier;
+
+						barrier.resource = access.resource;
+						barrier.oldLayout = oldLayout;
+						barrier.newLayout = newLayout;
+						barrier.srcAccess = state.writes;
+						barrier.dstAccess = dstAccess;
+
+						// the first transition waits for the stages using the image, so that it happens after
+						//  semaphores waited for in these stages (e.g. for acquiring a swap chain image) have been signaled
+						step.srcStages |= state.used ? state.stages : dstStages;
+						step.dstStages |= dstStages;
+
+						step.barriers.push_back(barrier);
+					}
+					else {
+						// read after read in the same layout: no barrier needed, but later writes need to wait for both
+						state.stages |= dstStages;
+						state.used = true;
+
+						continue;
+					}
+
+					state.layout = newLayout;
+				}
+
+				state.stages = dstStages;
+				state.writes = access.write ? RenderGraph::getWriteAccess(dstAccess) : 0;
+				state.used = true;
+			}
+
+			// update the states of the memory blocks
+			for(const auto& access : this->passes[pass].accesses) {
+				const Resource& resource = this->resources[access.resource];
+
+				if(resource.memory == RenderGraph::none)
+					continue;
+
+				State& blockState = blockStates[resource.memory];
+
+				blockState.stages = states[access.resource].stages;
+				blockState.writes = states[access.resource].writes;
+				blockState.used = true;
+			}
+
+			this->steps.push_back(step);
+		}
+
+		// transition the imported images into their final layouts
+		Step finalStep;
+
+		for(std::size_t n = 0; n < this->resources.size(); ++n) {
+			const Resource& resource = this->resources[n];
+			const State& state = states[n];
+
+			if(
+					!resource.description.imported
+					|| resource.description.finalLayout == VK_IMAGE_LAYOUT_UNDEFINED
+					|| resource.description.finalLayout == state.layout
+			)
+				continue;
+
+			Barrier barrier;
+
+			barrier.resource = n;
+			barrier.oldLayout = state.layout;
+			barrier.newLayout = resource.description.finalLayout;
+			barrier.srcAccess = state.writes;
+			barrier.dstAccess = 0;
+
+			finalStep.srcStages |= state.used ? state.stages : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+			finalStep.dstStages |= VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+
+			finalStep.barriers.push_back(barrier);
+		}
+
+		if(!finalStep.empty())
+			this->steps.push_back(finalStep);
+	}
+
+	// record the barriers of a step (if any) into a command buffer
+	inline void RenderGraph::recordBarriers(VkCommandBuffer commandBuffer, const Step& step) const {
+		if(step.empty())
+			return;
+
+		std::vector<VkImageMemoryBarrier> vulkanBarriers;
+
+		vulkanBarriers.reserve(step.barriers.size());
+
+		for(const auto& barrier : step.barriers) {
+			const Resource& resource = this->resources[barrier.resource];
+
+			VkImageMemoryBarrier vulkanBarrier = {};
+
+			vulkanBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			vulkanBarrier.oldLayout = barrier.oldLayout;
+			vulkanBarrier.newLayout = barrier.newLayout;
+			vulkanBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			vulkanBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			vulkanBarrier.image = resource.image;
+			vulkanBarrier.subresourceRange.aspectMask = resource.description.aspect;
+			vulkanBarrier.subresourceRange.baseMipLevel = 0;
+			vulkanBarrier.subresourceRange.levelCount = 1;
+			vulkanBarrier.subresourceRange.baseArrayLayer = 0;
+			vulkanBarrier.subresourceRange.layerCount = 1;
+			vulkanBarrier.srcAccessMask = barrier.srcAccess;
+			vulkanBarrier.dstAccessMask = barrier.dstAccess;
+
+			vulkanBarriers.push_back(vulkanBarrier);
+		}
+
+		VkMemoryBarrier vulkanMemoryBarrier = {};
+
+		vulkanMemoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		vulkanMemoryBarrier.srcAccessMask = step.srcMemoryAccess;
+		vulkanMemoryBarrier.dstAccessMask = step.dstMemoryAccess;
+
+		const bool hasMemoryBarrier = step.srcMemoryAccess || step.dstMemoryAccess;
+
+		vkCmdPipelineBarrier(
+				commandBuffer,
+				step.srcStages ? step.srcStages : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT),
+				step.dstStages ? step.dstStages : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT),
+				0,
+				hasMemoryBarrier ? 1 : 0,
+				hasMemoryBarrier ? &vulkanMemoryBarrier : nullptr,
+				0,
+				nullptr,
+				static_cast<unsigned int>(vulkanBarriers.size()),
+				vulkanBarriers.data()
+		);
+	}
+
+	// destroy the images created by the graph and free their memory (may not throw an exception)
+	inline void RenderGraph::destroyImages() noexcept {
+		for(auto& resource : this->resources) {
+			resource.view.reset();
+
+			if(!resource.description.imported && resource.image) {
+				vkDestroyImage(this->device.get(), resource.image, Helper::VulkanAllocator::ptr);
+
+				resource.image = VK_NULL_HANDLE;
+			}
+
+			resource.memory = RenderGraph::none;
+		}
+
+		this->memories.clear();
+
+		this->compiled = false;
+	}
+
+	// static helper function to get the write accesses out of the specified memory accesses
+	inline VkAccessFlags RenderGraph::getWriteAccess(VkAccessFlags access) {
+		return access & (
+				VK_ACCESS_SHADER_WRITE_BIT
+				| VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+				| VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+				| VK_ACCESS_TRANSFER_WRITE_BIT
+				| VK_ACCESS_HOST_WRITE_BIT
+				| VK_ACCESS_MEMORY_WRITE_BIT
+		);
+	}
+
+	// static helper function to escape a string for DOT and JSON
+	inline std::string RenderGraph::escape(const std::string& str) {
+		std::string result;
+
+		result.reserve(str.size());
+
+		for(const auto c : str) {
+			if(c == '"' || c == '\\')
+				result.push_back('\\');
+
+			result.push_back(c);
+		}
+
+		return result;
+	}
+
+} /* spacelite::Engine */
+
+#endif /* SRC_ENGINE_RENDERGRAPH_HPP_ */
@@ -10,11 +10,20 @@
 #ifndef SRC_ENGINE_VERSION_HPP_
 #define SRC_ENGINE_VERSION_HPP_
 
+#include <vulkan/vulkan_core.h>
+
 #define ENGINE_NAME "vulkan-tutorial"
 #define ENGINE_VERSION_MAJOR 1
 #define ENGINE_VERSION_MINOR 0
 #define ENGINE_VERSION_PATCH 0
 
+// use the newest version of the Vulkan API known to the headers (devices may still support older versions only)
+#if defined(VK_API_VERSION_1_3)
+#define ENGINE_VULKAN_VERSION VK_API_VERSION_1_3
+#elif defined(VK_API_VERSION_1_2)
+#define ENGINE_VULKAN_VERSION VK_API_VERSION_1_2
+#else
 #define ENGINE_VULKAN_VERSION VK_API_VERSION_1_1
+#endif
 
 #endif /* SRC_ENGINE_VERSION_HPP_ */
@@ -10,25 +10,32 @@
 #ifndef SRC_HELPER_FILE_HPP_
 #define SRC_HELPER_FILE_HPP_
 
+#include "Log.hpp"
+
 #include "../Main/Exception.hpp"
 
-#include <fstream>	// std::ifstream
+#include <fstream>	// std::ifstream, std::ofstream
 #include <string>	// std::string
 #include <vector>	// std::vector
 
-#ifndef NDEBUG
-#include <iostream>	// std::cout, std::endl
-#endif
-
 namespace spacelite::Helper::File {
 
 	/*
 	 * DECLARATION
 	 */
 
+	// check whether a file exists (and can be read)
+	bool exists(const std::string& fileName);
+
 	// read binary file
 	std::vector<char> readBinary(const std::string& fileName);
 
+	// write binary file
+	void writeBinary(const std::string& fileName, const std::vector<char>& content);
+
+	// write text file
+	void writeText(const std::string& fileName, const std::string& content);
+
 	// exception class
 	MAIN_EXCEPTION_CLASS();
 
@@ -36,6 +43,11 @@ namespace spacelite::Helper::File {
 	 * IMPLEMENTATION
 	 */
 
+	// check whether a file exists (and can be read)
+	inline bool exists(const std::string& fileName) {
+		return std::ifstream(fileName).is_open();
+	}
+
 	// read binary file
 	inline std::vector<char> readBinary(const std::string& fileName) {
 		std::ifstream stream(fileName, std::ios::ate | std::ios::binary);
@@ -48,9 +60,9 @@ namespace spacelite::Helper::File {
 
 		std::vector<char> buffer(fileSize);
 
-		// write debug output to stdout (if necessary)
+		// log debug output (if necessary)
 #ifndef NDEBUG
-		std::cout << "> " << fileSize << " bytes from " << fileName << std::endl;
+		Log::info() << "> " << fileSize << " bytes from " << fileName;
 #endif
 
 		// read content and close file
@@ -62,6 +74,40 @@ namespace spacelite::Helper::File {
 		return buffer;
 	}
 
+	// write binary file (overwriting an existing file)
+	inline void writeBinary(const std::string& fileName, const std::vector<char>& content) {
+		std::ofstream stream(fileName, std::ios::trunc | std::ios::binary);
+
+		if(!stream.is_open())
+			throw Exception("Could not open file for writing: " + fileName);
+
+		stream.write(content.data(), content.size());
+
+		stream.close();
+
+		// log debug output (if necessary)
+#ifndef NDEBUG
+		Log::info() << "> " << content.size() << " bytes to " << fileName;
+#endif
+	}
+
+	// write text file (overwriting an existing file)
+	inline void writeText(const std::string& fileName, const std::string& content) {
+		std::ofstream stream(fileName, std::ios::trunc);
+
+		if(!stream.is_open())
+			throw Exception("Could not open file for writing: " + fileName);
+
+		stream << content;
+
+		stream.close();
+
+		// log debug output (if necessary)
+#ifndef NDEBUG
+		Log::info() << "> " << content.size() << " bytes to " << fileName;
+#endif
+	}
+
 } /* spacelite::Helper */
 
 
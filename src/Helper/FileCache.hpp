@@ -0,0 +1,83 @@
+/*
+ * FileCache.hpp
+ *
+ * Cache for binary files (e.g. shaders) that are read in the background before they are needed.
+ *
+ * Files that have not been preloaded are read when they are requested, without adding them to the cache.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_FILECACHE_HPP_
+#define SRC_HELPER_FILECACHE_HPP_
+
+#include "File.hpp"
+
+#include <memory>			// std::make_shared, std::shared_ptr
+#include <mutex>			// std::lock_guard, std::mutex
+#include <string>			// std::string
+#include <unordered_map>	// std::unordered_map
+#include <vector>			// std::vector
+
+namespace spacelite::Helper {
+
+	/*
+	 * DECLARATION
+	 */
+	class FileCache {
+	public:
+		// read a file into the cache
+		static void preload(const std::string& fileName);
+
+		// get the content of a file (from the cache, if it has been preloaded)
+		static std::shared_ptr<const std::vector<char>> get(const std::string& fileName);
+
+		// remove all files from the cache
+		static void clear();
+
+	private:
+		static std::mutex filesLock;
+		static std::unordered_map<std::string, std::shared_ptr<const std::vector<char>>> files;
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	inline std::mutex FileCache::filesLock;
+	inline std::unordered_map<std::string, std::shared_ptr<const std::vector<char>>> FileCache::files;
+
+	// read a file into the cache (without locking the cache while reading)
+	inline void FileCache::preload(const std::string& fileName) {
+		auto content = std::make_shared<const std::vector<char>>(File::readBinary(fileName));
+
+		std::lock_guard<std::mutex> lock(FileCache::filesLock);
+
+		FileCache::files[fileName] = content;
+	}
+
+	// get the content of a file (from the cache, if it has been preloaded, reading it otherwise)
+	inline std::shared_ptr<const std::vector<char>> FileCache::get(const std::string& fileName) {
+		{
+			std::lock_guard<std::mutex> lock(FileCache::filesLock);
+
+			const auto it = FileCache::files.find(fileName);
+
+			if(it != FileCache::files.end())
+				return it->second;
+		}
+
+		return std::make_shared<const std::vector<char>>(File::readBinary(fileName));
+	}
+
+	// remove all files from the cache (files still in use will be kept until they are not needed anymore)
+	inline void FileCache::clear() {
+		std::lock_guard<std::mutex> lock(FileCache::filesLock);
+
+		FileCache::files.clear();
+	}
+
+} /* spacelite::Helper */
+
+#endif /* SRC_HELPER_FILECACHE_HPP_ */
@@ -0,0 +1,171 @@
+/*
+ * FrameLimiter.hpp
+ *
+ * Limits the frame rate by waiting for a target frame time.
+ *
+ * The limiter sleeps coarsely until shortly before the end of the frame and spin-waits on a monotonic clock
+ *  for the rest. How much earlier it wakes up is adapted to the measured oversleeping of the system,
+ *  which is limited to a fraction of the frame time, so that a single stall (e.g. of the whole process)
+ *  does not keep the limiter spinning from then on.
+ *
+ * Deadlines are based on the previous deadline instead of the actual time, so that errors do not accumulate.
+ *  After missing a frame by more than the frame time (e.g. after idling), the limiter starts over.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_FRAMELIMITER_HPP_
+#define SRC_HELPER_FRAMELIMITER_HPP_
+
+#include "Statistics.hpp"
+
+#include <algorithm>	// std::max, std::min
+#include <chrono>		// std::chrono
+#include <cstddef>		// std::size_t
+#include <thread>		// std::this_thread
+#include <vector>		// std::vector
+
+namespace spacelite::Helper {
+
+	/*
+	 * DECLARATION
+	 */
+	class FrameLimiter {
+		using Clock = std::chrono::steady_clock;
+
+	public:
+		explicit FrameLimiter(double frameTime);
+
+		// wait until the current frame is over
+		void wait();
+
+		// start over with the next frame
+		void reset();
+
+		// getters
+		double getFrameTime() const;
+		std::size_t getNumberOfFrames() const;
+		double getJitter(double percentile) const;
+
+	private:
+		static constexpr std::size_t maxSamples = 1024;
+		static constexpr Clock::duration spinMargin = std::chrono::microseconds(200);
+		static constexpr Clock::duration initialOversleeping = std::chrono::milliseconds(1);
+		static constexpr int maxOversleepingDivisor = 4; // maximum oversleeping to adapt to, as fraction of the frame time
+		static constexpr int decayDivisor = 64;
+
+		Clock::duration frameTime;
+		Clock::duration maxOversleeping;
+		Clock::duration oversleeping;
+		Clock::time_point deadline;
+		bool started;
+
+		// how late the last frames were (in ms, as a ring buffer)
+		std::vector<double> samples;
+		std::size_t numberOfFrames;
+
+		// start over with the current frame
+		void restart(Clock::time_point now);
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: set the target frame time (in s, zero for no limit)
+	inline FrameLimiter::FrameLimiter(double frameTime)
+			:	frameTime(
+						std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(std::max(frameTime, 0.)))
+				),
+				maxOversleeping(this->frameTime / FrameLimiter::maxOversleepingDivisor),
+				oversleeping(std::min(FrameLimiter::initialOversleeping, this->maxOversleeping)),
+				started(false),
+				numberOfFrames(0) {
+		this->samples.reserve(FrameLimiter::maxSamples);
+	}
+
+	// wait until the current frame is over (returns immediately if there is no limit)
+	inline void FrameLimiter::wait() {
+		if(this->frameTime == Clock::duration::zero())
+			return;
+
+		Clock::time_point now = Clock::now();
+
+		// start over if this is the first frame or the last one has been missed by more than a frame
+		if(!(this->started) || now > this->deadline + this->frameTime) {
+			this->restart(now);
+
+			return;
+		}
+
+		// sleep coarsely, waking up early enough to compensate for oversleeping
+		const Clock::time_point sleepUntil = this->deadline - this->oversleeping - FrameLimiter::spinMargin;
+
+		if(now < sleepUntil) {
+			std::this_thread::sleep_until(sleepUntil);
+
+			now = Clock::now();
+
+			// adapt to the measured oversleeping (immediately if it increased, slowly if it decreased),
+			//  ignoring anything beyond the maximum (e.g. if the process has been stopped while sleeping)
+			const Clock::duration overslept = std::min(now - sleepUntil, this->maxOversleeping);
+
+			if(overslept > this->oversleeping)
+				this->oversleeping = overslept;
+			else
+				this->oversleeping -= (this->oversleeping - overslept) / FrameLimiter::decayDivisor;
+		}
+		else
+			// no time left to sleep: decay the estimate anyway, so that the limiter will sleep again eventually
+			this->oversleeping -= this->oversleeping / FrameLimiter::decayDivisor;
+
+		// spin-wait for the rest of the frame
+		while(now < this->deadline)
+			now = Clock::now();
+
+		// measure how late the frame is
+		const double late = std::chrono::duration<double, std::milli>(now - this->deadline).count();
+
+		if(this->samples.size() < FrameLimiter::maxSamples)
+			this->samples.push_back(late);
+		else
+			this->samples[this->numberOfFrames % FrameLimiter::maxSamples] = late;
+
+		++(this->numberOfFrames);
+
+		// set the deadline of the next frame
+		this->deadline += this->frameTime;
+	}
+
+	// start over with the next frame (e.g. after idling on purpose)
+	inline void FrameLimiter::reset() {
+		this->started = false;
+		this->oversleeping = std::min(FrameLimiter::initialOversleeping, this->maxOversleeping);
+	}
+
+	// start over with the current frame, forgetting about the oversleeping measured so far
+	inline void FrameLimiter::restart(Clock::time_point now) {
+		this->deadline = now + this->frameTime;
+		this->started = true;
+		this->oversleeping = std::min(FrameLimiter::initialOversleeping, this->maxOversleeping);
+	}
+
+	// get the target frame time (in s)
+	inline double FrameLimiter::getFrameTime() const {
+		return std::chrono::duration<double>(this->frameTime).count();
+	}
+
+	// get the number of frames that have been waited for
+	inline std::size_t FrameLimiter::getNumberOfFrames() const {
+		return this->numberOfFrames;
+	}
+
+	// get the percentile (between zero and one) of how late the last frames were (in ms)
+	inline double FrameLimiter::getJitter(double percentile) const {
+		return Statistics::percentile(this->samples, percentile);
+	}
+
+} /* spacelite::Helper */
+
+#endif /* SRC_HELPER_FRAMELIMITER_HPP_ */
@@ -0,0 +1,36 @@
+/*
+ * Hash.hpp
+ *
+ * Helper function for combining hashes.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_HASH_HPP_
+#define SRC_HELPER_HASH_HPP_
+
+#include <cstddef>		// std::size_t
+#include <functional>	// std::hash
+
+namespace spacelite::Helper::Hash {
+
+	/*
+	 * DECLARATION
+	 */
+
+	// combine a hash with the hash of another value
+	template<typename T> void combine(std::size_t& seed, const T& value);
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// combine a hash with the hash of another value
+	template<typename T> inline void combine(std::size_t& seed, const T& value) {
+		seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	}
+
+} /* spacelite::Helper::Hash */
+
+#endif /* SRC_HELPER_HASH_HPP_ */
@@ -0,0 +1,364 @@
+/*
+ * JsonReader.hpp
+ *
+ * Simple reader for JSON, flattening its numbers and strings into maps (e.g. for comparing reports).
+ *
+ * The keys of the maps are the paths to the values, separated by dots. Elements of arrays are identified by the
+ *  string in their "name" member, if they are objects having one, by their index otherwise. Booleans and null are
+ *  ignored, numbers are always read using the classic locale.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_JSONREADER_HPP_
+#define SRC_HELPER_JSONREADER_HPP_
+
+#include "../Main/Exception.hpp"
+
+#include <cctype>	// std::isspace
+#include <cstddef>	// std::size_t
+#include <locale>	// std::locale
+#include <map>		// std::map
+#include <sstream>	// std::istringstream
+#include <string>	// std::string, std::to_string
+
+namespace spacelite::Helper {
+
+	/*
+	 * DECLARATION
+	 */
+	class JsonReader {
+	public:
+		explicit JsonReader(const std::string& json);
+
+		// getters
+		const std::map<std::string, double>& getNumbers() const;
+		const std::map<std::string, std::string>& getStrings() const;
+
+	private:
+		std::map<std::string, double> numbers;
+		std::map<std::string, std::string> strings;
+
+		// parser state
+		std::string content;
+		std::size_t position;
+
+		void parseValue(
+				const std::string& path,
+				std::map<std::string, double>& numbersTo,
+				std::map<std::string, std::string>& stringsTo
+		);
+		void parseObject(
+				const std::string& path,
+				std::map<std::string, double>& numbersTo,
+				std::map<std::string, std::string>& stringsTo
+		);
+		void parseArray(
+				const std::string& path,
+				std::map<std::string, double>& numbersTo,
+				std::map<std::string, std::string>& stringsTo
+		);
+		std::string parseString();
+		double parseNumber();
+		void parseLiteral(const std::string& literal);
+
+		void skipWhitespace();
+		char peek();
+		void expect(char c);
+
+		static std::string join(const std::string& path, const std::string& key);
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: parse the JSON (throws an exception if it is invalid)
+	inline JsonReader::JsonReader(const std::string& json) : content(json), position(0) {
+		this->parseValue("", this->numbers, this->strings);
+
+		this->skipWhitespace();
+
+		if(this->position < this->content.size())
+			throw Exception("Could not read JSON: Unexpected content at position " + std::to_string(this->position));
+	}
+
+	// get all numbers by their paths
+	inline const std::map<std::string, double>& JsonReader::getNumbers() const {
+		return this->numbers;
+	}
+
+	// get all strings by their paths
+	inline const std::map<std::string, std::string>& JsonReader::getStrings() const {
+		return this->strings;
+	}
+
+	// parse any value
+	inline void JsonReader::parseValue(
+			const std::string& path,
+			std::map<std::string, double>& numbersTo,
+			std::map<std::string, std::string>& stringsTo
+	) {
+		switch(this->peek()) {
+		case '{':
+			this->parseObject(path, numbersTo, stringsTo);
+
+			break;
+
+		case '[':
+			this->parseArray(path, numbersTo, stringsTo);
+
+			break;
+
+		case '"':
+			stringsTo[path] = this->parseString();
+
+			break;
+
+		case 't':
+			this->parseLiteral("true");
+
+			break;
+
+		case 'f':
+			this->parseLiteral("false");
+
+			break;
+
+		case 'n':
+			this->parseLiteral("null");
+
+			break;
+
+		default:
+			numbersTo[path] = this->parseNumber();
+		}
+	}
+
+	// parse an object
+	inline void JsonReader::parseObject(
+			const std::string& path,
+			std::map<std::string, double>& numbersTo,
+			std::map<std::string, std::string>& stringsTo
+	) {
+		this->expect('{');
+
+		if(this->peek() == '}') {
+			++(this->position);
+
+			return;
+		}
+
+		while(true) {
+			this->skipWhitespace();
+
+			const std::string key(this->parseString());
+
+			this->expect(':');
+
+			this->parseValue(JsonReader::join(path, key), numbersTo, stringsTo);
+
+			if(this->peek() == '}') {
+				++(this->position);
+
+				return;
+			}
+
+			this->expect(',');
+		}
+	}
+
+	// parse an array (identifying its elements by their names, if available)
+	inline void JsonReader::parseArray(
+			const std::string& path,
+			std::map<std::string, double>& numbersTo,
+			std::map<std::string, std::string>& stringsTo
+	) {
+		this->expect('[');
+
+		if(this->peek() == ']') {
+			++(this->position);
+
+			return;
+		}
+
+		for(std::size_t index = 0; ; ++index) {
+			std::map<std::string, double> elementNumbers;
+			std::map<std::string, std::string> elementStrings;
+
+			this->parseValue("", elementNumbers, elementStrings);
+
+			const auto name = elementStrings.find("name");
+			const std::string elementPath(
+					JsonReader::join(
+							path,
+							name != elementStrings.end() && !(name->second.empty()) ? name->second : std::to_string(index)
+					)
+			);
+
+			for(const auto& number : elementNumbers)
+				numbersTo[JsonReader::join(elementPath, number.first)] = number.second;
+
+			for(const auto& string : elementStrings)
+				stringsTo[JsonReader::join(elementPath, string.first)] = string.second;
+
+			if(this->peek() == ']') {
+				++(this->position);
+
+				return;
+			}
+
+			this->expect(',');
+		}
+	}
+
+	// parse a string (replacing escaped characters outside of ASCII by question marks)
+	inline std::string JsonReader::parseString() {
+		this->expect('"');
+
+		std::string result;
+
+		while(this->position < this->content.size()) {
+			const char c = this->content[this->position++];
+
+			if(c == '"')
+				return result;
+
+			if(c != '\\') {
+				result += c;
+
+				continue;
+			}
+
+			if(this->position >= this->content.size())
+				break;
+
+			const char escaped = this->content[this->position++];
+
+			switch(escaped) {
+			case 'b':
+				result += '\b';
+
+				break;
+
+			case 'f':
+				result += '\f';
+
+				break;
+
+			case 'n':
+				result += '\n';
+
+				break;
+
+			case 'r':
+				result += '\r';
+
+				break;
+
+			case 't':
+				result += '\t';
+
+				break;
+
+			case 'u': {
+				if(
+						this->position + 4 > this->content.size()
+						|| this->content.substr(this->position, 4).find_first_not_of("0123456789abcdefABCDEF") != std::string::npos
+				)
+					throw Exception("Could not read JSON: Invalid escape sequence");
+
+				const unsigned long code = std::stoul(this->content.substr(this->position, 4), nullptr, 16);
+
+				this->position += 4;
+
+				result += code < 0x80 ? static_cast<char>(code) : '?';
+
+				break;
+			}
+
+			default:
+				result += escaped;
+			}
+		}
+
+		throw Exception("Could not read JSON: Unterminated string");
+	}
+
+	// parse a number
+	inline double JsonReader::parseNumber() {
+		const std::size_t end = this->content.find_first_not_of("+-0123456789.eE", this->position);
+		const std::string number(this->content.substr(this->position, end - this->position));
+
+		std::istringstream stream(number);
+		double result = 0.;
+
+		stream.imbue(std::locale::classic());
+
+		stream >> result;
+
+		if(number.empty() || stream.fail() || !stream.eof())
+			throw Exception("Could not read JSON: Invalid value at position " + std::to_string(this->position));
+
+		this->position += number.size();
+
+		return result;
+	}
+
+	// parse a literal (i.e. true, false or null)
+	inline void JsonReader::parseLiteral(const std::string& literal) {
+		if(this->content.compare(this->position, literal.size(), literal) != 0)
+			throw Exception("Could not read JSON: Invalid value at position " + std::to_string(this->position));
+
+		this->position += literal.size();
+	}
+
+	// skip whitespaces
+	inline void JsonReader::skipWhitespace() {
+		while(
+				this->position < this->content.size()
+				&& std::isspace(static_cast<unsigned char>(this->content[this->position]))
+		)
+			++(this->position);
+	}
+
+	// get the next character that is not a whitespace (without consuming it)
+	inline char JsonReader::peek() {
+		this->skipWhitespace();
+
+		if(this->position >= this->content.size())
+			throw Exception("Could not read JSON: Unexpected end");
+
+		return this->content[this->position];
+	}
+
+	// consume the next character that is not a whitespace, which needs to be the given one
+	inline void JsonReader::expect(char c) {
+		if(this->peek() != c)
+			throw Exception(
+					std::string("Could not read JSON: Expected '")
+					+ c
+					+ "' at position "
+					+ std::to_string(this->position)
+			);
+
+		++(this->position);
+	}
+
+	// append a key to a path
+	inline std::string JsonReader::join(const std::string& path, const std::string& key) {
+		if(path.empty())
+			return key;
+
+		if(key.empty())
+			return path;
+
+		return path + '.' + key;
+	}
+
+} /* spacelite::Helper */
+
+#endif /* SRC_HELPER_JSONREADER_HPP_ */
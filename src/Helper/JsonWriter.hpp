@@ -0,0 +1,239 @@
+/*
+ * JsonWriter.hpp
+ *
+ * Simple writer for (indented) JSON, e.g. for machine-readable reports.
+ *
+ * Keys are ignored for the elements of arrays. Numbers are always written using the classic locale,
+ *  non-finite numbers are written as null.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_JSONWRITER_HPP_
+#define SRC_HELPER_JSONWRITER_HPP_
+
+#include "../Main/Exception.hpp"
+
+#include <cmath>	// std::isfinite
+#include <cstdio>	// std::snprintf
+#include <iomanip>	// std::setprecision
+#include <locale>	// std::locale
+#include <sstream>	// std::ostringstream
+#include <string>	// std::string
+#include <vector>	// std::vector
+
+namespace spacelite::Helper {
+
+	/*
+	 * DECLARATION
+	 */
+	class JsonWriter {
+	public:
+		JsonWriter();
+
+		// nesting
+		void beginObject(const std::string& key = "");
+		void endObject();
+		void beginArray(const std::string& key = "");
+		void endArray();
+
+		// values
+		void add(const std::string& key, const std::string& value);
+		void add(const std::string& key, const char * value);
+		void add(const std::string& key, double value);
+		void add(const std::string& key, unsigned long long value);
+		void add(const std::string& key, bool value);
+
+		// get the written JSON (all objects and arrays need to be closed)
+		std::string str() const;
+
+		// escape a string for usage in JSON (without adding quotes)
+		static std::string escape(const std::string& string);
+
+	private:
+		std::string content;
+		std::vector<char> levels;	// closing brackets of the currently open objects and arrays
+		bool empty;					// the currently open object or array has no elements yet
+
+		void next(const std::string& key);
+		void end(char bracket);
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor stub
+	inline JsonWriter::JsonWriter() : empty(true) {}
+
+	// begin an object (with the given key, if inside another object)
+	inline void JsonWriter::beginObject(const std::string& key) {
+		this->next(key);
+
+		this->content += '{';
+
+		this->levels.push_back('}');
+
+		this->empty = true;
+	}
+
+	// end the current object
+	inline void JsonWriter::endObject() {
+		this->end('}');
+	}
+
+	// begin an array (with the given key, if inside an object)
+	inline void JsonWriter::beginArray(const std::string& key) {
+		this->next(key);
+
+		this->content += '[';
+
+		this->levels.push_back(']');
+
+		this->empty = true;
+	}
+
+	// end the current array
+	inline void JsonWriter::endArray() {
+		this->end(']');
+	}
+
+	// add a string
+	inline void JsonWriter::add(const std::string& key, const std::string& value) {
+		this->next(key);
+
+		this->content += '"' + JsonWriter::escape(value) + '"';
+	}
+
+	// add a string (needed to not convert string literals to booleans)
+	inline void JsonWriter::add(const std::string& key, const char * value) {
+		this->add(key, std::string(value));
+	}
+
+	// add a floating-point number
+	inline void JsonWriter::add(const std::string& key, double value) {
+		this->next(key);
+
+		if(!std::isfinite(value)) {
+			this->content += "null";
+
+			return;
+		}
+
+		std::ostringstream stream;
+
+		stream.imbue(std::locale::classic());
+
+		stream << std::setprecision(10) << value;
+
+		this->content += stream.str();
+	}
+
+	// add an integer
+	inline void JsonWriter::add(const std::string& key, unsigned long long value) {
+		this->next(key);
+
+		this->content += std::to_string(value);
+	}
+
+	// add a boolean
+	inline void JsonWriter::add(const std::string& key, bool value) {
+		this->next(key);
+
+		this->content += value ? "true" : "false";
+	}
+
+	// get the written JSON (all objects and arrays need to be closed)
+	inline std::string JsonWriter::str() const {
+		if(!(this->levels.empty()))
+			throw Exception("Could not get JSON: " + std::to_string(this->levels.size()) + " level(s) still open");
+
+		return this->content + '\n';
+	}
+
+	// escape a string for usage in JSON (without adding quotes)
+	inline std::string JsonWriter::escape(const std::string& string) {
+		std::string result;
+
+		result.reserve(string.size());
+
+		for(const char c : string)
+			switch(c) {
+			case '"':
+				result += "\\\"";
+
+				break;
+
+			case '\\':
+				result += "\\\\";
+
+				break;
+
+			case '\n':
+				result += "\\n";
+
+				break;
+
+			case '\r':
+				result += "\\r";
+
+				break;
+
+			case '\t':
+				result += "\\t";
+
+				break;
+
+			default:
+				if(static_cast<unsigned char>(c) < 0x20) {
+					char escaped[7] = {};
+
+					std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+
+					result += escaped;
+				}
+				else
+					result += c;
+			}
+
+		return result;
+	}
+
+	// prepare the next element (separated from the previous one, indented and with its key, if inside an object)
+	inline void JsonWriter::next(const std::string& key) {
+		if(!(this->levels.empty())) {
+			if(!(this->empty))
+				this->content += ',';
+
+			this->content += '\n' + std::string(this->levels.size(), '\t');
+
+			if(this->levels.back() == '}')
+				this->content += '"' + JsonWriter::escape(key) + "\": ";
+		}
+		else if(!(this->content.empty()))
+			throw Exception("Could not add JSON element: Only one top-level element allowed");
+
+		this->empty = false;
+	}
+
+	// end the current object or array
+	inline void JsonWriter::end(char bracket) {
+		if(this->levels.empty() || this->levels.back() != bracket)
+			throw Exception(std::string("Could not end JSON element: Unexpected '") + bracket + "'");
+
+		this->levels.pop_back();
+
+		if(!(this->empty))
+			this->content += '\n' + std::string(this->levels.size(), '\t');
+
+		this->content += bracket;
+
+		this->empty = false;
+	}
+
+} /* spacelite::Helper */
+
+#endif /* SRC_HELPER_JSONWRITER_HPP_ */
@@ -0,0 +1,383 @@
+/*
+ * Log.hpp
+ *
+ * Asynchronous logger, writing messages to stdout on a background thread.
+ *
+ * Messages are added to a fixed-size ring buffer without locking, so that logging does not block the calling thread,
+ *  e.g. while drawing a frame or inside a callback of the Vulkan API driver. Messages below the set severity
+ *  are ignored without formatting them.
+ *
+ * If the buffer is full, debug and informational messages are dropped, while warnings and errors wait for
+ *  the writer to free a slot, so that they are never lost. Dropped messages are counted by severity
+ *  and reported by the writer as soon as it catches up.
+ *
+ * Usage:	Helper::Log::info() << "Some value: " << value;
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_LOG_HPP_
+#define SRC_HELPER_LOG_HPP_
+
+#include "../Main/Exception.hpp"
+
+#include <array>	// std::array
+#include <atomic>	// std::atomic, std::memory_order_acquire, std::memory_order_relaxed, std::memory_order_release
+#include <chrono>	// std::chrono::milliseconds
+#include <cstddef>	// std::ptrdiff_t, std::size_t
+#include <iostream>	// std::cout, std::flush
+#include <memory>	// std::unique_ptr
+#include <sstream>	// std::ostringstream
+#include <string>	// std::string, std::to_string
+#include <thread>	// std::this_thread, std::thread
+#include <utility>	// std::move
+
+namespace spacelite::Helper {
+
+	/*
+	 * DECLARATION
+	 */
+	class Log {
+	public:
+		enum class Severity { debug, info, warning, error };
+
+		// message, added to the log when it is destroyed
+		class Message {
+		public:
+			explicit Message(Severity messageSeverity);
+			virtual ~Message();
+
+			template<typename T> Message& operator<<(const T& value);
+
+			// not copyable, not moveable
+			Message(const Message&) = delete;
+			Message& operator=(const Message&) = delete;
+
+		private:
+			Severity severity;
+			bool enabled;
+			std::ostringstream stream;
+		};
+
+		// create messages
+		static Message debug();
+		static Message info();
+		static Message warning();
+		static Message error();
+
+		// add a message to the log (returns false if it has been dropped, never for warnings and errors)
+		static bool write(Severity severity, std::string message);
+
+		// wait until all messages have been written
+		static void flush();
+
+		// set the minimum severity of messages to log
+		static void setLevel(Severity level);
+		static Severity getLevel();
+
+		// get the severity with the given name (i.e. debug, info, warning or error)
+		static Severity getSeverity(const std::string& name);
+
+		// destructor: write the remaining messages
+		virtual ~Log();
+
+		// not copyable, not moveable
+		Log(const Log&) = delete;
+		Log& operator=(const Log&) = delete;
+
+	private:
+		Log();
+
+		static Log& get();
+
+		static constexpr std::size_t bufferSize = 4096; // needs to be a power of two
+		static constexpr std::chrono::milliseconds writerInterval{2};
+		static constexpr std::size_t numberOfSeverities = 4;
+
+		struct Slot {
+			std::atomic<std::size_t> sequence{0};	// position of the message in the buffer (plus one, if written)
+			std::string message;
+		};
+
+		std::unique_ptr<Slot[]> slots;
+		std::atomic<std::size_t> enqueuePosition;	// next position to add a message to
+		std::size_t dequeuePosition;				// next position to write a message from (writer only)
+		std::atomic<std::size_t> written;			// number of written messages
+		std::array<std::atomic<std::size_t>, Log::numberOfSeverities> dropped; // number of dropped messages by severity
+		std::array<std::size_t, Log::numberOfSeverities> reported; // number of dropped messages reported (writer only)
+		std::atomic<Severity> level;
+		std::atomic<bool> stopping;
+		std::thread writer;
+
+		bool push(std::string&& message);
+		bool pop(std::string& messageTo);
+		void run();
+		void report(std::string& batchTo);
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: start a message (ignored if its severity is below the level of the log)
+	inline Log::Message::Message(Severity messageSeverity)
+			: severity(messageSeverity), enabled(messageSeverity >= Log::getLevel()) {
+		if(this->enabled)
+			this->stream.imbue(std::cout.getloc());
+	}
+
+	// destructor: add the message to the log
+	inline Log::Message::~Message() {
+		if(this->enabled)
+			Log::write(this->severity, this->stream.str());
+	}
+
+	// append a value to the message
+	template<typename T> inline Log::Message& Log::Message::operator<<(const T& value) {
+		if(this->enabled)
+			this->stream << value;
+
+		return *this;
+	}
+
+	// create a message for debugging
+	inline Log::Message Log::debug() {
+		return Message(Severity::debug);
+	}
+
+	// create an informational message
+	inline Log::Message Log::info() {
+		return Message(Severity::info);
+	}
+
+	// create a warning
+	inline Log::Message Log::warning() {
+		return Message(Severity::warning);
+	}
+
+	// create an error message
+	inline Log::Message Log::error() {
+		return Message(Severity::error);
+	}
+
+	// add a message to the log (returns false if it has been dropped, because the buffer is full)
+	//  NOTE:	Warnings and errors are never dropped, but wait for the writer to free a slot instead.
+	inline bool Log::write(Severity severity, std::string message) {
+		Log& log = Log::get();
+
+		if(severity < log.level.load(std::memory_order_relaxed))
+			return true;
+
+		if(log.push(std::move(message)))
+			return true;
+
+		if(severity >= Severity::warning)
+			// wait for the writer (unless it has already been stopped)
+			while(!(log.stopping.load(std::memory_order_acquire))) {
+				std::this_thread::yield();
+
+				if(log.push(std::move(message)))
+					return true;
+			}
+
+		log.dropped[static_cast<std::size_t>(severity)].fetch_add(1, std::memory_order_relaxed);
+
+		return false;
+	}
+
+	// wait until all messages that have been added so far have been written
+	inline void Log::flush() {
+		Log& log = Log::get();
+
+		const std::size_t target = log.enqueuePosition.load(std::memory_order_relaxed);
+
+		while(log.written.load(std::memory_order_acquire) < target)
+			std::this_thread::sleep_for(Log::writerInterval);
+	}
+
+	// set the minimum severity of messages to log
+	inline void Log::setLevel(Severity level) {
+		Log::get().level.store(level, std::memory_order_relaxed);
+	}
+
+	// get the minimum severity of messages to log
+	inline Log::Severity Log::getLevel() {
+		return Log::get().level.load(std::memory_order_relaxed);
+	}
+
+	// get the severity with the given name (throws an exception if it does not exist)
+	inline Log::Severity Log::getSeverity(const std::string& name) {
+		if(name == "debug")
+			return Severity::debug;
+
+		if(name == "info")
+			return Severity::info;
+
+		if(name == "warning")
+			return Severity::warning;
+
+		if(name == "error")
+			return Severity::error;
+
+		throw Exception("Unknown log level: " + name);
+	}
+
+	// constructor: create the buffer and start the writer
+	inline Log::Log()
+			:	slots(new Slot[Log::bufferSize]),
+				enqueuePosition(0),
+				dequeuePosition(0),
+				written(0),
+				reported{},
+				level(Severity::info),
+				stopping(false) {
+		for(std::size_t n = 0; n < Log::bufferSize; ++n)
+			this->slots[n].sequence.store(n, std::memory_order_relaxed);
+
+		for(auto& counter : this->dropped)
+			counter.store(0, std::memory_order_relaxed);
+
+		this->writer = std::thread(&Log::run, this);
+	}
+
+	// destructor: stop the writer after it has written the remaining messages
+	inline Log::~Log() {
+		this->stopping.store(true, std::memory_order_release);
+
+		if(this->writer.joinable())
+			this->writer.join();
+
+		// report messages that have been dropped after the writer stopped
+		std::string batch;
+
+		this->report(batch);
+
+		std::cout << batch << std::flush;
+	}
+
+	// get the log (starting it on first use)
+	inline Log& Log::get() {
+		static Log instance;
+
+		return instance;
+	}
+
+	// add a message to the buffer (returns false if it is full)
+	inline bool Log::push(std::string&& message) {
+		std::size_t position = this->enqueuePosition.load(std::memory_order_relaxed);
+		Slot * slot = nullptr;
+
+		while(true) {
+			slot = &(this->slots[position & (Log::bufferSize - 1)]);
+
+			const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t difference =
+					static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+			if(difference == 0) {
+				// the slot is free: try to claim it
+				if(
+						this->enqueuePosition.compare_exchange_weak(
+								position,
+								position + 1,
+								std::memory_order_relaxed
+						)
+				)
+					break;
+			}
+			else if(difference < 0)
+				return false; // the buffer is full
+			else
+				position = this->enqueuePosition.load(std::memory_order_relaxed); // the slot has been claimed already
+		}
+
+		slot->message = std::move(message);
+
+		// publish the message to the writer
+		slot->sequence.store(position + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	// take the next message from the buffer (returns false if there is none)
+	inline bool Log::pop(std::string& messageTo) {
+		Slot& slot = this->slots[this->dequeuePosition & (Log::bufferSize - 1)];
+
+		if(slot.sequence.load(std::memory_order_acquire) != this->dequeuePosition + 1)
+			return false;
+
+		messageTo = std::move(slot.message);
+
+		slot.message.clear();
+
+		// release the slot for the next round through the buffer
+		slot.sequence.store(this->dequeuePosition + Log::bufferSize, std::memory_order_release);
+
+		++(this->dequeuePosition);
+
+		return true;
+	}
+
+	// write messages in batches until the log is stopped and all messages have been written
+	inline void Log::run() {
+		std::string message;
+		std::string batch;
+
+		while(true) {
+			std::size_t numberOfMessages = 0;
+
+			while(this->pop(message)) {
+				batch += message;
+				batch += '\n';
+
+				++numberOfMessages;
+			}
+
+			if(numberOfMessages) {
+				this->report(batch);
+
+				std::cout << batch << std::flush;
+
+				batch.clear();
+
+				this->written.fetch_add(numberOfMessages, std::memory_order_release);
+			}
+			else if(this->stopping.load(std::memory_order_acquire))
+				break;
+			else
+				std::this_thread::sleep_for(Log::writerInterval);
+		}
+	}
+
+	// add a note about messages that have been dropped since the last one (if any) to a batch of messages
+	inline void Log::report(std::string& batchTo) {
+		static constexpr std::array<const char *, Log::numberOfSeverities> names{ "debug", "info", "warning", "error" };
+
+		std::string counts;
+
+		for(std::size_t n = 0; n < Log::numberOfSeverities; ++n) {
+			const std::size_t total = this->dropped[n].load(std::memory_order_relaxed);
+
+			if(total == this->reported[n])
+				continue;
+
+			if(!counts.empty())
+				counts += ", ";
+
+			counts += std::to_string(total - this->reported[n]);
+			counts += ' ';
+			counts += names[n];
+
+			this->reported[n] = total;
+		}
+
+		if(!counts.empty())
+			batchTo += "(log messages dropped: " + counts + ")\n";
+	}
+
+} /* spacelite::Helper */
+
+#endif /* SRC_HELPER_LOG_HPP_ */
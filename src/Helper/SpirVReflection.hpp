@@ -0,0 +1,618 @@
+/*
+ * SpirVReflection.hpp
+ *
+ * Parses SPIR-V code to reflect the descriptor bindings, push constants and vertex inputs of a shader module.
+ *
+ * Only the parts of the SPIR-V specification that are needed for creating pipeline layouts are supported.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_SPIRVREFLECTION_HPP_
+#define SRC_HELPER_SPIRVREFLECTION_HPP_
+
+#include "../Main/Exception.hpp"
+#include "../Struct/ShaderReflection.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <algorithm>		// std::max, std::min
+#include <cstddef>			// std::size_t
+#include <cstdint>			// std::uint32_t
+#include <cstring>			// std::memcpy
+#include <limits>			// std::numeric_limits
+#include <map>				// std::map
+#include <string>			// std::to_string
+#include <unordered_map>	// std::unordered_map
+#include <utility>			// std::pair
+#include <vector>			// std::vector
+
+namespace spacelite::Helper {
+
+	/*
+	 * DECLARATION
+	 */
+	class SpirVReflection {
+	public:
+		explicit SpirVReflection(const std::vector<char>& code);
+
+		// getter
+		const Struct::ShaderReflection& get() const;
+
+	private:
+		// decorations of an ID or of a member of a structure
+		struct Decorations {
+			bool hasLocation = false;
+			bool hasBinding = false;
+			bool hasSet = false;
+			bool hasOffset = false;
+			bool isBuiltIn = false;
+			bool isBufferBlock = false;
+
+			std::uint32_t location = 0;
+			std::uint32_t binding = 0;
+			std::uint32_t set = 0;
+			std::uint32_t offset = 0;
+			std::uint32_t arrayStride = 0;
+			std::uint32_t matrixStride = 0;
+		};
+
+		// SPIR-V constants (see the SPIR-V specification)
+		enum : std::uint32_t {
+			magicNumber = 0x07230203,
+
+			opEntryPoint = 15,
+			opTypeVoid = 19,
+			opTypeBool = 20,
+			opTypeInt = 21,
+			opTypeFloat = 22,
+			opTypeVector = 23,
+			opTypeMatrix = 24,
+			opTypeImage = 25,
+			opTypeSampler = 26,
+			opTypeSampledImage = 27,
+			opTypeArray = 28,
+			opTypeRuntimeArray = 29,
+			opTypeStruct = 30,
+			opTypePointer = 32,
+			opConstant = 43,
+			opSpecConstant = 50,
+			opVariable = 59,
+			opDecorate = 71,
+			opMemberDecorate = 72,
+
+			decorationBlock = 2,
+			decorationBufferBlock = 3,
+			decorationArrayStride = 6,
+			decorationMatrixStride = 7,
+			decorationBuiltIn = 11,
+			decorationLocation = 30,
+			decorationBinding = 33,
+			decorationDescriptorSet = 34,
+			decorationOffset = 35,
+
+			storageUniformConstant = 0,
+			storageInput = 1,
+			storageUniform = 2,
+			storagePushConstant = 9,
+			storageStorageBuffer = 12,
+
+			dimBuffer = 5,
+			dimSubpassData = 6
+		};
+
+		void parse();
+		void reflectVariable(std::size_t index);
+
+		std::uint32_t word(std::size_t index) const;
+		std::size_t definition(std::uint32_t id) const;
+		std::uint32_t opcode(std::size_t index) const;
+		const Decorations& getDecorations(std::uint32_t id) const;
+		const Decorations& getMemberDecorations(std::uint32_t id, std::uint32_t member) const;
+
+		std::uint32_t getConstant(std::uint32_t id) const;
+		std::uint32_t getSize(std::uint32_t typeId) const;
+		VkDescriptorType getDescriptorType(std::uint32_t typeId, std::uint32_t storageClass) const;
+		VkFormat getFormat(std::uint32_t typeId) const;
+
+		std::vector<std::uint32_t> words;
+		std::unordered_map<std::uint32_t, std::size_t> definitions;
+		std::unordered_map<std::uint32_t, Decorations> decorations;
+		std::map<std::pair<std::uint32_t, std::uint32_t>, Decorations> memberDecorations;
+		std::vector<std::size_t> variables;
+		bool hasEntryPoint;
+
+		Struct::ShaderReflection result;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: parse the SPIR-V code
+	inline SpirVReflection::SpirVReflection(const std::vector<char>& code) : hasEntryPoint(false) {
+		if(code.size() < 5 * sizeof(std::uint32_t) || code.size() % sizeof(std::uint32_t))
+			throw Exception("Invalid SPIR-V code size: " + std::to_string(code.size()) + " bytes");
+
+		this->words.resize(code.size() / sizeof(std::uint32_t));
+
+		std::memcpy(this->words.data(), code.data(), code.size());
+
+		if(this->words[0] != SpirVReflection::magicNumber)
+			throw Exception("Invalid SPIR-V code: Magic number does not match");
+
+		this->parse();
+	}
+
+	// get the result of the reflection
+	inline const Struct::ShaderReflection& SpirVReflection::get() const {
+		return this->result;
+	}
+
+	// parse the instructions
+	inline void SpirVReflection::parse() {
+		std::size_t index = 5; // skip header
+
+		while(index < this->words.size()) {
+			const std::uint32_t wordCount = this->words[index] >> 16;
+
+			if(!wordCount || index + wordCount > this->words.size())
+				throw Exception("Invalid SPIR-V code: Corrupt instruction at word #" + std::to_string(index));
+
+			switch(this->opcode(index)) {
+			case SpirVReflection::opEntryPoint:
+				if(!(this->hasEntryPoint)) {
+					switch(this->word(index + 1)) {
+					case 0:
+						this->result.stage = VK_SHADER_STAGE_VERTEX_BIT;
+
+						break;
+
+					case 1:
+						this->result.stage = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+
+						break;
+
+					case 2:
+						this->result.stage = VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+
+						break;
+
+					case 3:
+						this->result.stage = VK_SHADER_STAGE_GEOMETRY_BIT;
+
+						break;
+
+					case 4:
+						this->result.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+						break;
+
+					case 5:
+						this->result.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+
+						break;
+
+					default:
+						throw Exception(
+								"Unsupported SPIR-V execution model: " + std::to_string(this->word(index + 1))
+						);
+					}
+
+					this->hasEntryPoint = true;
+				}
+
+				break;
+
+			case SpirVReflection::opTypeVoid:
+			case SpirVReflection::opTypeBool:
+			case SpirVReflection::opTypeInt:
+			case SpirVReflection::opTypeFloat:
+			case SpirVReflection::opTypeVector:
+			case SpirVReflection::opTypeMatrix:
+			case SpirVReflection::opTypeImage:
+			case SpirVReflection::opTypeSampler:
+			case SpirVReflection::opTypeSampledImage:
+			case SpirVReflection::opTypeArray:
+			case SpirVReflection::opTypeRuntimeArray:
+			case SpirVReflection::opTypeStruct:
+			case SpirVReflection::opTypePointer:
+				this->definitions[this->word(index + 1)] = index;
+
+				break;
+
+			case SpirVReflection::opConstant:
+			case SpirVReflection::opSpecConstant:
+				this->definitions[this->word(index + 2)] = index;
+
+				break;
+
+			case SpirVReflection::opVariable:
+				this->definitions[this->word(index + 2)] = index;
+
+				this->variables.push_back(index);
+
+				break;
+
+			case SpirVReflection::opDecorate:
+			case SpirVReflection::opMemberDecorate:
+				{
+					const bool isMember = this->opcode(index) == SpirVReflection::opMemberDecorate;
+					const std::size_t offset = isMember ? 1 : 0;
+					const std::uint32_t target = this->word(index + 1);
+
+					Decorations& targetDecorations =
+							isMember ?
+							this->memberDecorations[std::make_pair(target, this->word(index + 2))]
+							: this->decorations[target];
+
+					const std::uint32_t decoration = this->word(index + offset + 2);
+					const std::uint32_t value = wordCount > offset + 3 ? this->word(index + offset + 3) : 0;
+
+					switch(decoration) {
+					case SpirVReflection::decorationBufferBlock:
+						targetDecorations.isBufferBlock = true;
+
+						break;
+
+					case SpirVReflection::decorationArrayStride:
+						targetDecorations.arrayStride = value;
+
+						break;
+
+					case SpirVReflection::decorationMatrixStride:
+						targetDecorations.matrixStride = value;
+
+						break;
+
+					case SpirVReflection::decorationBuiltIn:
+						targetDecorations.isBuiltIn = true;
+
+						break;
+
+					case SpirVReflection::decorationLocation:
+						targetDecorations.hasLocation = true;
+						targetDecorations.location = value;
+
+						break;
+
+					case SpirVReflection::decorationBinding:
+						targetDecorations.hasBinding = true;
+						targetDecorations.binding = value;
+
+						break;
+
+					case SpirVReflection::decorationDescriptorSet:
+						targetDecorations.hasSet = true;
+						targetDecorations.set = value;
+
+						break;
+
+					case SpirVReflection::decorationOffset:
+						targetDecorations.hasOffset = true;
+						targetDecorations.offset = value;
+
+						break;
+
+					default:
+						break;
+					}
+				}
+
+				break;
+
+			default:
+				break;
+			}
+
+			index += wordCount;
+		}
+
+		if(!(this->hasEntryPoint))
+			throw Exception("Invalid SPIR-V code: No entry point");
+
+		// reflect the variables (after all types and decorations are known)
+		for(const auto variable : this->variables)
+			this->reflectVariable(variable);
+	}
+
+	// reflect a variable
+	inline void SpirVReflection::reflectVariable(std::size_t index) {
+		const std::uint32_t id = this->word(index + 2);
+		const std::uint32_t storageClass = this->word(index + 3);
+		const Decorations& variableDecorations = this->getDecorations(id);
+
+		// get the type the variable points to
+		const std::size_t pointer = this->definition(this->word(index + 1));
+
+		if(this->opcode(pointer) != SpirVReflection::opTypePointer)
+			throw Exception("Invalid SPIR-V code: Variable #" + std::to_string(id) + " is not a pointer");
+
+		const std::uint32_t typeId = this->word(pointer + 3);
+
+		switch(storageClass) {
+		case SpirVReflection::storageInput:
+			// vertex inputs (ignoring built-in variables)
+			if(
+					this->result.stage == VK_SHADER_STAGE_VERTEX_BIT
+					&& !variableDecorations.isBuiltIn
+					&& variableDecorations.hasLocation
+			)
+				this->result.vertexInputs.push_back({ variableDecorations.location, this->getFormat(typeId) });
+
+			break;
+
+		case SpirVReflection::storageUniformConstant:
+		case SpirVReflection::storageUniform:
+		case SpirVReflection::storageStorageBuffer:
+			// descriptors
+			if(variableDecorations.hasSet && variableDecorations.hasBinding) {
+				std::uint32_t count = 1;
+				std::uint32_t elementTypeId = typeId;
+
+				if(this->opcode(this->definition(typeId)) == SpirVReflection::opTypeArray) {
+					elementTypeId = this->word(this->definition(typeId) + 2);
+					count = this->getConstant(this->word(this->definition(typeId) + 3));
+				}
+				else if(this->opcode(this->definition(typeId)) == SpirVReflection::opTypeRuntimeArray)
+					elementTypeId = this->word(this->definition(typeId) + 2);
+
+				this->result.descriptorBindings.push_back({
+					variableDecorations.set,
+					variableDecorations.binding,
+					this->getDescriptorType(elementTypeId, storageClass),
+					count
+				});
+			}
+
+			break;
+
+		case SpirVReflection::storagePushConstant:
+			// push constants (the range starts at the first used offset)
+			{
+				const std::size_t type = this->definition(typeId);
+
+				if(this->opcode(type) != SpirVReflection::opTypeStruct)
+					throw Exception("Invalid SPIR-V code: Push constant block #" + std::to_string(id) + " is no structure");
+
+				std::uint32_t first = std::numeric_limits<std::uint32_t>::max();
+
+				for(std::uint32_t member = 0; member + 2 < (this->words[type] >> 16); ++member)
+					first = std::min(first, this->getMemberDecorations(typeId, member).offset);
+
+				if(first == std::numeric_limits<std::uint32_t>::max())
+					first = 0;
+
+				VkPushConstantRange vulkanRange = {};
+
+				vulkanRange.stageFlags = this->result.stage;
+				vulkanRange.offset = first;
+				vulkanRange.size = this->getSize(typeId) - first;
+
+				this->result.pushConstantRanges.push_back(vulkanRange);
+			}
+
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	// get a word of the code (checking the index)
+	inline std::uint32_t SpirVReflection::word(std::size_t index) const {
+		if(index >= this->words.size())
+			throw Exception("Invalid SPIR-V code: Unexpected end of code");
+
+		return this->words[index];
+	}
+
+	// get the index of the instruction defining an ID
+	inline std::size_t SpirVReflection::definition(std::uint32_t id) const {
+		const auto it = this->definitions.find(id);
+
+		if(it == this->definitions.end())
+			throw Exception("Invalid SPIR-V code: ID #" + std::to_string(id) + " is not defined");
+
+		return it->second;
+	}
+
+	// get the opcode of an instruction
+	inline std::uint32_t SpirVReflection::opcode(std::size_t index) const {
+		return this->word(index) & 0xffff;
+	}
+
+	// get the decorations of an ID (returns empty decorations if none have been set)
+	inline const SpirVReflection::Decorations& SpirVReflection::getDecorations(std::uint32_t id) const {
+		static const Decorations none;
+
+		const auto it = this->decorations.find(id);
+
+		return it == this->decorations.end() ? none : it->second;
+	}
+
+	// get the decorations of a member of a structure (returns empty decorations if none have been set)
+	inline const SpirVReflection::Decorations& SpirVReflection::getMemberDecorations(
+			std::uint32_t id,
+			std::uint32_t member
+	) const {
+		static const Decorations none;
+
+		const auto it = this->memberDecorations.find(std::make_pair(id, member));
+
+		return it == this->memberDecorations.end() ? none : it->second;
+	}
+
+	// get the value of an (integer) constant
+	inline std::uint32_t SpirVReflection::getConstant(std::uint32_t id) const {
+		const std::size_t index = this->definition(id);
+
+		if(this->opcode(index) != SpirVReflection::opConstant && this->opcode(index) != SpirVReflection::opSpecConstant)
+			throw Exception("Invalid SPIR-V code: ID #" + std::to_string(id) + " is not a constant");
+
+		return this->word(index + 3);
+	}
+
+	// get the size of a type (in bytes)
+	inline std::uint32_t SpirVReflection::getSize(std::uint32_t typeId) const {
+		const std::size_t index = this->definition(typeId);
+
+		switch(this->opcode(index)) {
+		case SpirVReflection::opTypeBool:
+			return 4;
+
+		case SpirVReflection::opTypeInt:
+		case SpirVReflection::opTypeFloat:
+			return this->word(index + 2) / 8;
+
+		case SpirVReflection::opTypeVector:
+			return this->word(index + 3) * this->getSize(this->word(index + 2));
+
+		case SpirVReflection::opTypeMatrix:
+			{
+				// columns with three components are padded to four components
+				const std::size_t column = this->definition(this->word(index + 2));
+				const std::uint32_t components = this->word(column + 3);
+
+				return this->word(index + 3)
+						* (components == 3 ? 4 : components)
+						* this->getSize(this->word(column + 2));
+			}
+
+		case SpirVReflection::opTypeArray:
+			{
+				const std::uint32_t stride = this->getDecorations(typeId).arrayStride;
+
+				return this->getConstant(this->word(index + 3))
+						* (stride ? stride : this->getSize(this->word(index + 2)));
+			}
+
+		case SpirVReflection::opTypeRuntimeArray:
+			return 0;
+
+		case SpirVReflection::opTypeStruct:
+			{
+				std::uint32_t size = 0;
+
+				for(std::uint32_t member = 0; member + 2 < (this->words[index] >> 16); ++member) {
+					const Decorations& decorations = this->getMemberDecorations(typeId, member);
+					const std::uint32_t memberTypeId = this->word(index + 2 + member);
+					std::uint32_t memberSize = this->getSize(memberTypeId);
+
+					if(decorations.matrixStride && this->opcode(this->definition(memberTypeId)) == SpirVReflection::opTypeMatrix)
+						memberSize = this->word(this->definition(memberTypeId) + 3) * decorations.matrixStride;
+
+					size = std::max(size, decorations.offset + memberSize);
+				}
+
+				return size;
+			}
+
+		default:
+			throw Exception("Unsupported SPIR-V type: Opcode " + std::to_string(this->opcode(index)));
+		}
+	}
+
+	// get the type of descriptor for a type
+	inline VkDescriptorType SpirVReflection::getDescriptorType(std::uint32_t typeId, std::uint32_t storageClass) const {
+		const std::size_t index = this->definition(typeId);
+
+		if(storageClass == SpirVReflection::storageStorageBuffer)
+			return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+
+		if(storageClass == SpirVReflection::storageUniform)
+			return this->getDecorations(typeId).isBufferBlock ?
+					VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+					: VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+
+		switch(this->opcode(index)) {
+		case SpirVReflection::opTypeSampler:
+			return VK_DESCRIPTOR_TYPE_SAMPLER;
+
+		case SpirVReflection::opTypeSampledImage:
+			return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+
+		case SpirVReflection::opTypeImage:
+			{
+				const std::uint32_t dim = this->word(index + 3);
+				const std::uint32_t sampled = this->word(index + 7);
+
+				if(dim == SpirVReflection::dimBuffer)
+					return sampled == 2 ? VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+
+				if(dim == SpirVReflection::dimSubpassData)
+					return VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+
+				return sampled == 2 ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+			}
+
+		default:
+			throw Exception("Unsupported SPIR-V descriptor type: Opcode " + std::to_string(this->opcode(index)));
+		}
+	}
+
+	// get the format of a (vertex input) type
+	inline VkFormat SpirVReflection::getFormat(std::uint32_t typeId) const {
+		std::size_t index = this->definition(typeId);
+		std::uint32_t components = 1;
+
+		if(this->opcode(index) == SpirVReflection::opTypeVector) {
+			components = this->word(index + 3);
+			index = this->definition(this->word(index + 2));
+		}
+
+		const std::uint32_t width = this->word(index + 2);
+
+		if(components >= 1 && components <= 4) {
+			if(this->opcode(index) == SpirVReflection::opTypeFloat && width == 32) {
+				const VkFormat formats[] = {
+						VK_FORMAT_R32_SFLOAT,
+						VK_FORMAT_R32G32_SFLOAT,
+						VK_FORMAT_R32G32B32_SFLOAT,
+						VK_FORMAT_R32G32B32A32_SFLOAT
+				};
+
+				return formats[components - 1];
+			}
+
+			if(this->opcode(index) == SpirVReflection::opTypeFloat && width == 64) {
+				const VkFormat formats[] = {
+						VK_FORMAT_R64_SFLOAT,
+						VK_FORMAT_R64G64_SFLOAT,
+						VK_FORMAT_R64G64B64_SFLOAT,
+						VK_FORMAT_R64G64B64A64_SFLOAT
+				};
+
+				return formats[components - 1];
+			}
+
+			if(this->opcode(index) == SpirVReflection::opTypeInt && width == 32) {
+				const bool isSigned = this->word(index + 3) != 0;
+
+				const VkFormat signedFormats[] = {
+						VK_FORMAT_R32_SINT,
+						VK_FORMAT_R32G32_SINT,
+						VK_FORMAT_R32G32B32_SINT,
+						VK_FORMAT_R32G32B32A32_SINT
+				};
+
+				const VkFormat unsignedFormats[] = {
+						VK_FORMAT_R32_UINT,
+						VK_FORMAT_R32G32_UINT,
+						VK_FORMAT_R32G32B32_UINT,
+						VK_FORMAT_R32G32B32A32_UINT
+				};
+
+				return isSigned ? signedFormats[components - 1] : unsignedFormats[components - 1];
+			}
+		}
+
+		throw Exception("Unsupported SPIR-V vertex input type: ID #" + std::to_string(typeId));
+	}
+
+} /* spacelite::Helper */
+
+#endif /* SRC_HELPER_SPIRVREFLECTION_HPP_ */
@@ -0,0 +1,196 @@
+/*
+ * StageTimer.hpp
+ *
+ * Measures the (nested) stages of a process, e.g. of the startup, as a tree.
+ *
+ * Stages can also be marked inside member initializer lists, by passing the first argument of a member
+ *  through next(), which ends the current stage and begins the next one before the member is constructed.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_STAGETIMER_HPP_
+#define SRC_HELPER_STAGETIMER_HPP_
+
+#include "../Main/Exception.hpp"
+#include "../Struct/StartupStage.hpp"
+
+#include <chrono>	// std::chrono
+#include <cstddef>	// std::size_t
+#include <iomanip>	// std::fixed, std::setprecision
+#include <sstream>	// std::ostringstream
+#include <string>	// std::string
+#include <utility>	// std::forward
+#include <vector>	// std::vector
+
+namespace spacelite::Helper {
+
+	/*
+	 * DECLARATION
+	 */
+	class StageTimer {
+		using Clock = std::chrono::steady_clock;
+
+	public:
+		StageTimer();
+
+		// begin a stage (nested into the current one, if any)
+		void begin(const std::string& name);
+
+		// end the current stage
+		void end();
+
+		// end the current stage (if any) and begin the next one on the same level
+		void next(const std::string& name);
+
+		// same, but returning the given argument (for marking stages in member initializer lists)
+		template<typename T> T&& next(const std::string& name, T&& argument);
+
+		// add an already measured stage to the current one (or to the top level)
+		void add(const Struct::StartupStage& stage);
+
+		// find a stage by its name (depth-first, returns nullptr if it does not exist)
+		Struct::StartupStage * find(const std::string& name);
+
+		// getters
+		bool isRunning() const;
+		const std::vector<Struct::StartupStage>& get() const;
+
+		// get the sum of the times needed by stages (in ms)
+		static double sum(const std::vector<Struct::StartupStage>& stages);
+
+		// get stages as an indented tree (one line per stage)
+		static std::string str(const std::vector<Struct::StartupStage>& stages, std::size_t indent = 0);
+
+	private:
+		std::vector<Struct::StartupStage> stages;
+		std::vector<std::size_t> path;			// indices of the currently running stages (outermost first)
+		std::vector<Clock::time_point> starts;	// beginnings of the currently running stages
+
+		std::vector<Struct::StartupStage>& current();
+
+		static Struct::StartupStage * find(std::vector<Struct::StartupStage>& in, const std::string& name);
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor stub
+	inline StageTimer::StageTimer() {}
+
+	// begin a stage (nested into the current one, if any)
+	inline void StageTimer::begin(const std::string& name) {
+		std::vector<Struct::StartupStage>& level = this->current();
+
+		level.push_back({ name });
+
+		this->path.push_back(level.size() - 1);
+		this->starts.push_back(Clock::now());
+	}
+
+	// end the current stage
+	inline void StageTimer::end() {
+		if(this->path.empty())
+			throw Exception("Could not end stage: No stage running");
+
+		const Clock::time_point start = this->starts.back();
+		const std::size_t index = this->path.back();
+
+		this->path.pop_back();
+		this->starts.pop_back();
+
+		this->current()[index].time = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	// end the current stage (if any) and begin the next one on the same level
+	inline void StageTimer::next(const std::string& name) {
+		if(!(this->path.empty()))
+			this->end();
+
+		this->begin(name);
+	}
+
+	// end the current stage (if any) and begin the next one on the same level, returning the given argument
+	template<typename T> inline T&& StageTimer::next(const std::string& name, T&& argument) {
+		this->next(name);
+
+		return std::forward<T>(argument);
+	}
+
+	// add an already measured stage to the current one (or to the top level)
+	inline void StageTimer::add(const Struct::StartupStage& stage) {
+		this->current().push_back(stage);
+	}
+
+	// find a stage by its name (depth-first, returns nullptr if it does not exist)
+	inline Struct::StartupStage * StageTimer::find(const std::string& name) {
+		return StageTimer::find(this->stages, name);
+	}
+
+	// get whether a stage is still running
+	inline bool StageTimer::isRunning() const {
+		return !(this->path.empty());
+	}
+
+	// get the measured stages
+	inline const std::vector<Struct::StartupStage>& StageTimer::get() const {
+		return this->stages;
+	}
+
+	// get the sum of the times needed by stages (in ms)
+	inline double StageTimer::sum(const std::vector<Struct::StartupStage>& stages) {
+		double result = 0.;
+
+		for(const auto& stage : stages)
+			result += stage.time;
+
+		return result;
+	}
+
+	// get stages as an indented tree (one line per stage)
+	inline std::string StageTimer::str(const std::vector<Struct::StartupStage>& stages, std::size_t indent) {
+		std::ostringstream result;
+
+		result << std::fixed << std::setprecision(3);
+
+		for(const auto& stage : stages) {
+			result << std::string(2 * indent, ' ') << stage.name << ": " << stage.time << "ms\n";
+
+			result << StageTimer::str(stage.children, indent + 1);
+		}
+
+		return result.str();
+	}
+
+	// get the children of the current stage (or the top level, if no stage is running)
+	inline std::vector<Struct::StartupStage>& StageTimer::current() {
+		std::vector<Struct::StartupStage> * level = &(this->stages);
+
+		for(const std::size_t index : this->path)
+			level = &((*level)[index].children);
+
+		return *level;
+	}
+
+	// find a stage by its name in a list of stages and their children (depth-first)
+	inline Struct::StartupStage * StageTimer::find(std::vector<Struct::StartupStage>& in, const std::string& name) {
+		for(auto& stage : in) {
+			if(stage.name == name)
+				return &stage;
+
+			Struct::StartupStage * child = StageTimer::find(stage.children, name);
+
+			if(child)
+				return child;
+		}
+
+		return nullptr;
+	}
+
+} /* spacelite::Helper */
+
+#endif /* SRC_HELPER_STAGETIMER_HPP_ */
@@ -0,0 +1,83 @@
+/*
+ * Statistics.hpp
+ *
+ * Simple statistics of measured values (e.g. frame or creation times).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_STATISTICS_HPP_
+#define SRC_HELPER_STATISTICS_HPP_
+
+#include <algorithm>	// std::min, std::nth_element
+#include <cmath>		// std::ceil, std::sqrt
+#include <cstddef>		// std::size_t
+#include <numeric>		// std::accumulate
+#include <vector>		// std::vector
+
+namespace spacelite::Helper::Statistics {
+
+	/*
+	 * DECLARATION
+	 */
+
+	// get the sum of values
+	double sum(const std::vector<double>& values);
+
+	// get the arithmetic mean of values (zero if there are none)
+	double mean(const std::vector<double>& values);
+
+	// get the (sample) standard deviation of values (zero if there are less than two)
+	double standardDeviation(const std::vector<double>& values);
+
+	// get a percentile (between zero and one) of values using the nearest rank (zero if there are none)
+	double percentile(std::vector<double> values, double p);
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// get the sum of values
+	inline double sum(const std::vector<double>& values) {
+		return std::accumulate(values.begin(), values.end(), 0.);
+	}
+
+	// get the arithmetic mean of values (zero if there are none)
+	inline double mean(const std::vector<double>& values) {
+		if(values.empty())
+			return 0.;
+
+		return sum(values) / static_cast<double>(values.size());
+	}
+
+	// get the (sample) standard deviation of values (zero if there are less than two)
+	inline double standardDeviation(const std::vector<double>& values) {
+		if(values.size() < 2)
+			return 0.;
+
+		const double average = mean(values);
+		double squares = 0.;
+
+		for(const double value : values)
+			squares += (value - average) * (value - average);
+
+		return std::sqrt(squares / static_cast<double>(values.size() - 1));
+	}
+
+	// get a percentile (between zero and one) of values using the nearest rank (zero if there are none)
+	inline double percentile(std::vector<double> values, double p) {
+		if(values.empty())
+			return 0.;
+
+		const double rank = std::ceil(p * static_cast<double>(values.size()));
+		const std::size_t index = rank > 1. ? std::min(static_cast<std::size_t>(rank), values.size()) - 1 : 0;
+
+		std::nth_element(values.begin(), values.begin() + index, values.end());
+
+		return values[index];
+	}
+
+} /* spacelite::Helper::Statistics */
+
+#endif /* SRC_HELPER_STATISTICS_HPP_ */
@@ -0,0 +1,431 @@
+/*
+ * TaskGraph.hpp
+ *
+ * Graph of named tasks depending on each other, run on a thread pool (e.g. for parts of the startup).
+ *
+ * Tasks are queued as soon as all of their dependencies have finished. Tasks depending on a failed task will not be
+ *  run, but fail with the same exception. The thread that created the graph can wait for tasks while doing other work.
+ *
+ * The work of the creating thread is split into segments by waiting, so that the critical path of the whole graph
+ *  (i.e. the shortest possible time with unlimited threads) can be compared to the time needed if everything had been
+ *  done one after another.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_TASKGRAPH_HPP_
+#define SRC_HELPER_TASKGRAPH_HPP_
+
+#include "ThreadPool.hpp"
+#include "Trace.hpp"
+
+#include "../Main/Exception.hpp"
+#include "../Struct/StartupStage.hpp"
+
+#include <algorithm>			// std::max
+#include <condition_variable>	// std::condition_variable
+#include <cstddef>				// std::size_t
+#include <cstdint>				// std::int64_t
+#include <deque>				// std::deque
+#include <exception>			// std::current_exception, std::exception_ptr, std::rethrow_exception
+#include <functional>			// std::function
+#include <limits>				// std::numeric_limits
+#include <mutex>				// std::lock_guard, std::mutex, std::unique_lock
+#include <string>				// std::string, std::to_string
+#include <utility>				// std::forward, std::move
+#include <vector>				// std::vector
+
+namespace spacelite::Helper {
+
+	/*
+	 * DECLARATION
+	 */
+	class TaskGraph {
+	public:
+		explicit TaskGraph(ThreadPool& threadPool);
+		virtual ~TaskGraph();
+
+		// add a task that will be run after the given tasks (returns its ID)
+		std::size_t add(
+				const std::string& name,
+				std::function<void()> task,
+				const std::vector<std::size_t>& dependencies = {}
+		);
+
+		// wait for a task or for all tasks (re-throwing exceptions, only from the thread that created the graph)
+		void wait(std::size_t id);
+		void waitForAll();
+		template<typename T> T&& waitForAll(T&& arg);
+
+		// wait for all tasks and stop measuring the thread that created the graph
+		void finish();
+
+		// getters (in ms, after finishing)
+		double getCriticalPath() const;
+		double getSequentialTime() const;
+		std::vector<Struct::StartupStage> getStages() const;
+
+		// not copyable, not moveable
+		TaskGraph(const TaskGraph&) = delete;
+		TaskGraph& operator=(const TaskGraph&) = delete;
+
+	private:
+		static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+		struct Task {
+			std::string name;
+			std::function<void()> function;
+			std::vector<std::size_t> dependencies;
+			std::vector<std::size_t> dependents;
+			std::size_t remaining = 0;		// number of dependencies that have not finished yet
+			std::size_t segment = 0;		// segment of the creating thread during which the task has been added
+			std::int64_t added = 0;			// in ns
+			std::int64_t begin = 0;			// in ns
+			std::int64_t end = 0;			// in ns
+			bool done = false;
+			std::exception_ptr exception;
+		};
+
+		// part of the work of the creating thread between two waits
+		struct Segment {
+			std::int64_t begin = 0;			// in ns
+			std::int64_t end = -1;			// in ns (negative if still running)
+			std::size_t waited = none;		// task that has been waited for before the segment (none if all or none)
+		};
+
+		ThreadPool& pool;
+		std::deque<Task> tasks;
+		std::vector<Segment> segments;
+		std::mutex tasksLock;
+		std::condition_variable tasksCondition;
+
+		void queue(std::size_t id);
+		void execute(std::size_t id);
+		void endSegment();
+		void beginSegment(std::size_t waited);
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: begin measuring the thread that created the graph
+	inline TaskGraph::TaskGraph(ThreadPool& threadPool) : pool(threadPool) {
+		this->segments.emplace_back();
+
+		this->segments.back().begin = Trace::now();
+	}
+
+	// destructor: wait for all tasks (ignoring exceptions)
+	inline TaskGraph::~TaskGraph() {
+		std::unique_lock<std::mutex> lock(this->tasksLock);
+
+		this->tasksCondition.wait(lock, [this]() {
+			for(const auto& task : this->tasks)
+				if(!task.done)
+					return false;
+
+			return true;
+		});
+	}
+
+	// add a task that will be run after the given tasks (returns its ID)
+	inline std::size_t TaskGraph::add(
+			const std::string& name,
+			std::function<void()> task,
+			const std::vector<std::size_t>& dependencies
+	) {
+		std::size_t id = 0;
+		bool ready = false;
+
+		{
+			std::lock_guard<std::mutex> lock(this->tasksLock);
+
+			id = this->tasks.size();
+
+			for(const std::size_t dependency : dependencies)
+				if(dependency >= id)
+					throw Exception("Invalid dependency of task \"" + name + "\": #" + std::to_string(dependency));
+
+			Task newTask;
+
+			newTask.name = name;
+			newTask.function = std::move(task);
+			newTask.dependencies = dependencies;
+			newTask.segment = this->segments.size() - 1;
+			newTask.added = Trace::now();
+
+			for(const std::size_t dependency : dependencies)
+				if(!(this->tasks[dependency].done)) {
+					this->tasks[dependency].dependents.push_back(id);
+
+					++(newTask.remaining);
+				}
+
+			ready = !newTask.remaining;
+
+			this->tasks.emplace_back(std::move(newTask));
+		}
+
+		if(ready)
+			this->queue(id);
+
+		return id;
+	}
+
+	// wait for a task, re-throwing its exception (if any)
+	inline void TaskGraph::wait(std::size_t id) {
+		{
+			std::lock_guard<std::mutex> lock(this->tasksLock);
+
+			if(id >= this->tasks.size())
+				throw Exception("Invalid task: #" + std::to_string(id));
+		}
+
+		this->endSegment();
+
+		std::exception_ptr exception;
+
+		{
+			std::unique_lock<std::mutex> lock(this->tasksLock);
+
+			this->tasksCondition.wait(lock, [this, id]() { return this->tasks[id].done; });
+
+			exception = this->tasks[id].exception;
+		}
+
+		this->beginSegment(id);
+
+		if(exception)
+			std::rethrow_exception(exception);
+	}
+
+	// wait for all tasks, re-throwing the first exception (if any) after all of them have finished
+	inline void TaskGraph::waitForAll() {
+		this->endSegment();
+
+		std::exception_ptr exception;
+
+		{
+			std::unique_lock<std::mutex> lock(this->tasksLock);
+
+			this->tasksCondition.wait(lock, [this]() {
+				for(const auto& task : this->tasks)
+					if(!task.done)
+						return false;
+
+				return true;
+			});
+
+			for(const auto& task : this->tasks)
+				if(task.exception) {
+					exception = task.exception;
+
+					break;
+				}
+		}
+
+		this->beginSegment(TaskGraph::none);
+
+		if(exception)
+			std::rethrow_exception(exception);
+	}
+
+	// wait for all tasks and forward the argument (e.g. for using it in member initializer lists)
+	template<typename T> inline T&& TaskGraph::waitForAll(T&& arg) {
+		this->waitForAll();
+
+		return std::forward<T>(arg);
+	}
+
+	// wait for all tasks and stop measuring the thread that created the graph (even if a task has failed)
+	inline void TaskGraph::finish() {
+		std::exception_ptr exception;
+
+		try {
+			this->waitForAll();
+		}
+		catch(...) {
+			exception = std::current_exception();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(this->tasksLock);
+
+			this->segments.back().end = Trace::now();
+		}
+
+		if(exception)
+			std::rethrow_exception(exception);
+	}
+
+	// get the critical path, i.e. the time needed with unlimited threads (in ms, after finishing)
+	inline double TaskGraph::getCriticalPath() const {
+		std::vector<std::int64_t> taskPaths(this->tasks.size(), 0);
+		std::int64_t segmentPath = 0;
+		std::int64_t result = 0;
+		std::size_t next = 0;
+
+		for(std::size_t n = 0; n < this->segments.size(); ++n) {
+			const Segment& segment = this->segments[n];
+
+			// the segment begins after the previous one and the task it has waited for (or all tasks so far)
+			std::int64_t segmentBegin = segmentPath;
+
+			if(n > 0) {
+				if(segment.waited == TaskGraph::none) {
+					for(std::size_t id = 0; id < next; ++id)
+						segmentBegin = std::max(segmentBegin, taskPaths[id]);
+				}
+				else
+					segmentBegin = std::max(segmentBegin, taskPaths[segment.waited]);
+			}
+
+			// tasks begin after their dependencies and after they have been added
+			for(; next < this->tasks.size() && this->tasks[next].segment == n; ++next) {
+				const Task& task = this->tasks[next];
+				std::int64_t taskBegin = segmentBegin + (task.added - segment.begin);
+
+				for(const std::size_t dependency : task.dependencies)
+					taskBegin = std::max(taskBegin, taskPaths[dependency]);
+
+				taskPaths[next] = taskBegin + (task.end - task.begin);
+
+				result = std::max(result, taskPaths[next]);
+			}
+
+			segmentPath = segmentBegin + (segment.end - segment.begin);
+
+			result = std::max(result, segmentPath);
+		}
+
+		return static_cast<double>(result) / 1000000;
+	}
+
+	// get the time needed if the tasks and the work of the creating thread had been done sequentially (in ms)
+	inline double TaskGraph::getSequentialTime() const {
+		std::int64_t result = 0;
+
+		for(const auto& segment : this->segments)
+			result += segment.end - segment.begin;
+
+		for(const auto& task : this->tasks)
+			result += task.end - task.begin;
+
+		return static_cast<double>(result) / 1000000;
+	}
+
+	// get the names and times of the tasks (in ms, summing up tasks with the same name)
+	inline std::vector<Struct::StartupStage> TaskGraph::getStages() const {
+		std::vector<Struct::StartupStage> result;
+
+		for(const auto& task : this->tasks) {
+			const double time = static_cast<double>(task.end - task.begin) / 1000000;
+			bool found = false;
+
+			for(auto& stage : result)
+				if(stage.name == task.name) {
+					stage.time += time;
+
+					found = true;
+
+					break;
+				}
+
+			if(!found)
+				result.push_back({ task.name, time });
+		}
+
+		return result;
+	}
+
+	// queue a task whose dependencies have finished
+	inline void TaskGraph::queue(std::size_t id) {
+		this->pool.run([this, id]() { this->execute(id); });
+	}
+
+	// run a task (if none of its dependencies has failed) and queue the dependents that are ready now
+	inline void TaskGraph::execute(std::size_t id) {
+		std::function<void()> function;
+		std::exception_ptr exception;
+		const char * name = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(this->tasksLock);
+
+			Task& task = this->tasks[id];
+
+			for(const std::size_t dependency : task.dependencies)
+				if(this->tasks[dependency].exception) {
+					exception = this->tasks[dependency].exception;
+
+					break;
+				}
+
+			function = std::move(task.function);
+			name = task.name.c_str(); // the tasks will not be moved, as they are stored in a deque
+		}
+
+		const std::int64_t begin = Trace::now();
+
+		if(!exception) {
+			Trace::Zone zone(name);
+
+			try {
+				function();
+			}
+			catch(...) {
+				exception = std::current_exception();
+			}
+		}
+
+		const std::int64_t end = Trace::now();
+
+		std::vector<std::size_t> ready;
+
+		{
+			std::lock_guard<std::mutex> lock(this->tasksLock);
+
+			Task& task = this->tasks[id];
+
+			task.begin = begin;
+			task.end = end;
+			task.exception = exception;
+			task.done = true;
+
+			for(const std::size_t dependent : task.dependents)
+				if(!(--(this->tasks[dependent].remaining)))
+					ready.push_back(dependent);
+
+			// notify while still holding the lock, because the graph may be destroyed as soon as it is released
+			//  (if this has been the last task)
+			this->tasksCondition.notify_all();
+		}
+
+		for(const std::size_t dependent : ready)
+			this->queue(dependent);
+	}
+
+	// end the current segment of the creating thread before waiting
+	inline void TaskGraph::endSegment() {
+		std::lock_guard<std::mutex> lock(this->tasksLock);
+
+		this->segments.back().end = Trace::now();
+	}
+
+	// begin a new segment of the creating thread after waiting for a task (or for all tasks)
+	inline void TaskGraph::beginSegment(std::size_t waited) {
+		std::lock_guard<std::mutex> lock(this->tasksLock);
+
+		this->segments.emplace_back();
+
+		this->segments.back().begin = Trace::now();
+		this->segments.back().waited = waited;
+	}
+
+} /* spacelite::Helper */
+
+#endif /* SRC_HELPER_TASKGRAPH_HPP_ */
@@ -0,0 +1,161 @@
+/*
+ * ThreadPool.hpp
+ *
+ * Simple pool of worker threads running queued tasks.
+ *
+ * Exceptions thrown by a task are forwarded to the future returned when queueing it.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_THREADPOOL_HPP_
+#define SRC_HELPER_THREADPOOL_HPP_
+
+#include <condition_variable>	// std::condition_variable
+#include <exception>			// std::current_exception, std::exception_ptr, std::rethrow_exception
+#include <functional>			// std::function
+#include <future>				// std::future, std::packaged_task
+#include <memory>				// std::make_shared
+#include <mutex>				// std::lock_guard, std::mutex, std::unique_lock
+#include <queue>				// std::queue
+#include <thread>				// std::thread
+#include <type_traits>			// std::invoke_result_t
+#include <utility>				// std::forward, std::move
+#include <vector>				// std::vector
+
+namespace spacelite::Helper {
+
+	/*
+	 * DECLARATION
+	 */
+	class ThreadPool {
+	public:
+		explicit ThreadPool(unsigned int numberOfThreads = 0);
+		virtual ~ThreadPool();
+
+		// queue a task
+		template<typename F> std::future<std::invoke_result_t<F>> run(F&& task);
+
+		// getters
+		unsigned int getNumberOfThreads() const;
+
+		// wait for all futures, re-throwing the first exception (if any) after all of them have finished
+		template<typename T> static void waitForAll(std::vector<std::future<T>>& futures);
+
+		// not copyable, not moveable
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		ThreadPool& operator=(ThreadPool&&) = delete;
+
+	private:
+		std::vector<std::thread> workers;
+		std::queue<std::function<void()>> tasks;
+		std::mutex tasksLock;
+		std::condition_variable tasksCondition;
+		bool running;
+
+		void work();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: start worker threads (as many as hardware threads are supported if zero)
+	inline ThreadPool::ThreadPool(unsigned int numberOfThreads) : running(true) {
+		if(!numberOfThreads)
+			numberOfThreads = std::thread::hardware_concurrency();
+
+		if(!numberOfThreads)
+			numberOfThreads = 1;
+
+		this->workers.reserve(numberOfThreads);
+
+		for(unsigned int n = 0; n < numberOfThreads; ++n)
+			this->workers.emplace_back(&ThreadPool::work, this);
+	}
+
+	// destructor: finish queued tasks and join worker threads
+	inline ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(this->tasksLock);
+
+			this->running = false;
+		}
+
+		this->tasksCondition.notify_all();
+
+		for(auto& worker : this->workers)
+			if(worker.joinable())
+				worker.join();
+	}
+
+	// queue a task
+	template<typename F> inline std::future<std::invoke_result_t<F>> ThreadPool::run(F&& task) {
+		auto packagedTask = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(task));
+
+		auto future = packagedTask->get_future();
+
+		{
+			std::lock_guard<std::mutex> lock(this->tasksLock);
+
+			this->tasks.emplace([packagedTask]() { (*packagedTask)(); });
+		}
+
+		this->tasksCondition.notify_one();
+
+		return future;
+	}
+
+	// get the number of worker threads
+	inline unsigned int ThreadPool::getNumberOfThreads() const {
+		return this->workers.size();
+	}
+
+	// wait for all futures, re-throwing the first exception (if any) after all of them have finished
+	template<typename T> inline void ThreadPool::waitForAll(std::vector<std::future<T>>& futures) {
+		std::exception_ptr exception;
+
+		for(auto& future : futures) {
+			try {
+				future.get();
+			}
+			catch(...) {
+				if(!exception)
+					exception = std::current_exception();
+			}
+		}
+
+		if(exception)
+			std::rethrow_exception(exception);
+	}
+
+	// worker thread: run queued tasks until the pool is destroyed
+	inline void ThreadPool::work() {
+		while(true) {
+			std::function<void()> task;
+
+			{
+				std::unique_lock<std::mutex> lock(this->tasksLock);
+
+				this->tasksCondition.wait(lock, [this]() {
+					return !(this->running) || !(this->tasks.empty());
+				});
+
+				if(!(this->running) && this->tasks.empty())
+					return;
+
+				task = std::move(this->tasks.front());
+
+				this->tasks.pop();
+			}
+
+			task();
+		}
+	}
+
+} /* spacelite::Helper */
+
+#endif /* SRC_HELPER_THREADPOOL_HPP_ */
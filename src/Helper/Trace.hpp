@@ -0,0 +1,309 @@
+/*
+ * Trace.hpp
+ *
+ * Records scoped zones (e.g. of a frame) on a timeline and writes them as trace in the Chrome JSON format,
+ *  which can be opened by chrome://tracing or the Perfetto UI (https://ui.perfetto.dev).
+ *
+ * Each thread records its zones into its own fixed-size buffer, which is created on its first zone. Recording is
+ *  lock-free, and the buffers can be written while other threads are still recording. Zones will be dropped
+ *  if the buffer of a thread is full. Names of zones need to outlive the trace, i.e. be string literals.
+ *
+ * Zones can also be added to named tracks, e.g. for GPU timestamps that have been converted to the clock used here
+ *  (CLOCK_MONOTONIC on Linux).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_HELPER_TRACE_HPP_
+#define SRC_HELPER_TRACE_HPP_
+
+#include "File.hpp"
+#include "JsonWriter.hpp"
+
+#include <atomic>	// std::atomic, std::memory_order_acquire, std::memory_order_relaxed, std::memory_order_release
+#include <chrono>	// std::chrono
+#include <cstddef>	// std::size_t
+#include <cstdint>	// std::int64_t, std::uint32_t
+#include <memory>	// std::make_shared, std::shared_ptr
+#include <mutex>	// std::lock_guard, std::mutex
+#include <string>	// std::string, std::to_string
+#include <vector>	// std::vector
+
+namespace spacelite::Helper {
+
+	/*
+	 * DECLARATION
+	 */
+	class Trace {
+	public:
+		// scoped zone, recorded when it ends (if tracing is enabled)
+		class Zone {
+		public:
+			explicit Zone(const char * zoneName);
+			virtual ~Zone();
+
+			// end the zone before the end of its scope
+			void end();
+
+			// not copyable, not moveable
+			Zone(const Zone&) = delete;
+			Zone& operator=(const Zone&) = delete;
+
+		private:
+			const char * name;
+			std::int64_t begin;	// in ns (negative if not recording)
+		};
+
+		// enable or disable the recording of zones
+		static void enable();
+		static void disable();
+		static bool isEnabled();
+
+		// get the current time of the clock used for tracing (in ns)
+		static std::int64_t now();
+
+		// add a zone that has already ended (to the track of the current thread or to another track)
+		static void add(const char * name, std::int64_t begin, std::int64_t end, std::uint32_t track = 0);
+
+		// get the track with the given name (creating it, if necessary)
+		static std::uint32_t getTrack(const std::string& name);
+
+		// name the track of the current thread
+		static void nameThread(const std::string& name);
+
+		// write all recorded zones to a file (returns the number of zones written)
+		static std::size_t write(const std::string& fileName);
+
+		// get the number of zones that have been dropped, because the buffer of their thread was full
+		static std::size_t getNumberOfDropped();
+
+	private:
+		static constexpr std::size_t bufferSize = 65536;	// maximum number of zones per thread
+
+		struct Event {
+			const char * name;
+			std::int64_t begin;		// in ns
+			std::int64_t duration;	// in ns
+			std::uint32_t track;
+		};
+
+		struct Buffer {
+			std::vector<Event> events;
+			std::atomic<std::size_t> size{0};		// number of completely written events
+			std::atomic<std::size_t> dropped{0};	// number of events dropped because the buffer was full
+			std::uint32_t track = 0;
+		};
+
+		static Buffer& getBuffer();
+
+		static std::atomic<bool> enabled;
+		static std::atomic<std::int64_t> origin;	// time when tracing has first been enabled (in ns)
+
+		// buffers of all threads and names of all tracks (the first track being unused)
+		static std::mutex registryLock;
+		static std::vector<std::shared_ptr<Buffer>> buffers;
+		static std::vector<std::string> tracks;
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	inline std::atomic<bool> Trace::enabled{false};
+	inline std::atomic<std::int64_t> Trace::origin{-1};
+	inline std::mutex Trace::registryLock;
+	inline std::vector<std::shared_ptr<Trace::Buffer>> Trace::buffers;
+	inline std::vector<std::string> Trace::tracks{ "" };
+
+	// constructor: begin the zone (if tracing is enabled)
+	inline Trace::Zone::Zone(const char * zoneName)
+			: name(zoneName), begin(Trace::isEnabled() ? Trace::now() : -1) {}
+
+	// destructor: end the zone (if it has not been ended yet)
+	inline Trace::Zone::~Zone() {
+		this->end();
+	}
+
+	// end the zone before the end of its scope
+	inline void Trace::Zone::end() {
+		if(this->begin < 0)
+			return;
+
+		Trace::add(this->name, this->begin, Trace::now());
+
+		this->begin = -1;
+	}
+
+	// enable the recording of zones
+	inline void Trace::enable() {
+		std::int64_t none = -1;
+
+		Trace::origin.compare_exchange_strong(none, Trace::now());
+
+		Trace::enabled.store(true, std::memory_order_relaxed);
+	}
+
+	// disable the recording of zones (already recorded zones will be kept)
+	inline void Trace::disable() {
+		Trace::enabled.store(false, std::memory_order_relaxed);
+	}
+
+	// get whether zones are recorded
+	inline bool Trace::isEnabled() {
+		return Trace::enabled.load(std::memory_order_relaxed);
+	}
+
+	// get the current time of the clock used for tracing (in ns)
+	inline std::int64_t Trace::now() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()
+		).count();
+	}
+
+	// add a zone that has already ended (to the track of the current thread, if no other track is given)
+	inline void Trace::add(const char * name, std::int64_t begin, std::int64_t end, std::uint32_t track) {
+		if(!Trace::isEnabled())
+			return;
+
+		Buffer& buffer = Trace::getBuffer();
+		const std::size_t index = buffer.size.load(std::memory_order_relaxed);
+
+		if(index >= buffer.events.size()) {
+			buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+
+			return;
+		}
+
+		buffer.events[index] = { name, begin, end - begin, track ? track : buffer.track };
+
+		// publish the event to the thread writing the trace
+		buffer.size.store(index + 1, std::memory_order_release);
+	}
+
+	// get the track with the given name (creating it, if necessary)
+	inline std::uint32_t Trace::getTrack(const std::string& name) {
+		std::lock_guard<std::mutex> lock(Trace::registryLock);
+
+		for(std::size_t n = 1; n < Trace::tracks.size(); ++n)
+			if(Trace::tracks[n] == name)
+				return static_cast<std::uint32_t>(n);
+
+		Trace::tracks.push_back(name);
+
+		return static_cast<std::uint32_t>(Trace::tracks.size() - 1);
+	}
+
+	// name the track of the current thread
+	inline void Trace::nameThread(const std::string& name) {
+		const std::uint32_t track = Trace::getBuffer().track;
+
+		std::lock_guard<std::mutex> lock(Trace::registryLock);
+
+		Trace::tracks[track] = name;
+	}
+
+	// write all recorded zones to a file (returns the number of zones written)
+	inline std::size_t Trace::write(const std::string& fileName) {
+		std::lock_guard<std::mutex> lock(Trace::registryLock);
+
+		const std::int64_t start = Trace::origin.load();
+
+		JsonWriter json;
+		std::size_t numberOfZones = 0;
+		std::size_t numberOfDropped = 0;
+
+		json.beginObject();
+
+		json.add("displayTimeUnit", "ms");
+
+		json.beginArray("traceEvents");
+
+		// name the tracks
+		for(std::size_t n = 1; n < Trace::tracks.size(); ++n) {
+			json.beginObject();
+
+			json.add("name", "thread_name");
+			json.add("ph", "M");
+			json.add("pid", 1ULL);
+			json.add("tid", static_cast<unsigned long long>(n));
+
+			json.beginObject("args");
+
+			json.add("name", Trace::tracks[n]);
+
+			json.endObject();
+			json.endObject();
+		}
+
+		// add the zones as complete events (with times in μs)
+		for(const auto& buffer : Trace::buffers) {
+			const std::size_t size = buffer->size.load(std::memory_order_acquire);
+
+			for(std::size_t n = 0; n < size; ++n) {
+				const Event& event = buffer->events[n];
+
+				json.beginObject();
+
+				json.add("name", event.name);
+				json.add("ph", "X");
+				json.add("ts", static_cast<double>(event.begin - start) / 1000);
+				json.add("dur", static_cast<double>(event.duration) / 1000);
+				json.add("pid", 1ULL);
+				json.add("tid", static_cast<unsigned long long>(event.track));
+
+				json.endObject();
+			}
+
+			numberOfZones += size;
+			numberOfDropped += buffer->dropped.load(std::memory_order_relaxed);
+		}
+
+		json.endArray();
+
+		json.add("droppedZones", static_cast<unsigned long long>(numberOfDropped));
+
+		json.endObject();
+
+		File::writeText(fileName, json.str());
+
+		return numberOfZones;
+	}
+
+	// get the number of zones that have been dropped, because the buffer of their thread was full
+	inline std::size_t Trace::getNumberOfDropped() {
+		std::lock_guard<std::mutex> lock(Trace::registryLock);
+
+		std::size_t result = 0;
+
+		for(const auto& buffer : Trace::buffers)
+			result += buffer->dropped.load(std::memory_order_relaxed);
+
+		return result;
+	}
+
+	// get the buffer of the current thread (creating it on first use)
+	inline Trace::Buffer& Trace::getBuffer() {
+		thread_local std::shared_ptr<Buffer> buffer;
+
+		if(!buffer) {
+			auto newBuffer = std::make_shared<Buffer>();
+
+			newBuffer->events.resize(Trace::bufferSize);
+
+			std::lock_guard<std::mutex> lock(Trace::registryLock);
+
+			Trace::buffers.push_back(newBuffer);
+			Trace::tracks.push_back("thread #" + std::to_string(Trace::buffers.size()));
+
+			newBuffer->track = static_cast<std::uint32_t>(Trace::tracks.size() - 1);
+
+			buffer = newBuffer;
+		}
+
+		return *buffer;
+	}
+
+} /* spacelite::Helper */
+
+#endif /* SRC_HELPER_TRACE_HPP_ */
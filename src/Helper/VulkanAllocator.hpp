@@ -10,7 +10,8 @@
 
 #include <vulkan/vulkan_core.h>
 
-#include <cstdlib> // aligned_alloc, free
+#include <atomic>	// std::atomic
+#include <cstdlib>	// aligned_alloc, free
 
 namespace spacelite::Helper {
 	/*
@@ -45,8 +46,9 @@ namespace spacelite::Helper {
 		static unsigned long long getReAllocated();
 
 	private:
-		static unsigned long long allocated;
-		static unsigned long long reAllocated;
+		// atomic, because pipelines may be created by multiple threads at once
+		static std::atomic<unsigned long long> allocated;
+		static std::atomic<unsigned long long> reAllocated;
 	};
 
 	/*
@@ -62,8 +64,8 @@ namespace spacelite::Helper {
 	};
 
 	inline const VkAllocationCallbacks * VulkanAllocator::ptr = &VulkanAllocator::allocatorStruct;
-	inline unsigned long long VulkanAllocator::allocated = 0;
-	inline unsigned long long VulkanAllocator::reAllocated = 0;
+	inline std::atomic<unsigned long long> VulkanAllocator::allocated{0};
+	inline std::atomic<unsigned long long> VulkanAllocator::reAllocated{0};
 
 	inline VulkanAllocator::VulkanAllocator() {}
 
@@ -15,27 +15,110 @@ namespace spacelite::Main {
 const Struct::AppInfo App::appInfo("vulkan-triangle", 1, 0, 0);
 const unsigned int App::defaultWinWidth = 800;
 const unsigned int App::defaultWinHeight = 600;
+const bool App::onDemandRendering = true; // render only when needed, waiting for window events otherwise
+const double App::maxFrameRate = 60.; // in frames per second (zero for no limit beyond the present mode)
+const double App::unfocusedFrameTime = 0.1; // minimum time between frames (in s) while the window is not focused
+const double App::idleTimeout = 0.5; // maximum time to wait for window events (in s) while nothing needs rendering
 /* END STATIC CONSTANTS */
 
 // constructor: initialize all components
-App::App(int argc __attribute__ ((unused)), char * argv[] __attribute__ ((unused)))
+App::App(int argc, char * argv[])
 		:	locale("en_US.UTF8"),
+			benchmark(argc, argv),
 			isRunning(true),
-			mainWindow(Struct::WinProp(App::appInfo.name, App::defaultWinWidth, App::defaultWinHeight)),
-			engineGraphics(Engine::Graphics::getInstance(App::appInfo, mainWindow, &(this->graphicsDestructor))) {}
+			mainWindow(
+					Struct::WinProp(
+							App::appInfo.name,
+							App::defaultWinWidth,
+							App::defaultWinHeight,
+							!(benchmark.getSettings().headless)
+					)
+			),
+			mainWindowStartupTime(static_cast<double>(startupTimer.since()) / 1000),
+			engineGraphics(
+					Engine::Graphics::getInstance(
+							App::appInfo,
+							mainWindow,
+							benchmark.getSettings().scene,
+							&(this->graphicsDestructor)
+					)
+			),
+			frameLimiter(App::maxFrameRate > 0. ? 1. / App::maxFrameRate : 0.),
+			isIdle(false) {}
+
+// create and run the application, logging errors that occur while creating it (e.g. invalid arguments)
+int App::main(int argc, char * argv[]) {
+	try {
+		return App::getInstance(argc, argv).run();
+	}
+	catch(const std::exception& exception) {
+		Helper::Log::error() << exception.what();
+	}
+
+	return EXIT_FAILURE;
+}
 
 // run the main loop
 int App::run() {
 	try {
-		while(this->tick()) {}
+		if(this->benchmark.isEnabled())
+			this->benchmark.start();
+
+		// perform the first tick and show the stages of the startup (including the first frame)
+		bool running = this->tick();
+
+		Helper::Log::info()	<< "(startup stages:\n"
+							<< Helper::StageTimer::str(this->getStartupStages(), 1)
+							<< ")";
+
+		// export the render graph for inspection, e.g. using Graphviz (if enabled)
+		const std::string& renderGraphFile = this->benchmark.getSettings().renderGraphFile;
+
+		if(!renderGraphFile.empty()) {
+			Helper::File::writeText(renderGraphFile, this->engineGraphics.getRenderGraph().toDot());
+
+			Helper::Log::info() << "(render graph written to " << renderGraphFile << ")";
+		}
+
+		while(running && this->tick()) {}
+
+		// write the trace (if enabled)
+		const std::string& traceFile = this->benchmark.getSettings().traceFile;
+
+		if(!traceFile.empty()) {
+			const std::size_t numberOfZones = Helper::Trace::write(traceFile);
+
+			Helper::Log::info() << "(trace with " << numberOfZones << " zones written to " << traceFile << ")";
+
+			const std::size_t numberOfDropped = Helper::Trace::getNumberOfDropped();
+
+			if(numberOfDropped)
+				Helper::Log::warning()	<< "(WARNING: "
+										<< numberOfDropped
+										<< " zones dropped from the trace, because the buffers of their threads were full)";
+		}
+
+		// write the benchmark report, failing if it is slower than the baseline (if given)
+		if(
+				this->benchmark.isEnabled()
+				&& !(this->benchmark.writeReport(App::appInfo, this->engineGraphics, this->mainWindowStartupTime))
+		)
+			return EXIT_FAILURE;
 	}
 	catch(const Main::Exception& exception) {
-		std::cout << exception.what() << std::endl;
+		Helper::Log::error() << exception.what();
 
 		return EXIT_FAILURE;
 	}
 
-	std::cout << "Bye bye." << std::endl;
+	if(this->frameLimiter.getNumberOfFrames())
+		Helper::Log::info()	<< "(frame rate limited to "
+							<< App::maxFrameRate
+							<< "fps, p99 jitter was "
+							<< this->frameLimiter.getJitter(0.99)
+							<< "ms)";
+
+	Helper::Log::info() << "Bye bye.";
 
 	return EXIT_SUCCESS;
 }
@@ -49,14 +132,89 @@ bool App::tick() {
 		return false;
 	}
 
-	// update engine
-	this->engineGraphics.tick();
+	if(this->benchmark.isEnabled()) {
+		// update engine and main window as fast as possible, counting the frames of the benchmark
+		this->engineGraphics.tick();
+
+		this->mainWindow.tick();
+
+		if(!(this->benchmark.tick()))
+			this->isRunning = false;
+
+		return this->isRunning;
+	}
+
+	if(!App::onDemandRendering) {
+		// update engine (after waiting for the current frame to be over)
+		this->frameLimiter.wait();
+
+		this->engineGraphics.tick();
+
+		// update main window
+		this->mainWindow.tick();
+
+		// return whether to continue
+		return this->isRunning;
+	}
+
+	// the scene needs to be drawn again if the window has been damaged or resized
+	if(this->mainWindow.isDamaged() || this->mainWindow.isResized()) {
+		this->engineGraphics.invalidate();
+
+		this->mainWindow.resetDamage();
+	}
+
+	// update engine only if a frame is needed and the window is visible (throttled while it is not focused)
+	double waitTimeout = App::idleTimeout;
+
+	if(!(this->mainWindow.isIconified()) && this->engineGraphics.needsFrame()) {
+		const double frameTime = this->mainWindow.isFocused() ? 0. : App::unfocusedFrameTime;
+		const double elapsedTime = static_cast<double>(this->frameTimer.since()) / 1000000;
 
-	// update main window
-	this->mainWindow.tick();
+		if(elapsedTime >= frameTime) {
+			// start over with the frame rate limit after idling (or being iconified)
+			if(this->isIdle) {
+				this->frameLimiter.reset();
+
+				this->isIdle = false;
+			}
+
+			this->frameLimiter.wait();
+			this->frameTimer.reset();
+
+			this->engineGraphics.tick();
+
+			if(this->engineGraphics.needsFrame())
+				waitTimeout = frameTime;
+		}
+		else
+			waitTimeout = frameTime - elapsedTime;
+	}
+	else
+		this->isIdle = true;
+
+	// update main window (polling for events if the next frame is due, waiting for them otherwise)
+	this->mainWindow.tick(waitTimeout);
 
 	// return whether to continue
 	return this->isRunning;
 }
 
+// get the stages of the startup (after the first frame): window, engine and first frame
+std::vector<Struct::StartupStage> App::getStartupStages() const {
+	std::vector<Struct::StartupStage> stages{
+		{ "GLFW", this->mainWindowStartupTime }, // the window itself is opened by the engine
+		{ "engine", this->engineGraphics.getStartupTime() }
+	};
+
+	for(const auto& stage : this->engineGraphics.getStartupStages()) {
+		if(stage.name == "first frame")
+			stages.push_back(stage);
+		else
+			stages[1].children.push_back(stage);
+	}
+
+	return stages;
+}
+
 } /* spacelite::Main */
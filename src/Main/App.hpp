@@ -10,16 +10,27 @@
 #ifndef APP_HPP_
 #define APP_HPP_
 
+#include "Benchmark.hpp"
 #include "Exception.hpp"
 #include "Window.hpp"
 
 #include "../Engine/Graphics.hpp"
+#include "../Helper/File.hpp"
+#include "../Helper/FrameLimiter.hpp"
+#include "../Helper/Log.hpp"
 #include "../Helper/SingletonDestructor.hpp"
+#include "../Helper/StageTimer.hpp"
+#include "../Helper/TimerHighRes.hpp"
+#include "../Helper/Trace.hpp"
 #include "../Struct/AppInfo.hpp"
+#include "../Struct/StartupStage.hpp"
 #include "../Wrapper/SetLocale.hpp"
 
+#include <cstddef>	// std::size_t
 #include <cstdlib>	// EXIT_FAILURE, EXIT_SUCCESS
-#include <iostream>	// std::cout, std::endl
+#include <exception>	// std::exception
+#include <string>	// std::string
+#include <vector>	// std::vector
 
 namespace spacelite::Main {
 	class App {
@@ -27,6 +38,10 @@ namespace spacelite::Main {
 		static const Struct::AppInfo appInfo;
 		static const unsigned int defaultWinWidth;
 		static const unsigned int defaultWinHeight;
+		static const bool onDemandRendering;
+		static const double maxFrameRate;
+		static const double unfocusedFrameTime;
+		static const double idleTimeout;
 		/* END STATIC CONSTANTS */
 
 		/* SINGLETON */
@@ -46,6 +61,9 @@ namespace spacelite::Main {
 		void operator=(const App&) = delete;
 		/* END SINGLETON */
 
+		// create and run application (returns its exit code)
+		static int main(int argc, char * argv[]);
+
 		// run application
 		int run();
 
@@ -53,12 +71,19 @@ namespace spacelite::Main {
 		// using C locale for output to stdout
 		const Wrapper::SetLocale locale;
 
+		// benchmark run (if enabled on the command line)
+		Benchmark benchmark;
+
+		// time since the start of the application (for measuring the startup)
+		Helper::TimerHighRes startupTimer;
+
 	protected:
 		// state
 		bool isRunning;
 
-		// main window
+		// main window (and the time needed to create it, in ms)
 		Window mainWindow;
+		double mainWindowStartupTime;
 
 		// engine destructor
 		Helper::SingletonDestructor<Engine::Graphics> graphicsDestructor;
@@ -66,9 +91,19 @@ namespace spacelite::Main {
 		// engine
 		Engine::Graphics& engineGraphics;
 
+		// time since the last frame (for throttling on-demand rendering)
+		Helper::TimerHighRes frameTimer;
+
+		// frame rate limiter (and whether no frames have been needed in on-demand mode since the last one)
+		Helper::FrameLimiter frameLimiter;
+		bool isIdle;
+
 	private:
 		// perform a tick
 		bool tick();
+
+		// get the stages of the startup (after the first frame)
+		std::vector<Struct::StartupStage> getStartupStages() const;
 	};
 
 } /* spacelite::Main */
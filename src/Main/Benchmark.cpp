@@ -0,0 +1,437 @@
+/*
+ * Benchmark.cpp
+ *
+ * Benchmark run with a fixed number of frames or a fixed duration (configured from the command line).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#include "Benchmark.hpp"
+
+namespace spacelite::Main {
+
+// constructor: parse the command line
+Benchmark::Benchmark(int argc, char * argv[])
+		: settings(Benchmark::parseArguments(argc, argv)), numberOfFrames(0), measuredTime(0.) {
+	if(this->settings.frames)
+		this->frameTimes.reserve(this->settings.frames);
+
+	// start logging before anything else is created, so that it will be stopped after everything else
+	Helper::Log::setLevel(Helper::Log::getSeverity(this->settings.logLevel));
+
+	// start tracing before anything else is created, so that the startup is traced, too
+	if(!(this->settings.traceFile.empty())) {
+		Helper::Trace::enable();
+		Helper::Trace::nameThread("main");
+	}
+}
+
+// get whether a benchmark is run
+bool Benchmark::isEnabled() const {
+	return this->settings.enabled;
+}
+
+// get the settings of the benchmark
+const Struct::BenchmarkSettings& Benchmark::getSettings() const {
+	return this->settings;
+}
+
+// start measuring (after the startup)
+void Benchmark::start() {
+	this->frameTimer.reset();
+	this->durationTimer.reset();
+}
+
+// count a frame and return whether to continue
+bool Benchmark::tick() {
+	const double frameTime = static_cast<double>(this->frameTimer.since()) / 1000;
+
+	this->frameTimer.reset();
+
+	++(this->numberOfFrames);
+
+	// discard the warm-up frames
+	if(this->numberOfFrames <= this->settings.warmUpFrames) {
+		if(this->numberOfFrames == this->settings.warmUpFrames)
+			this->durationTimer.reset();
+
+		return true;
+	}
+
+	this->frameTimes.push_back(frameTime);
+
+	this->measuredTime = static_cast<double>(this->durationTimer.since()) / 1000000;
+
+	// check whether the benchmark is finished
+	if(this->settings.frames && this->frameTimes.size() >= this->settings.frames)
+		return false;
+
+	if(this->settings.duration > 0. && this->measuredTime >= this->settings.duration)
+		return false;
+
+	return true;
+}
+
+// write the JSON report and compare it to the baseline (if given), returning whether no slowdowns have been found
+bool Benchmark::writeReport(
+		const Struct::AppInfo& appInfo,
+		const Engine::Graphics& graphics,
+		double windowStartupTime
+) const {
+	Helper::JsonWriter json;
+
+	json.beginObject();
+
+	// application
+	json.beginObject("application");
+
+	json.add("name", appInfo.name);
+	json.add(
+			"version",
+			std::to_string(appInfo.verMajor) + "." + std::to_string(appInfo.verMinor) + "." + std::to_string(appInfo.verPatch)
+	);
+
+	json.endObject();
+
+	// settings
+	json.beginObject("settings");
+
+	json.add("frames", this->settings.frames);
+	json.add("duration_s", this->settings.duration);
+	json.add("warm_up_frames", this->settings.warmUpFrames);
+	json.add("headless", this->settings.headless);
+	json.add("scene", this->settings.scene);
+
+	json.endObject();
+
+	// device
+	const VkPhysicalDeviceProperties& vulkanProperties = graphics.getDeviceProperties();
+
+	json.beginObject("device");
+
+	json.add("name", vulkanProperties.deviceName);
+	json.add("type", Benchmark::getDeviceType(vulkanProperties.deviceType));
+	json.add("vendor_id", static_cast<unsigned long long>(vulkanProperties.vendorID));
+	json.add("device_id", static_cast<unsigned long long>(vulkanProperties.deviceID));
+	json.add("api_version", Benchmark::getVersion(vulkanProperties.apiVersion));
+	json.add("driver_version", static_cast<unsigned long long>(vulkanProperties.driverVersion));
+	json.add("capabilities", graphics.getDeviceCapabilities());
+
+	json.endObject();
+
+	// frame times
+	const double totalTime = Helper::Statistics::sum(this->frameTimes);
+
+	json.beginObject("frames");
+
+	json.add("measured", static_cast<unsigned long long>(this->frameTimes.size()));
+	json.add("discarded", std::min(this->numberOfFrames, this->settings.warmUpFrames));
+	json.add("total_ms", totalTime);
+	json.add("mean_ms", Helper::Statistics::mean(this->frameTimes));
+	json.add("min_ms", Helper::Statistics::percentile(this->frameTimes, 0.));
+	json.add("p50_ms", Helper::Statistics::percentile(this->frameTimes, 0.5));
+	json.add("p90_ms", Helper::Statistics::percentile(this->frameTimes, 0.9));
+	json.add("p95_ms", Helper::Statistics::percentile(this->frameTimes, 0.95));
+	json.add("p99_ms", Helper::Statistics::percentile(this->frameTimes, 0.99));
+	json.add("max_ms", Helper::Statistics::percentile(this->frameTimes, 1.));
+	json.add("fps", totalTime > 0. ? 1000. * static_cast<double>(this->frameTimes.size()) / totalTime : 0.);
+
+	json.endObject();
+
+	// startup
+	json.beginObject("startup");
+
+	json.add("window_ms", windowStartupTime);
+	json.add("engine_ms", graphics.getStartupTime());
+	json.add("engine_critical_path_ms", graphics.getStartupCriticalPath());
+	json.add("engine_sequential_ms", graphics.getStartupSequentialTime());
+
+	Benchmark::writeStages(json, graphics.getStartupStages());
+
+	json.endObject();
+
+	// particles (particle scenes only)
+	if(graphics.getNumberOfParticles()) {
+		json.beginObject("particles");
+
+		json.add("count", static_cast<unsigned long long>(graphics.getNumberOfParticles()));
+		json.add("simulation_mean_ms", graphics.getParticleSimulationTime());
+
+		json.endObject();
+	}
+
+	// memory
+	json.beginObject("memory");
+
+	json.add("device_allocated_bytes", Wrapper::VulkanDeviceMemory::getAllocated());
+	json.add("device_peak_bytes", Wrapper::VulkanDeviceMemory::getPeak());
+	json.add("device_allocations", Wrapper::VulkanDeviceMemory::getNumberOfAllocations());
+	json.add("host_allocated_bytes", Helper::VulkanAllocator::getAllocated());
+	json.add("host_reallocated_bytes", Helper::VulkanAllocator::getReAllocated());
+
+	json.endObject();
+
+	json.endObject();
+
+	const std::string report(json.str());
+
+	Helper::File::writeText(this->settings.reportFile, report);
+
+	Helper::Log::info() << "(benchmark report written to " << this->settings.reportFile << ")";
+
+	if(this->settings.baselineFile.empty())
+		return true;
+
+	return this->compare(report);
+}
+
+// parse the command line (throws an exception on invalid arguments)
+Struct::BenchmarkSettings Benchmark::parseArguments(int argc, char * argv[]) {
+	Struct::BenchmarkSettings result;
+
+	result.warmUpFrames = 100;
+	result.scene = "triangle";
+	result.reportFile = "benchmark.json";
+	result.tolerance = 0.1;
+	result.toleranceTime = 0.5;
+	result.logLevel = "info";
+
+	for(int n = 1; n < argc; ++n) {
+		const std::string argument(argv[n]);
+		const auto separator = argument.find('=');
+		const std::string option(argument.substr(0, separator));
+		const std::string value(separator == std::string::npos ? "" : argument.substr(separator + 1));
+
+		// tracing is independent of the benchmark
+		if(option == "--trace") {
+			result.traceFile = value.empty() ? "trace.json" : value;
+
+			continue;
+		}
+
+		// so is the export of the render graph
+		if(option == "--render-graph") {
+			result.renderGraphFile = value.empty() ? "render_graph.dot" : value;
+
+			continue;
+		}
+
+		// and logging
+		if(option == "--log-level" && !value.empty()) {
+			result.logLevel = value;
+
+			continue;
+		}
+
+		try {
+			if(option == "--frames")
+				result.frames = Benchmark::parseCount(value);
+			else if(option == "--duration")
+				result.duration = std::stod(value);
+			else if(option == "--warm-up")
+				result.warmUpFrames = Benchmark::parseCount(value);
+			else if(option == "--headless")
+				result.headless = true;
+			else if(option == "--scene" && !value.empty())
+				result.scene = value;
+			else if(option == "--report" && !value.empty())
+				result.reportFile = value;
+			else if(option == "--baseline" && !value.empty())
+				result.baselineFile = value;
+			else if(option == "--tolerance")
+				result.tolerance = std::stod(value);
+			else if(option == "--tolerance-ms")
+				result.toleranceTime = std::stod(value);
+			else if(option != "--benchmark")
+				throw Exception("Invalid argument: " + argument);
+		}
+		catch(const std::exception&) {
+			throw Exception("Invalid argument: " + argument);
+		}
+
+		result.enabled = true;
+	}
+
+	// use the default number of frames if neither frames nor duration have been given
+	if(!result.frames && result.duration <= 0.)
+		result.frames = 1000;
+
+	return result;
+}
+
+// parse a count from the command line (throws an exception if it is not a non-negative integer)
+//  NOTE:	std::stoull would accept negative numbers and wrap them around to huge counts.
+unsigned long long Benchmark::parseCount(const std::string& value) {
+	if(value.empty() || value.find_first_not_of("0123456789") != std::string::npos)
+		throw Exception("Invalid count: " + value);
+
+	return std::stoull(value);
+}
+
+// get the type of a device as string
+std::string Benchmark::getDeviceType(VkPhysicalDeviceType type) {
+	switch(type) {
+	case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU:
+		return "integrated";
+
+	case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:
+		return "discrete";
+
+	case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:
+		return "virtual";
+
+	case VK_PHYSICAL_DEVICE_TYPE_CPU:
+		return "cpu";
+
+	default:
+		return "other";
+	}
+}
+
+// get a Vulkan API version as string
+std::string Benchmark::getVersion(unsigned int version) {
+	return std::to_string(VK_VERSION_MAJOR(version))
+			+ "."
+			+ std::to_string(VK_VERSION_MINOR(version))
+			+ "."
+			+ std::to_string(VK_VERSION_PATCH(version));
+}
+
+// get whether a value of a report is compared to the baseline
+//  (frame times without extremes and total, top-level startup times and the time of the particle simulation)
+//  NOTE:	Sub-stages of the startup and times summed over all threads (i.e. the background tasks
+//			and the sequential time) are not compared, because they vary too much between runs.
+bool Benchmark::isCompared(const std::string& key) {
+	const auto endsWith = [&key](const std::string& suffix) {
+		return key.size() >= suffix.size() && key.compare(key.size() - suffix.size(), suffix.size(), suffix) == 0;
+	};
+
+	if(key.compare(0, 7, "frames.") == 0)
+		return endsWith("_ms") && key != "frames.min_ms" && key != "frames.max_ms" && key != "frames.total_ms";
+
+	if(key.compare(0, 10, "particles.") == 0)
+		return endsWith("_ms");
+
+	if(key.compare(0, 8, "startup.") != 0 || key == "startup.engine_sequential_ms")
+		return false;
+
+	if(key.compare(0, 15, "startup.stages.") == 0)
+		return	endsWith(".ms")
+				&& key.find(".stages.", 15) == std::string::npos
+				&& key != "startup.stages." + Engine::Graphics::backgroundStage + ".ms";
+
+	return endsWith("_ms");
+}
+
+// compare the frame and startup times of a report to the baseline, printing the differences
+//  (returns whether no slowdowns have been found, i.e. all times are within the tolerances and none are missing)
+bool Benchmark::compare(const std::string& report) const {
+	const std::vector<char> baselineContent(Helper::File::readBinary(this->settings.baselineFile));
+	const Helper::JsonReader baseline(std::string(baselineContent.begin(), baselineContent.end()));
+	const Helper::JsonReader current(report);
+
+	// warn if the results are not comparable
+	for(const std::string key : { "settings.scene", "device.name" }) {
+		const auto before = baseline.getStrings().find(key);
+		const auto after = current.getStrings().find(key);
+
+		if(before == baseline.getStrings().end() || after == current.getStrings().end() || before->second != after->second)
+			Helper::Log::warning() << "(WARNING: " << key << " differs from the baseline)";
+	}
+
+	for(const std::string key : { "settings.frames", "settings.warm_up_frames", "device.driver_version" }) {
+		const auto before = baseline.getNumbers().find(key);
+		const auto after = current.getNumbers().find(key);
+
+		if(before == baseline.getNumbers().end() || after == current.getNumbers().end() || before->second != after->second)
+			Helper::Log::warning() << "(WARNING: " << key << " differs from the baseline)";
+	}
+
+	// compare the times (logging the comparison as one message)
+	unsigned int slowdowns = 0;
+	unsigned int missing = 0;
+
+	{
+		Helper::Log::Message comparison(Helper::Log::Severity::info);
+
+		comparison	<< "(comparing to "
+					<< this->settings.baselineFile
+					<< ", tolerating "
+					<< 100. * this->settings.tolerance
+					<< "% or "
+					<< this->settings.toleranceTime
+					<< "ms:"
+					<< std::fixed
+					<< std::setprecision(3);
+
+		for(const auto& value : baseline.getNumbers()) {
+			if(!Benchmark::isCompared(value.first))
+				continue;
+
+			comparison << "\n  " << value.first << ": ";
+
+			const auto after = current.getNumbers().find(value.first);
+
+			if(after == current.getNumbers().end()) {
+				comparison << "MISSING";
+
+				++missing;
+
+				continue;
+			}
+
+			const double difference = after->second - value.second;
+			const bool slower =
+					difference > std::max(value.second * this->settings.tolerance, this->settings.toleranceTime);
+
+			comparison << value.second << "ms -> " << after->second << "ms";
+
+			if(value.second > 0.)
+				comparison << " (" << (difference < 0. ? "" : "+") << 100. * difference / value.second << "%)";
+
+			if(slower) {
+				comparison << " SLOWER";
+
+				++slowdowns;
+			}
+		}
+
+		comparison << "\n)";
+	}
+
+	if(slowdowns || missing) {
+		Helper::Log::error()	<< "(FAILED: "
+								<< slowdowns
+								<< " time(s) slower than the baseline, "
+								<< missing
+								<< " time(s) of the baseline missing)";
+
+		return false;
+	}
+
+	Helper::Log::info() << "(PASSED: no times slower than the baseline or missing)";
+
+	return true;
+}
+
+// write (nested) startup stages as an array of objects with their names, times and sub-stages
+void Benchmark::writeStages(Helper::JsonWriter& json, const std::vector<Struct::StartupStage>& stages) {
+	json.beginArray("stages");
+
+	for(const auto& stage : stages) {
+		json.beginObject();
+
+		json.add("name", stage.name);
+		json.add("ms", stage.time);
+
+		if(!(stage.children.empty()))
+			Benchmark::writeStages(json, stage.children);
+
+		json.endObject();
+	}
+
+	json.endArray();
+}
+
+} /* spacelite::Main */
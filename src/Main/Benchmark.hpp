@@ -0,0 +1,99 @@
+/*
+ * Benchmark.hpp
+ *
+ * Benchmark run with a fixed number of frames or a fixed duration (configured from the command line).
+ *
+ * Usage:	--benchmark			run a benchmark (implied by all other options)
+ * 			--frames=<n>		number of measured frames (default: 1000, unless a duration is given)
+ * 			--duration=<s>		duration of the measurement in seconds
+ * 			--warm-up=<n>		number of frames to discard before measuring (default: 100)
+ * 			--headless			hide the window (still needs a display server, e.g. Xvfb)
+ * 			--scene=<name>		synthetic scene to render: triangle (default), grid, overdraw or particles
+ * 								 (particles-<n> for another number of particles than 1048576)
+ * 			--report=<file>		file to write the JSON report to (default: benchmark.json)
+ * 			--baseline=<file>	earlier report to compare the frame and top-level startup times to (fails on slowdowns and missing times)
+ * 			--tolerance=<x>		tolerated relative slowdown compared to the baseline (default: 0.1, i.e. 10%)
+ * 			--tolerance-ms=<ms>	tolerated absolute slowdown compared to the baseline (default: 0.5)
+ *
+ * 			--trace[=<file>]	write a trace of the frames in the Chrome JSON format (default: trace.json)
+ * 								 (does not imply --benchmark)
+ * 			--render-graph[=<file>]
+ * 								export the render graph in the DOT format after the startup (default: render_graph.dot)
+ * 								 (does not imply --benchmark)
+ * 			--log-level=<level>	minimum severity of logged messages: debug, info (default), warning or error
+ * 								 (does not imply --benchmark)
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_MAIN_BENCHMARK_HPP_
+#define SRC_MAIN_BENCHMARK_HPP_
+
+#include "Exception.hpp"
+
+#include "../Engine/Graphics.hpp"
+#include "../Helper/File.hpp"
+#include "../Helper/JsonReader.hpp"
+#include "../Helper/JsonWriter.hpp"
+#include "../Helper/Log.hpp"
+#include "../Helper/Statistics.hpp"
+#include "../Helper/TimerHighRes.hpp"
+#include "../Helper/Trace.hpp"
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Struct/AppInfo.hpp"
+#include "../Struct/BenchmarkSettings.hpp"
+#include "../Struct/StartupStage.hpp"
+#include "../Wrapper/VulkanDeviceMemory.hpp"
+
+#include <algorithm>	// std::max, std::min
+#include <exception>	// std::exception
+#include <iomanip>		// std::fixed, std::setprecision
+#include <map>			// std::map
+#include <string>		// std::stod, std::stoull, std::string, std::to_string
+#include <vector>		// std::vector
+
+namespace spacelite::Main {
+
+	class Benchmark {
+	public:
+		Benchmark(int argc, char * argv[]);
+
+		// getters
+		bool isEnabled() const;
+		const Struct::BenchmarkSettings& getSettings() const;
+
+		// start measuring (after the startup)
+		void start();
+
+		// count a frame and return whether to continue
+		bool tick();
+
+		// write the JSON report and compare it to the baseline (if given), returning whether no slowdowns have been found
+		bool writeReport(const Struct::AppInfo& appInfo, const Engine::Graphics& graphics, double windowStartupTime) const;
+
+	private:
+		Struct::BenchmarkSettings settings;
+
+		Helper::TimerHighRes frameTimer;
+		Helper::TimerHighRes durationTimer;
+		unsigned long long numberOfFrames;	// including the warm-up frames
+		std::vector<double> frameTimes;		// in ms, without the warm-up frames
+		double measuredTime;				// in s
+
+		static Struct::BenchmarkSettings parseArguments(int argc, char * argv[]);
+		static unsigned long long parseCount(const std::string& value);
+		static std::string getDeviceType(VkPhysicalDeviceType type);
+		static std::string getVersion(unsigned int version);
+		static void writeStages(Helper::JsonWriter& json, const std::vector<Struct::StartupStage>& stages);
+		static bool isCompared(const std::string& key);
+
+		bool compare(const std::string& report) const;
+
+		// exception sub-class
+		MAIN_EXCEPTION_CLASS();
+	};
+
+} /* spacelite::Main */
+
+#endif /* SRC_MAIN_BENCHMARK_HPP_ */
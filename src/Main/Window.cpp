@@ -14,27 +14,21 @@ namespace spacelite::Main {
 unsigned short Window::numGlfwUsers = 0;
 
 Window::Window(const Struct::WinProp& properties)
-		: ptr(nullptr), width(properties.width), height(properties.height), resized(false) {
+		:	ptr(nullptr),
+			title(properties.title),
+			visible(properties.visible),
+			width(properties.width),
+			height(properties.height),
+			resized(false),
+			damaged(true),
+			focused(true),
+			iconified(false) {
 	// initialize GLFW (if still necessary)
 	if(!glfwInit())
 		throw Exception("Could not initialize GLFW: " + Wrapper::GlfwError().str());
 
 	// increase number of GLFW users
 	++Window::numGlfwUsers;
-
-	// disable OpenGL context creation (using Vulkan instead)
-	glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-
-	// create window
-	this->ptr = glfwCreateWindow(this->width, this->height, properties.title.c_str(), nullptr, nullptr);
-
-	if(!(this->ptr))
-		throw Exception("Could not create window: " + Wrapper::GlfwError().str());
-
-	glfwSetWindowUserPointer(this->ptr, this);
-	glfwSetFramebufferSizeCallback(this->ptr, this->resizeCallback);
-
-	glfwMakeContextCurrent(this->ptr);
 }
 
 Window::~Window() {
@@ -51,6 +45,32 @@ Window::~Window() {
 		--Window::numGlfwUsers;
 }
 
+// create the window (if it has not been created yet)
+Window& Window::open() {
+	if(this->ptr)
+		return *this;
+
+	// disable OpenGL context creation (using Vulkan instead)
+	glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+
+	// hide window if necessary (e.g. for headless benchmarks)
+	glfwWindowHint(GLFW_VISIBLE, this->visible ? GLFW_TRUE : GLFW_FALSE);
+
+	// create window
+	this->ptr = glfwCreateWindow(this->width, this->height, this->title.c_str(), nullptr, nullptr);
+
+	if(!(this->ptr))
+		throw Exception("Could not create window: " + Wrapper::GlfwError().str());
+
+	glfwSetWindowUserPointer(this->ptr, this);
+	glfwSetFramebufferSizeCallback(this->ptr, this->resizeCallback);
+	glfwSetWindowRefreshCallback(this->ptr, this->refreshCallback);
+	glfwSetWindowFocusCallback(this->ptr, this->focusCallback);
+	glfwSetWindowIconifyCallback(this->ptr, this->iconifyCallback);
+
+	return *this;
+}
+
 // get string with API information
 std::string Window::getInfo() {
 	return std::string("GLFW v") + glfwGetVersionString();
@@ -81,11 +101,28 @@ bool Window::isResized() const {
 	return this->resized;
 }
 
-// run tick: swap front and back buffers, poll for window events
-void Window::tick() {
-	glfwSwapBuffers(this->ptr);
+// get whether the contents of the window need to be drawn again (e.g. because it has been uncovered)
+bool Window::isDamaged() const {
+	return this->damaged;
+}
+
+// get whether the window has input focus
+bool Window::isFocused() const {
+	return this->focused;
+}
+
+// get whether the window has been iconified (i.e. minimized)
+bool Window::isIconified() const {
+	return this->iconified;
+}
 
-	glfwPollEvents();
+// run tick: poll for window events (or wait for them, if a timeout is given)
+//  NOTE:	Buffers are not swapped, because the window has no OpenGL context (presentation is done by Vulkan).
+void Window::tick(double waitTimeout) {
+	if(waitTimeout > 0.)
+		glfwWaitEventsTimeout(waitTimeout);
+	else
+		glfwPollEvents();
 }
 
 // update the dimension of the window
@@ -104,18 +141,36 @@ void Window::resetResize() {
 	this->resized = false;
 }
 
+// reset damage state
+void Window::resetDamage() {
+	this->damaged = false;
+}
+
 // move constructor
 Window::Window(Window&& other) noexcept
-		:	ptr(other.ptr), width(other.width), height(other.height), resized(other.resized) {
+		:	ptr(other.ptr),
+			title(std::move(other.title)),
+			visible(other.visible),
+			width(other.width),
+			height(other.height),
+			resized(other.resized),
+			damaged(other.damaged),
+			focused(other.focused),
+			iconified(other.iconified) {
 	other.ptr = nullptr;
 }
 
 // move assignment
 Window& Window::operator=(Window&& other) noexcept {
 	this->ptr = other.ptr;
+	this->title = std::move(other.title);
+	this->visible = other.visible;
 	this->width = other.width;
 	this->height = other.height;
 	this->resized = other.resized;
+	this->damaged = other.damaged;
+	this->focused = other.focused;
+	this->iconified = other.iconified;
 
 	other.ptr = nullptr;
 
@@ -132,4 +187,28 @@ void Window::resizeCallback(GLFWwindow* window, int w, int h) {
 	thisPtr->height = static_cast<unsigned int>(h);
 }
 
+// callback for window contents needing to be drawn again
+void Window::refreshCallback(GLFWwindow* window) {
+	auto thisPtr = reinterpret_cast<Window *>(glfwGetWindowUserPointer(window));
+
+	thisPtr->damaged = true;
+}
+
+// callback for window gaining or losing input focus
+void Window::focusCallback(GLFWwindow* window, int focused) {
+	auto thisPtr = reinterpret_cast<Window *>(glfwGetWindowUserPointer(window));
+
+	thisPtr->focused = focused == GLFW_TRUE;
+}
+
+// callback for window being iconified or restored (needs to be drawn again afterwards)
+void Window::iconifyCallback(GLFWwindow* window, int iconified) {
+	auto thisPtr = reinterpret_cast<Window *>(glfwGetWindowUserPointer(window));
+
+	thisPtr->iconified = iconified == GLFW_TRUE;
+
+	if(!(thisPtr->iconified))
+		thisPtr->damaged = true;
+}
+
 } /* spacelite::Main */
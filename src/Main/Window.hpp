@@ -3,6 +3,9 @@
  *
  * Window using GLFW.
  *
+ * GLFW is initialized on construction, while the window itself is only created by open(),
+ *  so that other work (e.g. creating the Vulkan API instance) can be done in parallel.
+ *
  *  Created on: Sep 12, 2019
  *      Author: ans
  */
@@ -18,6 +21,7 @@
 #include <GLFW/glfw3.h>
 
 #include <string>	// std::string
+#include <utility>	// std::move
 
 namespace spacelite::Main {
 
@@ -26,6 +30,9 @@ namespace spacelite::Main {
 		Window(const Struct::WinProp& properties);
 		virtual ~Window();
 
+		// create the window (if it has not been created yet, needs to be called from the main thread)
+		Window& open();
+
 		// getters
 		static std::string getInfo();
 		bool isClosed() const;
@@ -33,13 +40,17 @@ namespace spacelite::Main {
 		unsigned int getWidth() const;
 		unsigned int getHeight() const;
 		bool isResized() const;
+		bool isDamaged() const;
+		bool isFocused() const;
+		bool isIconified() const;
 
-		// perform tick
-		void tick();
+		// perform tick (polling for events or waiting for them up to the given number of seconds)
+		void tick(double waitTimeout = 0.);
 
 		// update state
 		void updateSize();
 		void resetResize();
+		void resetDamage();
 
 		// not copyable, only moveable
 		Window(const Window&) = delete;
@@ -55,12 +66,20 @@ namespace spacelite::Main {
 		static unsigned short numGlfwUsers;
 
 		// window properties
+		std::string title;
+		bool visible;
 		unsigned int width;
 		unsigned int height;
 		bool resized;
+		bool damaged;
+		bool focused;
+		bool iconified;
 
-		// callback
+		// callbacks
 		static void resizeCallback(GLFWwindow * window, int width, int height);
+		static void refreshCallback(GLFWwindow * window);
+		static void focusCallback(GLFWwindow * window, int focused);
+		static void iconifyCallback(GLFWwindow * window, int iconified);
 
 		// exception sub-class
 		MAIN_EXCEPTION_CLASS();
@@ -0,0 +1,35 @@
+/*
+ * BenchmarkSettings.hpp
+ *
+ * Settings of a benchmark run (parsed from the command line).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_BENCHMARKSETTINGS_HPP_
+#define SRC_STRUCT_BENCHMARKSETTINGS_HPP_
+
+#include <string>	// std::string
+
+namespace spacelite::Struct {
+
+	struct BenchmarkSettings {
+		bool enabled = false;
+		unsigned long long frames = 0;			// number of measured frames (zero: run for the duration instead)
+		double duration = 0.;					// duration of the measurement in s (zero: run for the frames instead)
+		unsigned long long warmUpFrames = 0;	// number of frames to discard before measuring
+		bool headless = false;					// hide the window
+		std::string scene;						// synthetic scene to render
+		std::string reportFile;					// file to write the JSON report to
+		std::string baselineFile;				// report to compare the results to (empty: no comparison)
+		double tolerance = 0.;					// tolerated relative slowdown compared to the baseline
+		double toleranceTime = 0.;				// tolerated absolute slowdown compared to the baseline (in ms)
+		std::string traceFile;					// file to write the trace to (empty: no tracing)
+		std::string renderGraphFile;			// file to export the render graph to (empty: no export)
+		std::string logLevel;					// minimum severity of logged messages
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_BENCHMARKSETTINGS_HPP_ */
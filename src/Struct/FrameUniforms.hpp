@@ -0,0 +1,23 @@
+/*
+ * FrameUniforms.hpp
+ *
+ * Per-frame uniform data passed to the shaders (needs to match the uniform block in the shaders).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_FRAMEUNIFORMS_HPP_
+#define SRC_STRUCT_FRAMEUNIFORMS_HPP_
+
+#include <glm/glm.hpp>
+
+namespace spacelite::Struct {
+
+	struct FrameUniforms {
+		glm::mat4 viewProjection;
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_FRAMEUNIFORMS_HPP_ */
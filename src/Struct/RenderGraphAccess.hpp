@@ -0,0 +1,171 @@
+/*
+ * RenderGraphAccess.hpp
+ *
+ * Access of a pass in a render graph to one of its images.
+ *
+ * The usage decides about the layout of the image and the pipeline stages and memory accesses to synchronize with.
+ *
+ * Passes that transition the image themselves (e.g. using a render pass object) specify the layout
+ *  they leave the image in, so that the render graph does not transition it for them.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_RENDERGRAPHACCESS_HPP_
+#define SRC_STRUCT_RENDERGRAPHACCESS_HPP_
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstddef>	// std::size_t
+
+namespace spacelite::Struct {
+
+	struct RenderGraphAccess {
+		enum class Usage {
+			colorAttachment,
+			depthAttachment,
+			sampled,
+			storage,
+			transferSource,
+			transferDestination
+		};
+
+		std::size_t resource = 0;
+		Usage usage = Usage::colorAttachment;
+		bool write = false;
+		VkImageLayout layoutAfter = VK_IMAGE_LAYOUT_UNDEFINED; // undefined: the pass does not transition the image
+
+		// check whether the pass transitions the image itself
+		bool isSelfTransitioned() const {
+			return this->layoutAfter != VK_IMAGE_LAYOUT_UNDEFINED;
+		}
+
+		// get the name of the usage (e.g. for exporting the render graph)
+		const char * getUsageName() const {
+			switch(this->usage) {
+			case Usage::colorAttachment:
+				return "color attachment";
+
+			case Usage::depthAttachment:
+				return "depth attachment";
+
+			case Usage::sampled:
+				return "sampled";
+
+			case Usage::storage:
+				return "storage";
+
+			case Usage::transferSource:
+				return "transfer source";
+
+			case Usage::transferDestination:
+				return "transfer destination";
+			}
+
+			return "unknown";
+		}
+
+		// get the layout the image needs to be in during the pass
+		VkImageLayout getLayout() const {
+			switch(this->usage) {
+			case Usage::colorAttachment:
+				return VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+			case Usage::depthAttachment:
+				return this->write ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+						: VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+
+			case Usage::sampled:
+				return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+			case Usage::storage:
+				return VK_IMAGE_LAYOUT_GENERAL;
+
+			case Usage::transferSource:
+				return VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+			case Usage::transferDestination:
+				return VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+			}
+
+			return VK_IMAGE_LAYOUT_GENERAL;
+		}
+
+		// get the pipeline stages accessing the image during the pass
+		VkPipelineStageFlags getStages() const {
+			switch(this->usage) {
+			case Usage::colorAttachment:
+				return VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+			case Usage::depthAttachment:
+				return VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+
+			case Usage::sampled:
+			case Usage::storage:
+				return VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+			case Usage::transferSource:
+			case Usage::transferDestination:
+				return VK_PIPELINE_STAGE_TRANSFER_BIT;
+			}
+
+			return VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+		}
+
+		// get the memory accesses to the image during the pass
+		VkAccessFlags getAccess() const {
+			switch(this->usage) {
+			case Usage::colorAttachment:
+				return this->write ? VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_READ_BIT
+						: VK_ACCESS_COLOR_ATTACHMENT_READ_BIT;
+
+			case Usage::depthAttachment:
+				return this->write ? VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT
+						: VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
+
+			case Usage::sampled:
+				return VK_ACCESS_SHADER_READ_BIT;
+
+			case Usage::storage:
+				return this->write ? VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT : VK_ACCESS_SHADER_READ_BIT;
+
+			case Usage::transferSource:
+				return VK_ACCESS_TRANSFER_READ_BIT;
+
+			case Usage::transferDestination:
+				return VK_ACCESS_TRANSFER_WRITE_BIT;
+			}
+
+			return VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+		}
+
+		// get the image usage needed for the access
+		VkImageUsageFlags getImageUsage() const {
+			switch(this->usage) {
+			case Usage::colorAttachment:
+				return VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+
+			case Usage::depthAttachment:
+				return VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+
+			case Usage::sampled:
+				return VK_IMAGE_USAGE_SAMPLED_BIT;
+
+			case Usage::storage:
+				return VK_IMAGE_USAGE_STORAGE_BIT;
+
+			case Usage::transferSource:
+				return VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+
+			case Usage::transferDestination:
+				return VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+			}
+
+			return 0;
+		}
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_RENDERGRAPHACCESS_HPP_ */
@@ -0,0 +1,37 @@
+/*
+ * RenderGraphResource.hpp
+ *
+ * Description of an image used by the passes of a render graph.
+ *
+ * Transient images are created (and aliased) by the render graph, imported images (e.g. swap chain images)
+ *  are created elsewhere and need to be set before the render graph is executed.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_RENDERGRAPHRESOURCE_HPP_
+#define SRC_STRUCT_RENDERGRAPHRESOURCE_HPP_
+
+#include <vulkan/vulkan_core.h>
+
+#include <string>	// std::string
+
+namespace spacelite::Struct {
+
+	struct RenderGraphResource {
+		std::string name;
+		VkFormat format = VK_FORMAT_UNDEFINED;
+		VkExtent2D extent = { 0, 0 };
+		VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+		VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+
+		// imported images only
+		bool imported = false;
+		VkImageLayout initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;	// layout at the beginning of each frame
+		VkImageLayout finalLayout = VK_IMAGE_LAYOUT_UNDEFINED;		// layout needed after the frame (undefined: keep)
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_RENDERGRAPHRESOURCE_HPP_ */
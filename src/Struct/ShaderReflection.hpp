@@ -0,0 +1,41 @@
+/*
+ * ShaderReflection.hpp
+ *
+ * Resources used by a shader module, as reflected from its SPIR-V code.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_SHADERREFLECTION_HPP_
+#define SRC_STRUCT_SHADERREFLECTION_HPP_
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>	// std::uint32_t
+#include <vector>	// std::vector
+
+namespace spacelite::Struct {
+
+	struct ShaderReflection {
+		struct DescriptorBinding {
+			std::uint32_t set;
+			std::uint32_t binding;
+			VkDescriptorType type;
+			std::uint32_t count;
+		};
+
+		struct VertexInput {
+			std::uint32_t location;
+			VkFormat format;
+		};
+
+		VkShaderStageFlagBits stage = VK_SHADER_STAGE_VERTEX_BIT;
+		std::vector<DescriptorBinding> descriptorBindings;
+		std::vector<VkPushConstantRange> pushConstantRanges;
+		std::vector<VertexInput> vertexInputs; // vertex shaders only
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_SHADERREFLECTION_HPP_ */
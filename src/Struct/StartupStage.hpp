@@ -0,0 +1,26 @@
+/*
+ * StartupStage.hpp
+ *
+ * Time needed by a stage of the startup and its sub-stages (e.g. for reports).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_STARTUPSTAGE_HPP_
+#define SRC_STRUCT_STARTUPSTAGE_HPP_
+
+#include <string>	// std::string
+#include <vector>	// std::vector
+
+namespace spacelite::Struct {
+
+	struct StartupStage {
+		std::string name;
+		double time = 0.;	// in ms
+		std::vector<StartupStage> children{};
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_STARTUPSTAGE_HPP_ */
@@ -0,0 +1,68 @@
+/*
+ * VulkanCapabilities.hpp
+ *
+ * Optional features and extensions that have been enabled on a logical device using the Vulkan API.
+ *
+ * Subsystems use these to choose the fastest available path at runtime.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_VULKANCAPABILITIES_HPP_
+#define SRC_STRUCT_VULKANCAPABILITIES_HPP_
+
+#include <vulkan/vulkan_core.h>
+
+#include <string>	// std::string, std::to_string
+
+namespace spacelite::Struct {
+
+	struct VulkanCapabilities {
+		unsigned int apiVersion = VK_API_VERSION_1_0;	// used by the logical device
+
+		bool timelineSemaphores = false;
+		bool synchronization2 = false;
+		bool dynamicRendering = false;
+		bool bufferDeviceAddress = false;
+		bool memoryBudget = false;
+		bool samplerAnisotropy = false;
+		bool calibratedTimestamps = false;
+
+		// get a human-readable list of the enabled capabilities
+		std::string str() const {
+			std::string result(
+					"Vulkan API v"
+					+ std::to_string(VK_VERSION_MAJOR(this->apiVersion))
+					+ "."
+					+ std::to_string(VK_VERSION_MINOR(this->apiVersion))
+			);
+
+			if(this->timelineSemaphores)
+				result += ", timeline semaphores";
+
+			if(this->synchronization2)
+				result += ", synchronization2";
+
+			if(this->dynamicRendering)
+				result += ", dynamic rendering";
+
+			if(this->bufferDeviceAddress)
+				result += ", buffer device address";
+
+			if(this->memoryBudget)
+				result += ", memory budget";
+
+			if(this->samplerAnisotropy)
+				result += ", anisotropic filtering";
+
+			if(this->calibratedTimestamps)
+				result += ", calibrated timestamps";
+
+			return result;
+		}
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_VULKANCAPABILITIES_HPP_ */
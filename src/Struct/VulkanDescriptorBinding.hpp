@@ -0,0 +1,80 @@
+/*
+ * VulkanDescriptorBinding.hpp
+ *
+ * Hashable description of the resource bound to one binding of a descriptor set used by the Vulkan API.
+ *
+ * Depending on the type of the descriptor, either the buffer or the image information will be used.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_VULKANDESCRIPTORBINDING_HPP_
+#define SRC_STRUCT_VULKANDESCRIPTORBINDING_HPP_
+
+#include "../Helper/Hash.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstddef>	// std::size_t
+#include <cstdint>	// std::uint32_t
+
+namespace spacelite::Struct {
+
+	struct VulkanDescriptorBinding {
+		std::uint32_t binding = 0;
+		VkDescriptorType type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+		VkDescriptorBufferInfo buffer = {};
+		VkDescriptorImageInfo image = {};
+
+		// check whether the descriptor refers to a buffer
+		bool isBuffer() const {
+			return this->type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+					|| this->type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC
+					|| this->type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+					|| this->type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+		}
+
+		// get a hash of the binding
+		std::size_t hash() const {
+			std::size_t result = 0;
+
+			Helper::Hash::combine(result, this->binding);
+			Helper::Hash::combine(result, static_cast<int>(this->type));
+
+			if(this->isBuffer()) {
+				Helper::Hash::combine(result, this->buffer.buffer);
+				Helper::Hash::combine(result, this->buffer.offset);
+				Helper::Hash::combine(result, this->buffer.range);
+			}
+			else {
+				Helper::Hash::combine(result, this->image.sampler);
+				Helper::Hash::combine(result, this->image.imageView);
+				Helper::Hash::combine(result, static_cast<int>(this->image.imageLayout));
+			}
+
+			return result;
+		}
+
+		bool operator==(const VulkanDescriptorBinding& other) const {
+			if(this->binding != other.binding || this->type != other.type)
+				return false;
+
+			if(this->isBuffer())
+				return this->buffer.buffer == other.buffer.buffer
+						&& this->buffer.offset == other.buffer.offset
+						&& this->buffer.range == other.buffer.range;
+
+			return this->image.sampler == other.image.sampler
+					&& this->image.imageView == other.image.imageView
+					&& this->image.imageLayout == other.image.imageLayout;
+		}
+
+		bool operator!=(const VulkanDescriptorBinding& other) const {
+			return !(*this == other);
+		}
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_VULKANDESCRIPTORBINDING_HPP_ */
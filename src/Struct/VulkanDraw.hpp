@@ -0,0 +1,39 @@
+/*
+ * VulkanDraw.hpp
+ *
+ * A draw call to be recorded into a command buffer using the Vulkan API.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_VULKANDRAW_HPP_
+#define SRC_STRUCT_VULKANDRAW_HPP_
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan_core.h>
+
+#include <cstddef>	// std::size_t
+
+namespace spacelite::Struct {
+
+	struct VulkanDraw {
+		std::size_t pipeline;		// ID of the pipeline in the pipeline cache
+		unsigned int firstVertex;
+		unsigned int numberOfVertices;
+		glm::mat4 transform = glm::mat4(1.0f);	// per-draw data (passed as push constants)
+		unsigned int pass = 1;		// draws of the depth prepass (0) need to be recorded before all other draws
+		VkBuffer vertexBuffer = VK_NULL_HANDLE;	// own vertex buffer (e.g. written by a compute shader), if any
+
+		// sort draws by pass, then by pipeline to minimize the number of pipeline binds
+		bool operator<(const VulkanDraw& other) const {
+			if(this->pass != other.pass)
+				return this->pass < other.pass;
+
+			return this->pipeline < other.pipeline;
+		}
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_VULKANDRAW_HPP_ */
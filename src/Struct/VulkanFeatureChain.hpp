@@ -0,0 +1,105 @@
+/*
+ * VulkanFeatureChain.hpp
+ *
+ * Chain of structures used to query and enable the (optional) features of a device using the Vulkan API.
+ *
+ * The structures of the single features are used, because they are valid for devices supporting the features
+ *  either as part of the core API (Vulkan 1.2/1.3) or by providing the corresponding extensions (Vulkan 1.1).
+ *  Structures unknown to the Vulkan headers are left out at compile time.
+ *
+ * NOTE:	The chain points into the structure itself, so it needs to be linked again after copying it.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_VULKANFEATURECHAIN_HPP_
+#define SRC_STRUCT_VULKANFEATURECHAIN_HPP_
+
+#include <vulkan/vulkan_core.h>
+
+#include <set>		// std::set
+#include <string>	// std::string
+
+namespace spacelite::Struct {
+
+	struct VulkanFeatureChain {
+		VkPhysicalDeviceFeatures2 core = {};
+#ifdef VK_KHR_timeline_semaphore
+		VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphore = {};
+#endif
+#ifdef VK_KHR_synchronization2
+		VkPhysicalDeviceSynchronization2FeaturesKHR synchronization2 = {};
+#endif
+#ifdef VK_KHR_dynamic_rendering
+		VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRendering = {};
+#endif
+#ifdef VK_KHR_buffer_device_address
+		VkPhysicalDeviceBufferDeviceAddressFeaturesKHR bufferDeviceAddress = {};
+#endif
+
+		// link the structures supported by a device with the specified API version and enabled extensions
+		//  NOTE:	The contents of the structures will not be changed.
+		VkPhysicalDeviceFeatures2 * link(unsigned int apiVersion, const std::set<std::string>& extensions) {
+			void ** next = &(this->core.pNext);
+
+			this->core.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+			this->core.pNext = nullptr;
+
+			const auto add = [&next, apiVersion, &extensions](
+					auto& structure,
+					VkStructureType type,
+					unsigned int promotedTo,
+					const char * extension
+			) {
+				if(apiVersion < promotedTo && !extensions.count(extension))
+					return;
+
+				structure.sType = type;
+				structure.pNext = nullptr;
+
+				*next = &structure;
+
+				next = &(structure.pNext);
+			};
+
+#ifdef VK_KHR_timeline_semaphore
+			add(
+					this->timelineSemaphore,
+					VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+					VK_MAKE_VERSION(1, 2, 0),
+					VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME
+			);
+#endif
+#ifdef VK_KHR_synchronization2
+			add(
+					this->synchronization2,
+					VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR,
+					VK_MAKE_VERSION(1, 3, 0),
+					VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME
+			);
+#endif
+#ifdef VK_KHR_dynamic_rendering
+			add(
+					this->dynamicRendering,
+					VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR,
+					VK_MAKE_VERSION(1, 3, 0),
+					VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME
+			);
+#endif
+#ifdef VK_KHR_buffer_device_address
+			add(
+					this->bufferDeviceAddress,
+					VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_KHR,
+					VK_MAKE_VERSION(1, 2, 0),
+					VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME
+			);
+#endif
+
+			return &(this->core);
+		}
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_VULKANFEATURECHAIN_HPP_ */
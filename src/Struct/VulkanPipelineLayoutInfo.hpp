@@ -0,0 +1,89 @@
+/*
+ * VulkanPipelineLayoutInfo.hpp
+ *
+ * Hashable description of a pipeline layout used by the Vulkan API, i.e. its descriptor set layouts and push constants.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_VULKANPIPELINELAYOUTINFO_HPP_
+#define SRC_STRUCT_VULKANPIPELINELAYOUTINFO_HPP_
+
+#include "../Helper/Hash.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstddef>	// std::size_t
+#include <vector>	// std::vector
+
+namespace spacelite::Struct {
+
+	struct VulkanPipelineLayoutInfo {
+		std::vector<std::vector<VkDescriptorSetLayoutBinding>> sets; // bindings sorted by binding number, per set number
+		std::vector<VkPushConstantRange> pushConstantRanges;
+
+		// get a hash of the pipeline layout
+		std::size_t hash() const {
+			std::size_t result = 0;
+
+			for(const auto& set : this->sets) {
+				Helper::Hash::combine(result, set.size());
+
+				for(const auto& binding : set) {
+					Helper::Hash::combine(result, binding.binding);
+					Helper::Hash::combine(result, static_cast<int>(binding.descriptorType));
+					Helper::Hash::combine(result, binding.descriptorCount);
+					Helper::Hash::combine(result, binding.stageFlags);
+				}
+			}
+
+			for(const auto& range : this->pushConstantRanges) {
+				Helper::Hash::combine(result, range.stageFlags);
+				Helper::Hash::combine(result, range.offset);
+				Helper::Hash::combine(result, range.size);
+			}
+
+			return result;
+		}
+
+		bool operator==(const VulkanPipelineLayoutInfo& other) const {
+			if(
+					this->sets.size() != other.sets.size()
+					|| this->pushConstantRanges.size() != other.pushConstantRanges.size()
+			)
+				return false;
+
+			for(std::size_t n = 0; n < this->sets.size(); ++n) {
+				if(this->sets[n].size() != other.sets[n].size())
+					return false;
+
+				for(std::size_t m = 0; m < this->sets[n].size(); ++m)
+					if(
+							this->sets[n][m].binding != other.sets[n][m].binding
+							|| this->sets[n][m].descriptorType != other.sets[n][m].descriptorType
+							|| this->sets[n][m].descriptorCount != other.sets[n][m].descriptorCount
+							|| this->sets[n][m].stageFlags != other.sets[n][m].stageFlags
+					)
+						return false;
+			}
+
+			for(std::size_t n = 0; n < this->pushConstantRanges.size(); ++n)
+				if(
+						this->pushConstantRanges[n].stageFlags != other.pushConstantRanges[n].stageFlags
+						|| this->pushConstantRanges[n].offset != other.pushConstantRanges[n].offset
+						|| this->pushConstantRanges[n].size != other.pushConstantRanges[n].size
+				)
+					return false;
+
+			return true;
+		}
+
+		bool operator!=(const VulkanPipelineLayoutInfo& other) const {
+			return !(*this == other);
+		}
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_VULKANPIPELINELAYOUTINFO_HPP_ */
@@ -0,0 +1,27 @@
+/*
+ * VulkanPipelineRequest.hpp
+ *
+ * Everything needed to request a graphics pipeline from the pipeline cache using the Vulkan API.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_VULKANPIPELINEREQUEST_HPP_
+#define SRC_STRUCT_VULKANPIPELINEREQUEST_HPP_
+
+#include "ShaderFiles.hpp"
+#include "VulkanPipelineState.hpp"
+#include "VulkanSpecialization.hpp"
+
+namespace spacelite::Struct {
+
+	struct VulkanPipelineRequest {
+		ShaderFiles shaderFiles;
+		VulkanPipelineState state;
+		ShaderConstants constants;
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_VULKANPIPELINEREQUEST_HPP_ */
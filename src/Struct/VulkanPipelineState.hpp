@@ -0,0 +1,87 @@
+/*
+ * VulkanPipelineState.hpp
+ *
+ * Hashable description of the fixed-function state of a graphics pipeline used by the Vulkan API.
+ *
+ * Viewport and scissor are not part of the state, because they are set dynamically.
+ *  The number of samples is not part of the state either, because it is decided by the render pass.
+ *
+ * Depth-only pipelines do not use the fragment shader and do not write any color,
+ *  so that they can be used for a depth prepass.
+ *
+ * Pipelines without vertex input (e.g. for drawing a fullscreen triangle) generate their vertices in the vertex shader.
+ *  Pipelines for the post-processing subpass (#1) of a render pass use neither depth nor multisampling.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_VULKANPIPELINESTATE_HPP_
+#define SRC_STRUCT_VULKANPIPELINESTATE_HPP_
+
+#include "../Helper/Hash.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstddef>	// std::size_t
+#include <cstdint>	// std::uint32_t
+
+namespace spacelite::Struct {
+
+	struct VulkanPipelineState {
+		VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		VkPolygonMode polygonMode = VK_POLYGON_MODE_FILL;
+		VkCullModeFlags cullMode = VK_CULL_MODE_BACK_BIT;
+		VkFrontFace frontFace = VK_FRONT_FACE_CLOCKWISE;
+		float lineWidth = 1.0f;
+		bool alphaBlending = false;
+		bool depthTest = true;
+		bool depthWrite = true;
+		VkCompareOp depthCompareOp = VK_COMPARE_OP_LESS;
+		bool depthOnly = false;
+		bool vertexInput = true;
+		std::uint32_t subpass = 0;
+
+		// get a hash of the pipeline state
+		std::size_t hash() const {
+			std::size_t result = 0;
+
+			Helper::Hash::combine(result, static_cast<int>(this->topology));
+			Helper::Hash::combine(result, static_cast<int>(this->polygonMode));
+			Helper::Hash::combine(result, static_cast<unsigned int>(this->cullMode));
+			Helper::Hash::combine(result, static_cast<int>(this->frontFace));
+			Helper::Hash::combine(result, this->lineWidth);
+			Helper::Hash::combine(result, this->alphaBlending);
+			Helper::Hash::combine(result, this->depthTest);
+			Helper::Hash::combine(result, this->depthWrite);
+			Helper::Hash::combine(result, static_cast<int>(this->depthCompareOp));
+			Helper::Hash::combine(result, this->depthOnly);
+			Helper::Hash::combine(result, this->vertexInput);
+			Helper::Hash::combine(result, this->subpass);
+
+			return result;
+		}
+
+		bool operator==(const VulkanPipelineState& other) const {
+			return this->topology == other.topology
+					&& this->polygonMode == other.polygonMode
+					&& this->cullMode == other.cullMode
+					&& this->frontFace == other.frontFace
+					&& this->lineWidth == other.lineWidth
+					&& this->alphaBlending == other.alphaBlending
+					&& this->depthTest == other.depthTest
+					&& this->depthWrite == other.depthWrite
+					&& this->depthCompareOp == other.depthCompareOp
+					&& this->depthOnly == other.depthOnly
+					&& this->vertexInput == other.vertexInput
+					&& this->subpass == other.subpass;
+		}
+
+		bool operator!=(const VulkanPipelineState& other) const {
+			return !(*this == other);
+		}
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_VULKANPIPELINESTATE_HPP_ */
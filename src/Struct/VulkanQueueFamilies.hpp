@@ -3,6 +3,10 @@
  *
  * Indices for the graphics and family queue of a device using the Vulkan API.
  *
+ * Compute and transfer families are only set if the device has dedicated families for them
+ *  (i.e. families without graphics support, and for transfer also without compute support),
+ *  so that work on them can run in parallel to the graphics queue.
+ *
  *  Created on: Sep 12, 2019
  *      Author: ans
  */
@@ -17,10 +21,22 @@ namespace spacelite::Struct {
 	struct VulkanQueueFamilies {
 		std::optional<unsigned int> graphicsFamily;
 		std::optional<unsigned int> presentFamily;
+		std::optional<unsigned int> computeFamily;	// dedicated compute family (if available)
+		std::optional<unsigned int> transferFamily;	// dedicated transfer family (if available)
 
 		bool isComplete() const {
 			return this->graphicsFamily.has_value() && this->presentFamily.has_value();
 		}
+
+		// get the family to be used for compute work (falls back to the graphics family)
+		unsigned int getComputeFamily() const {
+			return this->computeFamily.value_or(this->graphicsFamily.value());
+		}
+
+		// get the family to be used for transfers (falls back to the compute family)
+		unsigned int getTransferFamily() const {
+			return this->transferFamily.value_or(this->getComputeFamily());
+		}
 	};
 
 } /* spacelite::Struct */
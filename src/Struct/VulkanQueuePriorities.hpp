@@ -0,0 +1,25 @@
+/*
+ * VulkanQueuePriorities.hpp
+ *
+ * Priorities of the queues of a logical device using the Vulkan API (between 0.0 and 1.0).
+ *
+ * Queues sharing the same family share one queue (using the highest of their priorities).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_VULKANQUEUEPRIORITIES_HPP_
+#define SRC_STRUCT_VULKANQUEUEPRIORITIES_HPP_
+
+namespace spacelite::Struct {
+
+	struct VulkanQueuePriorities {
+		float graphics = 1.0f;	// includes presentation
+		float compute = 0.5f;
+		float transfer = 0.5f;
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_VULKANQUEUEPRIORITIES_HPP_ */
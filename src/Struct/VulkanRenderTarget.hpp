@@ -0,0 +1,36 @@
+/*
+ * VulkanRenderTarget.hpp
+ *
+ * Image to be rendered into using the Vulkan API.
+ *
+ * The frame buffer is only used by render pass objects, not by dynamic rendering.
+ *  The depth buffer is optional, the multisampled image is only used when multisampling (and resolved into the image).
+ *  The input image is only used by render passes with a post-processing subpass, which reads the scene from it.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_VULKANRENDERTARGET_HPP_
+#define SRC_STRUCT_VULKANRENDERTARGET_HPP_
+
+#include <vulkan/vulkan_core.h>
+
+namespace spacelite::Struct {
+
+	struct VulkanRenderTarget {
+		VkImage image = VK_NULL_HANDLE;
+		VkImageView imageView = VK_NULL_HANDLE;
+		VkImage depthImage = VK_NULL_HANDLE;
+		VkImageView depthImageView = VK_NULL_HANDLE;
+		VkImage multisampledImage = VK_NULL_HANDLE;
+		VkImageView multisampledImageView = VK_NULL_HANDLE;
+		VkImage inputImage = VK_NULL_HANDLE;
+		VkImageView inputImageView = VK_NULL_HANDLE;
+		VkFramebuffer frameBuffer = VK_NULL_HANDLE;
+		VkExtent2D extent = { 0, 0 };
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_VULKANRENDERTARGET_HPP_ */
@@ -3,6 +3,8 @@
  *
  * Validation layers and extensions required from the device using the Vulkan API.
  *
+ * Optional extensions will be enabled only if they are supported by the device.
+ *
  *  Created on: Sep 12, 2019
  *      Author: ans
  */
@@ -17,11 +19,15 @@ namespace spacelite::Struct {
 	struct VulkanRequirements {
 		std::vector<const char *> validationLayers;
 		std::vector<const char *> deviceExtensions;
+		std::vector<const char *> optionalDeviceExtensions;
 
 		VulkanRequirements(
 				const std::vector<const char *>& requiredValidationLayers,
-				const std::vector<const char *>& requiredDeviceExtensions
-		) : validationLayers(requiredValidationLayers), deviceExtensions(requiredDeviceExtensions) {}
+				const std::vector<const char *>& requiredDeviceExtensions,
+				const std::vector<const char *>& supportedDeviceExtensions = {}
+		) :		validationLayers(requiredValidationLayers),
+				deviceExtensions(requiredDeviceExtensions),
+				optionalDeviceExtensions(supportedDeviceExtensions) {}
 	};
 
 } /* spacelite::Struct */
@@ -0,0 +1,185 @@
+/*
+ * VulkanSpecialization.hpp
+ *
+ * Typed specialization constants for one shader stage used by the Vulkan API.
+ *
+ * Values can be of the types bool (converted to VkBool32), std::int32_t, std::uint32_t, float or double.
+ *
+ * Values are stored ordered by the IDs of their constants, without gaps, so that the same constants
+ *  always result in the same data (and hash), no matter in which order they have been set.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_STRUCT_VULKANSPECIALIZATION_HPP_
+#define SRC_STRUCT_VULKANSPECIALIZATION_HPP_
+
+#include "../Helper/Hash.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <algorithm>	// std::lower_bound
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::int32_t, std::uint32_t
+#include <cstring>		// std::memcpy
+#include <type_traits>	// std::is_same_v
+#include <vector>		// std::vector
+
+namespace spacelite::Struct {
+
+	struct VulkanSpecialization {
+		std::vector<VkSpecializationMapEntry> entries;
+		std::vector<unsigned char> data;
+
+		// set the value of a specialization constant (overwrites an already set value)
+		template<typename T> VulkanSpecialization& set(std::uint32_t constantId, T value) {
+			static_assert(
+					std::is_same_v<T, bool>
+					|| std::is_same_v<T, std::int32_t>
+					|| std::is_same_v<T, std::uint32_t>
+					|| std::is_same_v<T, float>
+					|| std::is_same_v<T, double>,
+					"Unsupported type of specialization constant"
+			);
+
+			if constexpr(std::is_same_v<T, bool>)
+				return this->setRaw(constantId, static_cast<VkBool32>(value ? VK_TRUE : VK_FALSE));
+			else
+				return this->setRaw(constantId, value);
+		}
+
+		// check whether no specialization constants have been set
+		bool empty() const {
+			return this->entries.empty();
+		}
+
+		// get the specialization info (only valid as long as the constants are neither changed nor destroyed)
+		VkSpecializationInfo getInfo() const {
+			VkSpecializationInfo vulkanSpecializationInfo = {};
+
+			vulkanSpecializationInfo.mapEntryCount = static_cast<uint32_t>(this->entries.size());
+			vulkanSpecializationInfo.pMapEntries = this->entries.data();
+			vulkanSpecializationInfo.dataSize = this->data.size();
+			vulkanSpecializationInfo.pData = this->data.data();
+
+			return vulkanSpecializationInfo;
+		}
+
+		// get a hash of the specialization constants
+		std::size_t hash() const {
+			std::size_t result = 0;
+
+			for(const auto& entry : this->entries) {
+				Helper::Hash::combine(result, entry.constantID);
+				Helper::Hash::combine(result, entry.offset);
+				Helper::Hash::combine(result, entry.size);
+			}
+
+			for(const auto byte : this->data)
+				Helper::Hash::combine(result, byte);
+
+			return result;
+		}
+
+		bool operator==(const VulkanSpecialization& other) const {
+			if(this->entries.size() != other.entries.size() || this->data != other.data)
+				return false;
+
+			for(std::size_t n = 0; n < this->entries.size(); ++n)
+				if(
+						this->entries[n].constantID != other.entries[n].constantID
+						|| this->entries[n].offset != other.entries[n].offset
+						|| this->entries[n].size != other.entries[n].size
+				)
+					return false;
+
+			return true;
+		}
+
+		bool operator!=(const VulkanSpecialization& other) const {
+			return !(*this == other);
+		}
+
+	private:
+		// copy the raw value of a specialization constant into the data
+		template<typename T> VulkanSpecialization& setRaw(std::uint32_t constantId, T value) {
+			const auto it = std::lower_bound(
+					this->entries.begin(),
+					this->entries.end(),
+					constantId,
+					[](const auto& entry, std::uint32_t id) {
+						return entry.constantID < id;
+					}
+			);
+
+			if(it != this->entries.end() && it->constantID == constantId && it->size == sizeof(T)) {
+				std::memcpy(this->data.data() + it->offset, &value, sizeof(T));
+
+				return *this;
+			}
+
+			// re-build the data with the new (or resized) constant at its position
+			std::vector<VkSpecializationMapEntry> newEntries;
+			std::vector<unsigned char> newData;
+
+			newEntries.reserve(this->entries.size() + 1);
+			newData.reserve(this->data.size() + sizeof(T));
+
+			const auto append = [&newEntries, &newData](std::uint32_t id, const void * bytes, std::size_t size) {
+				VkSpecializationMapEntry vulkanEntry = {};
+
+				vulkanEntry.constantID = id;
+				vulkanEntry.offset = static_cast<uint32_t>(newData.size());
+				vulkanEntry.size = size;
+
+				newData.resize(newData.size() + size);
+
+				std::memcpy(newData.data() + vulkanEntry.offset, bytes, size);
+
+				newEntries.push_back(vulkanEntry);
+			};
+
+			for(auto entry = this->entries.begin(); entry != this->entries.end(); ++entry) {
+				if(entry == it)
+					append(constantId, &value, sizeof(T));
+
+				if(entry->constantID != constantId)
+					append(entry->constantID, this->data.data() + entry->offset, entry->size);
+			}
+
+			if(it == this->entries.end())
+				append(constantId, &value, sizeof(T));
+
+			this->entries.swap(newEntries);
+			this->data.swap(newData);
+
+			return *this;
+		}
+	};
+
+	// specialization constants for all shader stages of a graphics pipeline
+	struct ShaderConstants {
+		VulkanSpecialization vertexShader;
+		VulkanSpecialization fragmentShader;
+
+		std::size_t hash() const {
+			std::size_t result = this->vertexShader.hash();
+
+			Helper::Hash::combine(result, this->fragmentShader.hash());
+
+			return result;
+		}
+
+		bool operator==(const ShaderConstants& other) const {
+			return this->vertexShader == other.vertexShader && this->fragmentShader == other.fragmentShader;
+		}
+
+		bool operator!=(const ShaderConstants& other) const {
+			return !(*this == other);
+		}
+	};
+
+} /* spacelite::Struct */
+
+#endif /* SRC_STRUCT_VULKANSPECIALIZATION_HPP_ */
@@ -20,11 +20,14 @@ namespace spacelite::Struct {
 		unsigned int width;
 		unsigned int height;
 
+		bool visible;
+
 		WinProp(
 				const std::string& setTitle,
 				unsigned int setWidth,
-				unsigned int setHeight
-		) : title(setTitle), width(setWidth), height(setHeight) {}
+				unsigned int setHeight,
+				bool setVisible = true
+		) : title(setTitle), width(setWidth), height(setHeight), visible(setVisible) {}
 	};
 
 } /* spacelite::Struct */
@@ -16,8 +16,10 @@
 #include "VulkanDevice.hpp"
 #include "VulkanDeviceMemory.hpp"
 #include "VulkanError.hpp"
+#include "VulkanFence.hpp"
 #include "VulkanPhysicalDevice.hpp"
 
+#include "../Helper/Trace.hpp"
 #include "../Helper/VulkanAllocator.hpp"
 #include "../Main/Exception.hpp"
 
@@ -108,7 +110,16 @@ namespace spacelite::Wrapper {
 		vulkanBufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
 		vulkanBufferInfo.size = size;
 		vulkanBufferInfo.usage = usageFlags;
-		vulkanBufferInfo.sharingMode = isExclusive ? VK_SHARING_MODE_EXCLUSIVE : VK_SHARING_MODE_CONCURRENT;
+		// share non-exclusive buffers between all used queue families (e.g. graphics and transfer)
+		const auto& vulkanQueueFamilyIndices = this->parent.getQueueFamilyIndices();
+
+		if(isExclusive || vulkanQueueFamilyIndices.size() < 2)
+			vulkanBufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		else {
+			vulkanBufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+			vulkanBufferInfo.queueFamilyIndexCount = static_cast<unsigned int>(vulkanQueueFamilyIndices.size());
+			vulkanBufferInfo.pQueueFamilyIndices = vulkanQueueFamilyIndices.data();
+		}
 
 		VkResult vulkanResult = vkCreateBuffer(
 				this->parent.get(),
@@ -193,8 +204,11 @@ namespace spacelite::Wrapper {
 		vkUnmapMemory(this->parent.get(), this->memory.get());
 	}
 
-	// copy into the buffer using the command pool for the copy command
+	// copy into the buffer using the command pool (and its queue) for the copy command
+	//  NOTE:	Only waits for the copy itself, not for other work on the same queue.
 	inline void VulkanBuffer::copyFrom(const VulkanBuffer& other, VkDeviceSize size) {
+		const Helper::Trace::Zone zone("buffer upload");
+
 		VkCommandBufferAllocateInfo allocInfo = {};
 
 		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -227,9 +241,11 @@ namespace spacelite::Wrapper {
 		submitInfo.commandBufferCount = 1;
 		submitInfo.pCommandBuffers = &commandBuffer;
 
-		vkQueueSubmit(this->parent.getGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
+		VulkanFence copied(this->parent, false);
+
+		this->pool.getQueue().submit(submitInfo, copied.get());
 
-		vkQueueWaitIdle(this->parent.getGraphicsQueue());
+		copied.waitFor();
 
 		vkFreeCommandBuffers(this->parent.get(), this->pool.get(), 1, &commandBuffer);
 	}
@@ -0,0 +1,175 @@
+/*
+ * VulkanClockCalibration.hpp
+ *
+ * Converts GPU timestamps of a device using the Vulkan API to the clock used by Helper::Trace, so that zones of both
+ *  can be shown on the same timeline.
+ *
+ * Needs VK_EXT_calibrated_timestamps with CLOCK_MONOTONIC as time domain, i.e. is only available on some systems.
+ *  The offset between both clocks is measured on construction and whenever calibrate() is called.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANCLOCKCALIBRATION_HPP_
+#define SRC_WRAPPER_VULKANCLOCKCALIBRATION_HPP_
+
+#include "VulkanDevice.hpp"
+#include "VulkanError.hpp"
+#include "VulkanInstance.hpp"
+#include "VulkanPhysicalDevice.hpp"
+
+#include "../Main/Exception.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>	// std::int64_t, std::uint32_t, std::uint64_t
+#include <limits>	// std::numeric_limits
+#include <vector>	// std::vector
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanClockCalibration {
+	public:
+		VulkanClockCalibration(VulkanInstance& instance, VulkanPhysicalDevice& physicalDevice, VulkanDevice& device);
+
+		// measure the offset between the clocks (again)
+		void calibrate();
+
+		// getters
+		bool isAvailable() const;
+
+		// convert a GPU timestamp (in ns, as returned by VulkanQueryPool) to the clock used for tracing (in ns)
+		std::int64_t toTraceTime(double gpuTime) const;
+
+		// not copyable
+		VulkanClockCalibration(const VulkanClockCalibration&) = delete;
+		VulkanClockCalibration& operator=(const VulkanClockCalibration&) = delete;
+
+	private:
+		VulkanDevice& parent;
+		double period;	// in ns per tick
+		double offset;	// in ns
+		bool available;
+
+#ifdef VK_EXT_calibrated_timestamps
+		PFN_vkGetCalibratedTimestampsEXT getCalibratedTimestamps;
+#endif
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: check whether the clocks can be calibrated and calibrate them
+	inline VulkanClockCalibration::VulkanClockCalibration(
+			VulkanInstance& instance,
+			VulkanPhysicalDevice& physicalDevice,
+			VulkanDevice& device
+	)		:	parent(device),
+				period(physicalDevice.getProperties().limits.timestampPeriod),
+				offset(0.),
+				available(false) {
+#ifdef VK_EXT_calibrated_timestamps
+		this->getCalibratedTimestamps = nullptr;
+
+		if(!(device.getCapabilities().calibratedTimestamps))
+			return;
+
+		// check whether both the device and the CPU clock are supported as time domains
+		auto getTimeDomains = reinterpret_cast<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT>(
+				vkGetInstanceProcAddr(instance.get(), "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT")
+		);
+
+		this->getCalibratedTimestamps = reinterpret_cast<PFN_vkGetCalibratedTimestampsEXT>(
+				vkGetDeviceProcAddr(device.get(), "vkGetCalibratedTimestampsEXT")
+		);
+
+		if(!getTimeDomains || !(this->getCalibratedTimestamps))
+			return;
+
+		std::uint32_t vulkanCount = 0;
+
+		getTimeDomains(physicalDevice.get(), &vulkanCount, nullptr);
+
+		std::vector<VkTimeDomainEXT> vulkanTimeDomains(vulkanCount);
+
+		getTimeDomains(physicalDevice.get(), &vulkanCount, vulkanTimeDomains.data());
+
+		bool hasDevice = false;
+		bool hasMonotonic = false;
+
+		for(const VkTimeDomainEXT vulkanTimeDomain : vulkanTimeDomains) {
+			if(vulkanTimeDomain == VK_TIME_DOMAIN_DEVICE_EXT)
+				hasDevice = true;
+			else if(vulkanTimeDomain == VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT)
+				hasMonotonic = true;
+		}
+
+		this->available = hasDevice && hasMonotonic;
+
+		this->calibrate();
+#else
+		static_cast<void>(instance);
+#endif
+	}
+
+	// measure the offset between the clocks (again), using the sample with the lowest deviation of a few
+	inline void VulkanClockCalibration::calibrate() {
+#ifdef VK_EXT_calibrated_timestamps
+		if(!(this->available))
+			return;
+
+		VkCalibratedTimestampInfoEXT vulkanInfos[2] = {};
+
+		vulkanInfos[0].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+		vulkanInfos[0].timeDomain = VK_TIME_DOMAIN_DEVICE_EXT;
+		vulkanInfos[1].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+		vulkanInfos[1].timeDomain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT;
+
+		std::uint64_t lowestDeviation = std::numeric_limits<std::uint64_t>::max();
+
+		for(unsigned int n = 0; n < 4; ++n) {
+			std::uint64_t vulkanTimestamps[2] = {};
+			std::uint64_t vulkanDeviation = 0;
+
+			VkResult vulkanResult = this->getCalibratedTimestamps(
+					this->parent.get(),
+					2,
+					vulkanInfos,
+					vulkanTimestamps,
+					&vulkanDeviation
+			);
+
+			if(vulkanResult != VK_SUCCESS)
+				throw Exception("Could not get calibrated timestamps: " + Wrapper::VulkanError(vulkanResult).str());
+
+			if(vulkanDeviation < lowestDeviation) {
+				lowestDeviation = vulkanDeviation;
+
+				this->offset =
+						static_cast<double>(vulkanTimestamps[1])
+						- static_cast<double>(vulkanTimestamps[0]) * this->period;
+			}
+		}
+#endif
+	}
+
+	// get whether GPU timestamps can be converted
+	inline bool VulkanClockCalibration::isAvailable() const {
+		return this->available;
+	}
+
+	// convert a GPU timestamp (in ns, as returned by VulkanQueryPool) to the clock used for tracing (in ns)
+	inline std::int64_t VulkanClockCalibration::toTraceTime(double gpuTime) const {
+		return static_cast<std::int64_t>(gpuTime + this->offset);
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANCLOCKCALIBRATION_HPP_ */
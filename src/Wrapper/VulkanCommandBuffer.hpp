@@ -5,6 +5,18 @@
  *
  * Contains only a reference to an already allocated instance (because instances are allocated en bloc).
  *
+ * The command buffer is re-recorded for every frame. The draws need to be sorted by pipeline,
+ *  so that each pipeline is bound only once. Other passes (e.g. of a render graph) can be recorded
+ *  between beginning and ending the command buffer.
+ *
+ * Draws can use their own vertex buffers (e.g. written by compute shaders) instead of the shared one.
+ *
+ * The per-frame descriptor set (set #0) is bound with its dynamic offset whenever the pipeline layout changes,
+ *  while the transform of each draw is passed as push constants.
+ *
+ * Post-processing draws a single fullscreen triangle with its own descriptor set (set #0) for reading its source,
+ *  either in the post-processing subpass of the render pass or in a separate (fullscreen) pass.
+ *
  *  Created on: Sep 15, 2019
  *      Author: ans
  */
@@ -13,16 +25,20 @@
 #define SRC_WRAPPER_VULKANCOMMANDBUFFER_HPP_
 
 #include "VulkanError.hpp"
-#include "VulkanFrameBuffer.hpp"
 #include "VulkanPipeline.hpp"
+#include "VulkanPipelineCache.hpp"
 #include "VulkanRenderPass.hpp"
 #include "VulkanVertexBuffer.hpp"
 
 #include "../Main/Exception.hpp"
+#include "../Struct/VulkanDraw.hpp"
+#include "../Struct/VulkanRenderTarget.hpp"
 
 #include <vulkan/vulkan_core.h>
 
+#include <cstdint>	// std::uint32_t
 #include <utility>	// std::swap
+#include <vector>	// std::vector
 
 namespace spacelite::Wrapper {
 
@@ -31,16 +47,29 @@ namespace spacelite::Wrapper {
 	 */
 	class VulkanCommandBuffer {
 	public:
-		VulkanCommandBuffer(
-				VkCommandBuffer& dataRef,
+		explicit VulkanCommandBuffer(VkCommandBuffer& dataRef);
+		virtual ~VulkanCommandBuffer();
+
+		// (re-)record the command buffer
+		void begin();
+		void recordPass(
 				VulkanRenderPass& renderPass,
-				VulkanFrameBuffer& frameBuffer,
-				const VkExtent2D& extent,
-				VulkanPipeline& pipeline,
+				const Struct::VulkanRenderTarget& target,
+				VulkanPipelineCache& pipelines,
 				VulkanVertexBuffer& vertexBuffer,
-				unsigned long numberOfVertices
+				VkDescriptorSet frameSet,
+				std::uint32_t frameOffset,
+				const std::vector<Struct::VulkanDraw>& draws,
+				const VulkanPipeline * postProcessingPipeline = nullptr,
+				VkDescriptorSet postProcessingSet = VK_NULL_HANDLE
 		);
-		virtual ~VulkanCommandBuffer();
+		void recordFullscreenPass(
+				VulkanRenderPass& renderPass,
+				const Struct::VulkanRenderTarget& target,
+				const VulkanPipeline& pipeline,
+				VkDescriptorSet set
+		);
+		void end();
 
 		// getters
 		VkCommandBuffer& get();
@@ -55,69 +84,162 @@ namespace spacelite::Wrapper {
 	private:
 		VkCommandBuffer& reference;
 
+		// set viewport and scissor (dynamic states of all pipelines)
+		void setViewport(const VkExtent2D& extent);
+
+		// draw a fullscreen triangle
+		void drawFullscreen(const VulkanPipeline& pipeline, VkDescriptorSet set);
+
 		MAIN_EXCEPTION_CLASS();
 	};
 
 	/*
 	 * IMPLEMENTATION
 	 */
-	
-	// constructor: setup command buffer
-	inline VulkanCommandBuffer::VulkanCommandBuffer(
-			VkCommandBuffer& dataRef,
-			VulkanRenderPass& renderPass,
-			VulkanFrameBuffer& frameBuffer,
-			const VkExtent2D& extent,
-			VulkanPipeline& pipeline,
-			VulkanVertexBuffer& vertexBuffer,
-			unsigned long numberOfVertices
-	) : reference(dataRef) {
+
+	// constructor stub
+	inline VulkanCommandBuffer::VulkanCommandBuffer(VkCommandBuffer& dataRef) : reference(dataRef) {}
+
+	// begin (re-)recording the command buffer
+	//  (resets it implicitly, i.e. the command pool needs to allow resetting single buffers)
+	inline void VulkanCommandBuffer::begin() {
 		VkCommandBufferBeginInfo beginInfo = {};
 
 		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-		beginInfo.flags = 0;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 		beginInfo.pInheritanceInfo = nullptr;
 
 		VkResult vulkanResult = vkBeginCommandBuffer(this->reference, &beginInfo);
 
 		if(vulkanResult != VK_SUCCESS)
 			throw Exception("Could not begin command buffer: " + Wrapper::VulkanError(vulkanResult).str());
+	}
 
-		// start render pass
-		VkRenderPassBeginInfo renderPassInfo = {};
-
-		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		renderPassInfo.renderPass = renderPass.get();
-		renderPassInfo.framebuffer = frameBuffer.get();
-		renderPassInfo.renderArea.offset = { 0, 0 };
-		renderPassInfo.renderArea.extent = extent;
-
+	// record a render pass with the specified draws into the command buffer
+	//  (and the post-processing draw, if the render pass has a post-processing subpass)
+	inline void VulkanCommandBuffer::recordPass(
+			VulkanRenderPass& renderPass,
+			const Struct::VulkanRenderTarget& target,
+			VulkanPipelineCache& pipelines,
+			VulkanVertexBuffer& vertexBuffer,
+			VkDescriptorSet frameSet,
+			std::uint32_t frameOffset,
+			const std::vector<Struct::VulkanDraw>& draws,
+			const VulkanPipeline * postProcessingPipeline,
+			VkDescriptorSet postProcessingSet
+	) {
+		// start render pass (or dynamic rendering)
 		VkClearValue clearColor = {0.0f, 0.0f, 0.0f, 1.0f};
 
-		renderPassInfo.clearValueCount = 1;
-		renderPassInfo.pClearValues = &clearColor;
+		renderPass.begin(this->reference, target, clearColor);
 
-		vkCmdBeginRenderPass(this->reference, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+		this->setViewport(target.extent);
 
 		{
-			// bind graphics pipeline
-			vkCmdBindPipeline(this->reference, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.get());
-
 			// bind vertex buffer
-			VkBuffer vulkanVertexBuffers[] = { vertexBuffer.get() };
-			VkDeviceSize vulkanOffsets[] = { 0 };
+			VkBuffer vulkanBoundVertexBuffer = vertexBuffer.get();
+			VkDeviceSize vulkanOffset = 0;
+
+			vkCmdBindVertexBuffers(this->reference, 0, 1, &vulkanBoundVertexBuffer, &vulkanOffset);
+
+			// draw vertices, binding a graphics pipeline only if it differs from the last one
+			//  (pipelines that are still being created are replaced by the fallback pipeline or skipped)
+			std::size_t boundPipeline = VulkanPipelineCache::none;
+			VkPipelineLayout vulkanBoundLayout = VK_NULL_HANDLE;
+
+			for(const auto& draw : draws) {
+				const std::size_t pipeline = pipelines.resolve(draw.pipeline);
+
+				if(pipeline == VulkanPipelineCache::none)
+					continue;
+
+				const VulkanPipeline& currentPipeline = pipelines.getPipeline(pipeline);
+				const Struct::VulkanPipelineLayoutInfo& layoutInfo = currentPipeline.getLayoutInfo();
+
+				if(pipeline != boundPipeline) {
+					vkCmdBindPipeline(
+							this->reference,
+							VK_PIPELINE_BIND_POINT_GRAPHICS,
+							currentPipeline.get()
+					);
+
+					boundPipeline = pipeline;
+
+					// bind the per-frame descriptor set (if used by the pipeline and not bound for its layout yet)
+					if(currentPipeline.getLayout() != vulkanBoundLayout && frameSet && !(layoutInfo.sets.empty())) {
+						vkCmdBindDescriptorSets(
+								this->reference,
+								VK_PIPELINE_BIND_POINT_GRAPHICS,
+								currentPipeline.getLayout(),
+								0,
+								1,
+								&frameSet,
+								1,
+								&frameOffset
+						);
+
+						vulkanBoundLayout = currentPipeline.getLayout();
+					}
+				}
+
+				// bind the own vertex buffer of the draw (if it has one), or the shared one again after it
+				const VkBuffer vulkanVertexBuffer = draw.vertexBuffer ? draw.vertexBuffer : vertexBuffer.get();
+
+				if(vulkanVertexBuffer != vulkanBoundVertexBuffer) {
+					vkCmdBindVertexBuffers(this->reference, 0, 1, &vulkanVertexBuffer, &vulkanOffset);
+
+					vulkanBoundVertexBuffer = vulkanVertexBuffer;
+				}
+
+				// push the transform of the draw to the beginning of the push constants (if used by the pipeline)
+				//  NOTE:	The pipeline has made sure that its push constants cover the whole transform.
+				if(!(layoutInfo.pushConstantRanges.empty()))
+					vkCmdPushConstants(
+							this->reference,
+							currentPipeline.getLayout(),
+							layoutInfo.pushConstantRanges.front().stageFlags,
+							0,
+							static_cast<std::uint32_t>(sizeof(draw.transform)),
+							&(draw.transform)
+					);
+
+				vkCmdDraw(this->reference, draw.numberOfVertices, 1, draw.firstVertex, 0);
+			}
+		}
 
-			vkCmdBindVertexBuffers(this->reference, 0, 1, vulkanVertexBuffers, vulkanOffsets);
+		// post-process the scene (if the render pass has a post-processing subpass)
+		if(renderPass.hasPostProcessingSubpass()) {
+			renderPass.next(this->reference);
 
-			// draw vertices
-			vkCmdDraw(this->reference, static_cast<unsigned int>(numberOfVertices), 1, 0, 0);
+			if(postProcessingPipeline)
+				this->drawFullscreen(*postProcessingPipeline, postProcessingSet);
 		}
 
-		// finish render pass
-		vkCmdEndRenderPass(this->reference);
+		// finish render pass (or dynamic rendering)
+		renderPass.end(this->reference, target);
+	}
+
+	// record a render pass drawing a fullscreen triangle (e.g. for post-processing) into the command buffer
+	inline void VulkanCommandBuffer::recordFullscreenPass(
+			VulkanRenderPass& renderPass,
+			const Struct::VulkanRenderTarget& target,
+			const VulkanPipeline& pipeline,
+			VkDescriptorSet set
+	) {
+		// the target is completely overwritten, but the render pass clears it anyway
+		VkClearValue clearColor = {0.0f, 0.0f, 0.0f, 1.0f};
+
+		renderPass.begin(this->reference, target, clearColor);
+
+		this->setViewport(target.extent);
+		this->drawFullscreen(pipeline, set);
+
+		renderPass.end(this->reference, target);
+	}
 
-		// finish command buffer
-		vulkanResult = vkEndCommandBuffer(this->reference);
+	// finish (re-)recording the command buffer
+	inline void VulkanCommandBuffer::end() {
+		VkResult vulkanResult = vkEndCommandBuffer(this->reference);
 
 		if(vulkanResult != VK_SUCCESS)
 			throw Exception("Could not finish command buffer: " + Wrapper::VulkanError(vulkanResult).str());
@@ -126,6 +248,46 @@ namespace spacelite::Wrapper {
 	// destructor stub
 	inline VulkanCommandBuffer::~VulkanCommandBuffer() {}
 
+	// set viewport and scissor (dynamic states of all pipelines)
+	inline void VulkanCommandBuffer::setViewport(const VkExtent2D& extent) {
+		VkViewport vulkanViewport = {};
+
+		vulkanViewport.x = 0.0f;
+		vulkanViewport.y = 0.0f;
+		vulkanViewport.width = (float) extent.width;
+		vulkanViewport.height = (float) extent.height;
+		vulkanViewport.minDepth = 0.0f;
+		vulkanViewport.maxDepth = 1.0f;
+
+		vkCmdSetViewport(this->reference, 0, 1, &vulkanViewport);
+
+		VkRect2D vulkanScissor = {};
+
+		vulkanScissor.offset = { 0, 0 };
+		vulkanScissor.extent = extent;
+
+		vkCmdSetScissor(this->reference, 0, 1, &vulkanScissor);
+	}
+
+	// draw a fullscreen triangle (its vertices are generated by the vertex shader)
+	inline void VulkanCommandBuffer::drawFullscreen(const VulkanPipeline& pipeline, VkDescriptorSet set) {
+		vkCmdBindPipeline(this->reference, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.get());
+
+		if(set)
+			vkCmdBindDescriptorSets(
+					this->reference,
+					VK_PIPELINE_BIND_POINT_GRAPHICS,
+					pipeline.getLayout(),
+					0,
+					1,
+					&set,
+					0,
+					nullptr
+			);
+
+		vkCmdDraw(this->reference, 3, 1, 0, 0);
+	}
+
 	// get reference to the instance of the command buffer
 	inline VkCommandBuffer& VulkanCommandBuffer::get() {
 		return this->reference;
@@ -1,7 +1,7 @@
 /*
  * VulkanCommandBuffers.hpp
  *
-* Wraps the command buffers (one for each frame buffer / image view) used by the Vulkan API.
+* Wraps the command buffers (one for each frame in flight) used by the Vulkan API.
  *
  *  Created on: Sep 15, 2019
  *      Author: ans
@@ -12,11 +12,8 @@
 
 #include "VulkanCommandBuffer.hpp"
 #include "VulkanCommandPool.hpp"
+#include "VulkanDevice.hpp"
 #include "VulkanError.hpp"
-#include "VulkanFrameBuffers.hpp"
-#include "VulkanPipeline.hpp"
-#include "VulkanRenderPass.hpp"
-#include "VulkanVertexBuffer.hpp"
 
 #include "../Main/Exception.hpp"
 
@@ -35,12 +32,7 @@ namespace spacelite::Wrapper {
 		VulkanCommandBuffers(
 				VulkanDevice& device,
 				VulkanCommandPool& commandPool,
-				VulkanRenderPass& renderPass,
-				VulkanFrameBuffers& frameBuffers,
-				VkExtent2D& targetExtent,
-				VulkanPipeline& pipeline,
-				VulkanVertexBuffer& vertexBuffer,
-				unsigned long numberOfVertices
+				unsigned int numberOfBuffers
 		);
 		virtual ~VulkanCommandBuffers();
 
@@ -62,15 +54,10 @@ namespace spacelite::Wrapper {
 	private:
 		VulkanDevice& parent;
 		VulkanCommandPool& pool;
-		VulkanRenderPass& pass;
-		VulkanFrameBuffers& fBuffers;
-		VkExtent2D& extent;
-		VulkanPipeline& pipe;
-		VulkanVertexBuffer& vBuffer;
 
 		std::vector<VulkanCommandBuffer> buffers;
 		std::vector<VkCommandBuffer> data;
-		unsigned long nVertices;
+		unsigned int num;
 		bool _created;
 
 		MAIN_EXCEPTION_CLASS();
@@ -84,20 +71,10 @@ namespace spacelite::Wrapper {
 	inline VulkanCommandBuffers::VulkanCommandBuffers(
 			VulkanDevice& device,
 			VulkanCommandPool& commandPool,
-			VulkanRenderPass& renderPass,
-			VulkanFrameBuffers& frameBuffers,
-			VkExtent2D& targetExtent,
-			VulkanPipeline& pipeline,
-			VulkanVertexBuffer& vertexBuffer,
-			unsigned long numberOfVertices
+			unsigned int numberOfBuffers
 	) :		parent(device),
 			pool(commandPool),
-			pass(renderPass),
-			fBuffers(frameBuffers),
-			extent(targetExtent),
-			pipe(pipeline),
-			vBuffer(vertexBuffer),
-			nVertices(numberOfVertices),
+			num(numberOfBuffers),
 			_created(false) {
 		this->create();
 	}
@@ -110,17 +87,15 @@ namespace spacelite::Wrapper {
 	// create the command buffers
 	inline void VulkanCommandBuffers::create() {
 		// allocate command buffers
-		const unsigned int num = this->fBuffers.getNumberOfBuffers();
-
-		this->buffers.reserve(num);
-		this->data.resize(num);
+		this->buffers.reserve(this->num);
+		this->data.resize(this->num);
 
 		VkCommandBufferAllocateInfo vulkanAllocInfo = {};
 
 		vulkanAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
 		vulkanAllocInfo.commandPool = this->pool.get();
 		vulkanAllocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-		vulkanAllocInfo.commandBufferCount = num;
+		vulkanAllocInfo.commandBufferCount = this->num;
 
 		VkResult vulkanResult = vkAllocateCommandBuffers(
 				this->parent.get(),
@@ -131,22 +106,9 @@ namespace spacelite::Wrapper {
 		if(vulkanResult != VK_SUCCESS)
 			throw Exception("Could not create command buffers: " + Wrapper::VulkanError(vulkanResult).str());
 
-		// fill command buffers
-		unsigned short n = 0;
-
-		for(auto& commandBufferData : this->data) {
-			this->buffers.emplace_back(
-					commandBufferData,
-					this->pass,
-					this->fBuffers.get(n),
-					this->extent,
-					this->pipe,
-					this->vBuffer,
-					this->nVertices
-			);
-
-			++n;
-		}
+		// wrap command buffers (they will be recorded for each frame)
+		for(auto& commandBufferData : this->data)
+			this->buffers.emplace_back(commandBufferData);
 
 		this->_created = true;
 	}
@@ -188,14 +150,9 @@ namespace spacelite::Wrapper {
 	inline VulkanCommandBuffers::VulkanCommandBuffers(VulkanCommandBuffers&& other) noexcept
 			:	parent(other.parent),
 				pool(other.pool),
-				pass(other.pass),
-				fBuffers(other.fBuffers),
-				extent(other.extent),
-				pipe(other.pipe),
-				vBuffer(other.vBuffer),
 				buffers(std::move(other.buffers)),
 				data(std::move(other.data)),
-				nVertices(other.nVertices),
+				num(other.num),
 				_created(other._created) {
 		other._created = false;
 	}
@@ -206,13 +163,9 @@ namespace spacelite::Wrapper {
 
 		swap(this->parent, other.parent);
 		swap(this->pool, other.pool);
-		swap(this->pass, other.pass);
-		swap(this->fBuffers, other.fBuffers);
-		swap(this->extent, other.extent);
-		swap(this->pipe, other.pipe);
 		swap(this->buffers, other.buffers);
 		swap(this->data, other.data);
-		swap(this->nVertices, other.nVertices);
+		swap(this->num, other.num);
 		swap(this->_created, other._created);
 
 		return *this;
@@ -3,6 +3,8 @@
  *
  * Wraps a command pool used by the Vulkan API.
  *
+ * The command pool is bound to the queue (family) that its command buffers will be submitted to.
+ *
  *  Created on: Sep 14, 2019
  *      Author: ans
  */
@@ -12,10 +14,10 @@
 
 #include "VulkanDevice.hpp"
 #include "VulkanError.hpp"
+#include "VulkanQueue.hpp"
 
 #include "../Helper/VulkanAllocator.hpp"
 #include "../Main/Exception.hpp"
-#include "../Struct/VulkanQueueFamilies.hpp"
 
 #include <vulkan/vulkan_core.h>
 
@@ -28,12 +30,17 @@ namespace spacelite::Wrapper {
 	 */
 	class VulkanCommandPool {
 	public:
-		VulkanCommandPool(VulkanDevice& device, const Struct::VulkanQueueFamilies& queryFamilies);
+		VulkanCommandPool(
+				VulkanDevice& device,
+				VulkanQueue& queue,
+				VkCommandPoolCreateFlags flags = 0
+		);
 		virtual ~VulkanCommandPool();
 
 		// getters
 		VkCommandPool& get();
 		const VkCommandPool& get() const;
+		VulkanQueue& getQueue();
 
 		// resetter
 		void reset();
@@ -47,6 +54,7 @@ namespace spacelite::Wrapper {
 	private:
 		VulkanDevice& parent;
 		VkCommandPool instance;
+		VulkanQueue * target;
 
 		MAIN_EXCEPTION_CLASS();
 	};
@@ -58,15 +66,14 @@ namespace spacelite::Wrapper {
 	// constructor: create command pool
 	inline VulkanCommandPool::VulkanCommandPool(
 			VulkanDevice& device,
-			const Struct::VulkanQueueFamilies& queryFamilies
-	) : parent(device), instance(VK_NULL_HANDLE) {
-		const Struct::VulkanQueueFamilies& vulkanQueueFamily = queryFamilies;
-
+			VulkanQueue& queue,
+			VkCommandPoolCreateFlags flags
+	) : parent(device), instance(VK_NULL_HANDLE), target(&queue) {
 		VkCommandPoolCreateInfo vulkanPoolInfo = {};
 
 		vulkanPoolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-		vulkanPoolInfo.queueFamilyIndex = vulkanQueueFamily.graphicsFamily.value();
-		vulkanPoolInfo.flags = 0;
+		vulkanPoolInfo.queueFamilyIndex = queue.getFamily();
+		vulkanPoolInfo.flags = flags;
 
 		VkResult vulkanResult = vkCreateCommandPool(
 				this->parent.get(),
@@ -95,6 +102,11 @@ namespace spacelite::Wrapper {
 		return this->instance;
 	}
 
+	// get reference to the queue that the command buffers of the pool will be submitted to
+	inline VulkanQueue& VulkanCommandPool::getQueue() {
+		return *(this->target);
+	}
+
 	// reset the command pool (to be used between frames)
 	inline void VulkanCommandPool::reset() {
 		vkResetCommandPool(this->parent.get(), this->instance, VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT);
@@ -103,7 +115,8 @@ namespace spacelite::Wrapper {
 	// move constructor
 	inline VulkanCommandPool::VulkanCommandPool(VulkanCommandPool&& other) noexcept
 			:	parent(other.parent),
-				instance(other.instance) {
+				instance(other.instance),
+				target(other.target) {
 		other.instance = VK_NULL_HANDLE;
 	}
 
@@ -116,6 +129,7 @@ namespace spacelite::Wrapper {
 		using std::swap;
 
 		swap(this->parent, other.parent);
+		swap(this->target, other.target);
 
 		return *this;
 	}
@@ -0,0 +1,199 @@
+/*
+ * VulkanComputePipeline.hpp
+ *
+ * Wraps a compute pipeline used by the Vulkan API.
+ *
+ * The pipeline layout is generated from the resources used by the compute shader,
+ *  as reflected from its SPIR-V code (like the layouts of graphics pipelines).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANCOMPUTEPIPELINE_HPP_
+#define SRC_WRAPPER_VULKANCOMPUTEPIPELINE_HPP_
+
+#include "VulkanDevice.hpp"
+#include "VulkanError.hpp"
+#include "VulkanPipelineLayout.hpp"
+#include "VulkanPipelineLayoutCache.hpp"
+#include "VulkanShaderModule.hpp"
+
+#include "../Helper/FileCache.hpp"
+#include "../Helper/SpirVReflection.hpp"
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Main/Exception.hpp"
+#include "../Struct/ShaderReflection.hpp"
+#include "../Struct/VulkanSpecialization.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>	// std::uint32_t
+#include <memory>	// std::make_shared, std::shared_ptr
+#include <string>	// std::string
+#include <utility>	// std::move, std::swap
+#include <vector>	// std::vector
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanComputePipeline {
+	public:
+		VulkanComputePipeline(
+				VulkanDevice& device,
+				const std::string& shaderFile,
+				const Struct::VulkanSpecialization& shaderConstants = Struct::VulkanSpecialization(),
+				VkPipelineCache pipelineCache = VK_NULL_HANDLE,
+				VulkanPipelineLayoutCache * pipelineLayoutCache = nullptr
+		);
+		virtual ~VulkanComputePipeline();
+
+		// getters
+		VkPipeline& get();
+		const VkPipeline& get() const;
+		VkPipelineLayout& getLayout();
+		const VkPipelineLayout& getLayout() const;
+		VkDescriptorSetLayout getSetLayout(std::uint32_t set) const;
+		const Struct::ShaderReflection& getShaderReflection() const;
+
+		// not copyable, only moveable
+		VulkanComputePipeline(const VulkanComputePipeline&) = delete;
+		VulkanComputePipeline(VulkanComputePipeline&& other) noexcept;
+		VulkanComputePipeline& operator=(const VulkanComputePipeline&) = delete;
+		VulkanComputePipeline& operator=(VulkanComputePipeline&& other) noexcept;
+
+	private:
+		VulkanDevice& parent;
+		VkPipeline instance;
+		std::shared_ptr<VulkanPipelineLayout> layout;
+		Struct::ShaderReflection reflection;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: load the compute shader, generate the pipeline layout and create the compute pipeline
+	inline VulkanComputePipeline::VulkanComputePipeline(
+			VulkanDevice& device,
+			const std::string& shaderFile,
+			const Struct::VulkanSpecialization& shaderConstants,
+			VkPipelineCache pipelineCache,
+			VulkanPipelineLayoutCache * pipelineLayoutCache
+	) : parent(device), instance(VK_NULL_HANDLE) {
+		const auto shader = Helper::FileCache::get(shaderFile);
+		const std::vector<char>& shaderCode = *shader;
+
+		this->reflection = Helper::SpirVReflection(shaderCode).get();
+
+		if(this->reflection.stage != VK_SHADER_STAGE_COMPUTE_BIT)
+			throw Exception("Compute shader is not a compute shader: " + shaderFile);
+
+		// setup pipeline layout (generated from the shader and shared with other pipelines using the same resources)
+		const Struct::VulkanPipelineLayoutInfo layoutInfo = VulkanPipelineLayout::describe({ &(this->reflection) });
+
+		if(pipelineLayoutCache)
+			this->layout = pipelineLayoutCache->add(layoutInfo);
+		else
+			this->layout = std::make_shared<VulkanPipelineLayout>(this->parent, layoutInfo);
+
+		// setup shader (the info points into the constants, which will not change until the pipeline has been created)
+		VulkanShaderModule vulkanShaderModule(this->parent, shaderCode);
+
+		const VkSpecializationInfo vulkanSpecializationInfo = shaderConstants.getInfo();
+
+		VkPipelineShaderStageCreateInfo vulkanShaderStageInfo = {};
+
+		vulkanShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		vulkanShaderStageInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+		vulkanShaderStageInfo.module = vulkanShaderModule.get();
+		vulkanShaderStageInfo.pName = "main";
+		vulkanShaderStageInfo.pSpecializationInfo = shaderConstants.empty() ? nullptr : &vulkanSpecializationInfo;
+
+		// setup compute pipeline
+		VkComputePipelineCreateInfo vulkanPipelineInfo = {};
+
+		vulkanPipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+		vulkanPipelineInfo.stage = vulkanShaderStageInfo;
+		vulkanPipelineInfo.layout = this->layout->get();
+		vulkanPipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+		vulkanPipelineInfo.basePipelineIndex = -1;
+
+		VkResult vulkanResult = vkCreateComputePipelines(
+				this->parent.get(),
+				pipelineCache,
+				1,
+				&vulkanPipelineInfo,
+				Helper::VulkanAllocator::ptr,
+				&(this->instance)
+		);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not create compute pipeline: " + Wrapper::VulkanError(vulkanResult).str());
+	}
+
+	// destructor: destroy the compute pipeline
+	//  NOTE:	The pipeline layout will only be destroyed when it is not used anymore.
+	inline VulkanComputePipeline::~VulkanComputePipeline() {
+		if(this->instance)
+			vkDestroyPipeline(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
+	}
+
+	// get reference to the instance of the compute pipeline
+	inline VkPipeline& VulkanComputePipeline::get() {
+		return this->instance;
+	}
+
+	// get const reference to the instance of the compute pipeline
+	inline const VkPipeline& VulkanComputePipeline::get() const {
+		return this->instance;
+	}
+
+	// get reference to the layout of the compute pipeline
+	inline VkPipelineLayout& VulkanComputePipeline::getLayout() {
+		return this->layout->get();
+	}
+
+	// get const reference to the layout of the compute pipeline
+	inline const VkPipelineLayout& VulkanComputePipeline::getLayout() const {
+		return this->layout->get();
+	}
+
+	// get the layout of a descriptor set used by the compute pipeline
+	inline VkDescriptorSetLayout VulkanComputePipeline::getSetLayout(std::uint32_t set) const {
+		return this->layout->getSetLayout(set);
+	}
+
+	// get const reference to the reflected resources of the compute shader
+	inline const Struct::ShaderReflection& VulkanComputePipeline::getShaderReflection() const {
+		return this->reflection;
+	}
+
+	// move constructor
+	inline VulkanComputePipeline::VulkanComputePipeline(VulkanComputePipeline&& other) noexcept
+			:	parent(other.parent),
+				instance(other.instance),
+				layout(std::move(other.layout)),
+				reflection(std::move(other.reflection)) {
+		other.instance = VK_NULL_HANDLE;
+	}
+
+	// move assignment
+	inline VulkanComputePipeline& VulkanComputePipeline::operator=(VulkanComputePipeline&& other) noexcept {
+		using std::swap;
+
+		swap(this->parent, other.parent);
+		swap(this->instance, other.instance);
+		swap(this->layout, other.layout);
+		swap(this->reflection, other.reflection);
+
+		return *this;
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANCOMPUTEPIPELINE_HPP_ */
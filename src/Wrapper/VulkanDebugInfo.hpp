@@ -3,6 +3,9 @@
  *
  * Wraps the information structure for a Vulkan API debugger.
  *
+ * Messages are written to the asynchronous log. They are counted by their message ID, and only the first ones
+ *  with each ID are logged, so that noisy validation or performance warnings do not slow down every frame.
+ *
  *  Created on: Sep 12, 2019
  *      Author: ans
  */
@@ -10,11 +13,19 @@
 #ifndef SRC_WRAPPER_VULKANDEBUGINFO_HPP_
 #define SRC_WRAPPER_VULKANDEBUGINFO_HPP_
 
+#include "../Helper/Log.hpp"
 #include "../Main/Exception.hpp"
 
 #include <vulkan/vulkan_core.h>
 
-#include <iostream>	// std::cout, std::endl
+#include <array>	// std::array
+#include <atomic>	// std::atomic, std::memory_order_acq_rel, std::memory_order_acquire, std::memory_order_relaxed, std::memory_order_release
+#include <cstddef>	// std::size_t
+#include <cstdint>	// std::int32_t, std::int64_t, std::uint32_t, std::uint64_t
+#include <cstring>	// std::strncpy
+#include <limits>	// std::numeric_limits
+#include <sstream>	// std::ostringstream
+#include <string>	// std::string
 
 namespace spacelite::Wrapper {
 
@@ -29,9 +40,31 @@ namespace spacelite::Wrapper {
 		VkDebugUtilsMessengerCreateInfoEXT * getPtr();
 		const VkDebugUtilsMessengerCreateInfoEXT * getPtr() const;
 
+		// get the number of errors reported so far
+		static std::uint64_t getNumberOfErrors();
+
+		// get the number of messages by their IDs, if any have been counted (one line per ID)
+		static std::string getSummary();
+
 	private:
 		VkDebugUtilsMessengerCreateInfoEXT info;
 
+		static constexpr std::size_t maxMessageIds = 256;
+		static constexpr std::uint64_t maxMessagesPerId = 3; // further messages with the same ID will only be counted
+		static constexpr std::int64_t noMessageId = std::numeric_limits<std::int64_t>::min();
+
+		struct Counter {
+			std::atomic<std::int64_t> id{VulkanDebugInfo::noMessageId};
+			std::atomic<std::uint64_t> count{0};
+			std::atomic<bool> named{false};
+			char name[64] = {};
+		};
+
+		static std::array<Counter, maxMessageIds> counters;
+		static std::atomic<std::uint64_t> numberOfErrors;
+
+		static std::uint64_t count(std::int32_t id, const char * name);
+
 		static VKAPI_ATTR VkBool32 VKAPI_CALL callback(
 			VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
 			VkDebugUtilsMessageTypeFlagsEXT messageType,
@@ -45,6 +78,10 @@ namespace spacelite::Wrapper {
 	/*
 	 * IMPLEMENTATION
 	 */
+
+	inline std::array<VulkanDebugInfo::Counter, VulkanDebugInfo::maxMessageIds> VulkanDebugInfo::counters;
+	inline std::atomic<std::uint64_t> VulkanDebugInfo::numberOfErrors{0};
+
 	inline VulkanDebugInfo::VulkanDebugInfo() : info({}) {
 		this->info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
 		this->info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT
@@ -64,23 +101,104 @@ namespace spacelite::Wrapper {
 		return &(this->info);
 	}
 
+	inline std::uint64_t VulkanDebugInfo::getNumberOfErrors() {
+		return VulkanDebugInfo::numberOfErrors.load(std::memory_order_relaxed);
+	}
+
+	inline std::string VulkanDebugInfo::getSummary() {
+		std::ostringstream summary;
+
+		for(const Counter& counter : VulkanDebugInfo::counters) {
+			const std::int64_t id = counter.id.load(std::memory_order_acquire);
+
+			if(id == VulkanDebugInfo::noMessageId)
+				continue;
+
+			summary << "  ";
+
+			if(counter.named.load(std::memory_order_acquire))
+				summary << counter.name << " ";
+
+			summary << "[" << id << "]: " << counter.count.load(std::memory_order_relaxed) << "x\n";
+		}
+
+		return summary.str();
+	}
+
+	// count a message by its ID, returning the number of messages with this ID so far (zero if it cannot be counted)
+	inline std::uint64_t VulkanDebugInfo::count(std::int32_t id, const char * name) {
+		// find the counter for the ID using linear probing, claiming a free one if necessary
+		const std::size_t start = static_cast<std::uint32_t>(id) % VulkanDebugInfo::maxMessageIds;
+
+		for(std::size_t n = 0; n < VulkanDebugInfo::maxMessageIds; ++n) {
+			Counter& counter = VulkanDebugInfo::counters[(start + n) % VulkanDebugInfo::maxMessageIds];
+			std::int64_t current = counter.id.load(std::memory_order_acquire);
+
+			if(
+					current == VulkanDebugInfo::noMessageId
+					&& counter.id.compare_exchange_strong(current, id, std::memory_order_acq_rel)
+			) {
+				// the counter has been claimed for the ID: add its name
+				if(name) {
+					std::strncpy(counter.name, name, sizeof counter.name - 1);
+
+					counter.named.store(true, std::memory_order_release);
+				}
+
+				current = id;
+			}
+
+			if(current == id)
+				return counter.count.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+		return 0;
+	}
+
 	inline VKAPI_ATTR VkBool32 VKAPI_CALL VulkanDebugInfo::callback(
 			VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
-			VkDebugUtilsMessageTypeFlagsEXT messageType __attribute__ ((unused)),
+			VkDebugUtilsMessageTypeFlagsEXT messageType,
 			const VkDebugUtilsMessengerCallbackDataEXT * pCallbackData,
 			void * pUserData __attribute__ ((unused))
 	) {
+		// never throw from here, as the callback is called from inside the driver
+		if(messageSeverity == VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT)
+			VulkanDebugInfo::numberOfErrors.fetch_add(1, std::memory_order_relaxed);
+
+		// count validation and performance messages by their ID, logging only the first ones
+		std::uint64_t occurrence = 0;
+
+		if(
+				messageType
+				& (VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT)
+		) {
+			occurrence = VulkanDebugInfo::count(pCallbackData->messageIdNumber, pCallbackData->pMessageIdName);
+
+			if(occurrence > VulkanDebugInfo::maxMessagesPerId)
+				return VK_FALSE;
+		}
+
+		const char * suffix =
+				occurrence == VulkanDebugInfo::maxMessagesPerId ? " (further messages will be counted only)" : "";
+
 		switch(messageSeverity) {
 		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT:
-			std::cout << "[dbg] WARNING: " << pCallbackData->pMessage << std::endl;
+			Helper::Log::warning()
+					<< "[dbg] "
+					<< (messageType & VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT ? "PERFORMANCE" : "WARNING")
+					<< ": "
+					<< pCallbackData->pMessage
+					<< suffix;
 
 			break;
 
 		case VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT:
-			throw Exception(pCallbackData->pMessage);
+			Helper::Log::error() << "[dbg] ERROR: " << pCallbackData->pMessage << suffix;
+
+			break;
 
 		default:
-			std::cout << "[dbg] " << pCallbackData->pMessage << std::endl;
+			Helper::Log::debug() << "[dbg] " << pCallbackData->pMessage << suffix;
 
 			break;
 		}
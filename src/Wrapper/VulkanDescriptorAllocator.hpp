@@ -0,0 +1,300 @@
+/*
+ * VulkanDescriptorAllocator.hpp
+ *
+ * Allocates descriptor sets used by the Vulkan API from lists of descriptor pools that grow on demand.
+ *
+ * Transient descriptor sets are only valid for one frame. Each recording thread allocates them from its own pools
+ *  for the current frame, so that no locking is needed. All transient pools of a frame are reset at once
+ *  when the frame is started again (i.e. after waiting for its fence), instead of freeing sets one by one.
+ *
+ * Long-lived descriptor sets are cached by their layout and the hash of their bindings,
+ *  so that they are allocated and written only once.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANDESCRIPTORALLOCATOR_HPP_
+#define SRC_WRAPPER_VULKANDESCRIPTORALLOCATOR_HPP_
+
+#include "VulkanDescriptorPool.hpp"
+#include "VulkanDevice.hpp"
+
+#include "../Helper/Hash.hpp"
+#include "../Main/Exception.hpp"
+#include "../Struct/VulkanDescriptorBinding.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstddef>			// std::size_t
+#include <mutex>			// std::unique_lock
+#include <shared_mutex>		// std::shared_lock, std::shared_mutex
+#include <string>			// std::to_string
+#include <unordered_map>	// std::unordered_map
+#include <utility>			// std::move, std::pair
+#include <vector>			// std::vector
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanDescriptorAllocator {
+	public:
+		/* STATIC CONSTANTS */
+		static const std::vector<std::pair<VkDescriptorType, float>> poolRatios;
+		/* END STATIC CONSTANTS */
+
+		VulkanDescriptorAllocator(
+				VulkanDevice& device,
+				unsigned int numberOfFrames,
+				unsigned int numberOfThreads = 1,
+				unsigned int numberOfSetsPerPool = 64
+		);
+
+		// reset all transient descriptor sets of a frame (the frame may not be in use by the GPU or any thread)
+		void beginFrame(unsigned int frame);
+
+		// allocate a transient descriptor set for the current frame from the pools of a recording thread
+		VkDescriptorSet allocate(unsigned int frame, unsigned int thread, VkDescriptorSetLayout layout);
+
+		// get a long-lived descriptor set with the specified bindings (allocates and writes it if necessary)
+		VkDescriptorSet get(VkDescriptorSetLayout layout, const std::vector<Struct::VulkanDescriptorBinding>& bindings);
+
+		// write bindings into a descriptor set
+		void write(VkDescriptorSet set, const std::vector<Struct::VulkanDescriptorBinding>& bindings);
+
+		// getters
+		std::size_t getNumberOfPools() const;
+
+		// not copyable, not moveable
+		VulkanDescriptorAllocator(const VulkanDescriptorAllocator&) = delete;
+		VulkanDescriptorAllocator(VulkanDescriptorAllocator&&) = delete;
+		VulkanDescriptorAllocator& operator=(const VulkanDescriptorAllocator&) = delete;
+		VulkanDescriptorAllocator& operator=(VulkanDescriptorAllocator&&) = delete;
+
+	private:
+		// pools of one recording thread for one frame (aligned to avoid false sharing between threads)
+		struct alignas(64) Slot {
+			std::vector<VulkanDescriptorPool> pools;
+			std::size_t current = 0;
+		};
+
+		// key identifying a long-lived descriptor set
+		struct Key {
+			VkDescriptorSetLayout layout;
+			std::vector<Struct::VulkanDescriptorBinding> bindings;
+
+			bool operator==(const Key& other) const {
+				return this->layout == other.layout && this->bindings == other.bindings;
+			}
+		};
+
+		struct KeyHash {
+			std::size_t operator()(const Key& key) const {
+				std::size_t result = 0;
+
+				Helper::Hash::combine(result, key.layout);
+
+				for(const auto& binding : key.bindings)
+					Helper::Hash::combine(result, binding.hash());
+
+				return result;
+			}
+		};
+
+		// allocate a descriptor set from a list of pools, adding a new pool if all of them are exhausted
+		VkDescriptorSet allocate(std::vector<VulkanDescriptorPool>& pools, std::size_t& current, VkDescriptorSetLayout layout);
+
+		VulkanDevice& parent;
+
+		unsigned int threads;
+		unsigned int setsPerPool;
+		std::vector<VkDescriptorPoolSize> poolSizes;
+
+		std::vector<Slot> slots; // index = frame * threads + thread
+
+		std::vector<VulkanDescriptorPool> cachedPools;
+		std::size_t cachedCurrent;
+		std::unordered_map<Key, VkDescriptorSet, KeyHash> cachedSets;
+		mutable std::shared_mutex cachedSetsLock;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// number of descriptors per type in each pool (relative to the number of sets per pool)
+	inline const std::vector<std::pair<VkDescriptorType, float>> VulkanDescriptorAllocator::poolRatios = {
+			{ VK_DESCRIPTOR_TYPE_SAMPLER, 0.5f },
+			{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 2.f },
+			{ VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 2.f },
+			{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1.f },
+			{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1.f },
+			{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1.f },
+			{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1.f },
+			{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 0.5f },
+			{ VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 0.5f }
+	};
+
+	// constructor: prepare the (still empty) lists of pools for all frames and recording threads
+	inline VulkanDescriptorAllocator::VulkanDescriptorAllocator(
+			VulkanDevice& device,
+			unsigned int numberOfFrames,
+			unsigned int numberOfThreads,
+			unsigned int numberOfSetsPerPool
+	) :		parent(device),
+			threads(numberOfThreads ? numberOfThreads : 1),
+			setsPerPool(numberOfSetsPerPool ? numberOfSetsPerPool : 1),
+			slots(numberOfFrames * threads),
+			cachedCurrent(0) {
+		for(const auto& ratio : VulkanDescriptorAllocator::poolRatios) {
+			const unsigned int count = static_cast<unsigned int>(ratio.second * this->setsPerPool);
+
+			this->poolSizes.push_back({ ratio.first, count ? count : 1 });
+		}
+	}
+
+	// reset all transient descriptor sets of a frame (the frame may not be in use by the GPU or any thread)
+	inline void VulkanDescriptorAllocator::beginFrame(unsigned int frame) {
+		if((frame + 1) * this->threads > this->slots.size())
+			throw Exception("Descriptor allocator has no pools for frame #" + std::to_string(frame));
+
+		for(unsigned int thread = 0; thread < this->threads; ++thread) {
+			Slot& slot = this->slots[frame * this->threads + thread];
+
+			for(std::size_t n = 0; n < slot.pools.size() && n <= slot.current; ++n)
+				slot.pools[n].reset();
+
+			slot.current = 0;
+		}
+	}
+
+	// allocate a transient descriptor set for the current frame from the pools of a recording thread
+	//  NOTE:	Each thread may only use its own index, so that no locking is needed.
+	inline VkDescriptorSet VulkanDescriptorAllocator::allocate(
+			unsigned int frame,
+			unsigned int thread,
+			VkDescriptorSetLayout layout
+	) {
+		if(thread >= this->threads || (frame + 1) * this->threads > this->slots.size())
+			throw Exception(
+					"Descriptor allocator has no pools for frame #"
+					+ std::to_string(frame)
+					+ " and thread #"
+					+ std::to_string(thread)
+			);
+
+		Slot& slot = this->slots[frame * this->threads + thread];
+
+		return this->allocate(slot.pools, slot.current, layout);
+	}
+
+	// get a long-lived descriptor set with the specified bindings (allocates and writes it if necessary)
+	inline VkDescriptorSet VulkanDescriptorAllocator::get(
+			VkDescriptorSetLayout layout,
+			const std::vector<Struct::VulkanDescriptorBinding>& bindings
+	) {
+		Key key{layout, bindings};
+
+		{
+			std::shared_lock<std::shared_mutex> lock(this->cachedSetsLock);
+
+			const auto it = this->cachedSets.find(key);
+
+			if(it != this->cachedSets.end())
+				return it->second;
+		}
+
+		std::unique_lock<std::shared_mutex> lock(this->cachedSetsLock);
+
+		// check again, because another thread might have added the set in the meantime
+		const auto it = this->cachedSets.find(key);
+
+		if(it != this->cachedSets.end())
+			return it->second;
+
+		VkDescriptorSet vulkanSet = this->allocate(this->cachedPools, this->cachedCurrent, layout);
+
+		this->write(vulkanSet, bindings);
+
+		this->cachedSets.emplace(std::move(key), vulkanSet);
+
+		return vulkanSet;
+	}
+
+	// write bindings into a descriptor set
+	inline void VulkanDescriptorAllocator::write(
+			VkDescriptorSet set,
+			const std::vector<Struct::VulkanDescriptorBinding>& bindings
+	) {
+		std::vector<VkWriteDescriptorSet> vulkanWrites;
+
+		vulkanWrites.reserve(bindings.size());
+
+		for(const auto& binding : bindings) {
+			VkWriteDescriptorSet vulkanWrite = {};
+
+			vulkanWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			vulkanWrite.dstSet = set;
+			vulkanWrite.dstBinding = binding.binding;
+			vulkanWrite.dstArrayElement = 0;
+			vulkanWrite.descriptorCount = 1;
+			vulkanWrite.descriptorType = binding.type;
+
+			if(binding.isBuffer())
+				vulkanWrite.pBufferInfo = &(binding.buffer);
+			else
+				vulkanWrite.pImageInfo = &(binding.image);
+
+			vulkanWrites.push_back(vulkanWrite);
+		}
+
+		vkUpdateDescriptorSets(
+				this->parent.get(),
+				static_cast<unsigned int>(vulkanWrites.size()),
+				vulkanWrites.data(),
+				0,
+				nullptr
+		);
+	}
+
+	// get the number of descriptor pools (including the pools for long-lived descriptor sets)
+	inline std::size_t VulkanDescriptorAllocator::getNumberOfPools() const {
+		std::size_t result = 0;
+
+		for(const auto& slot : this->slots)
+			result += slot.pools.size();
+
+		std::shared_lock<std::shared_mutex> lock(this->cachedSetsLock);
+
+		return result + this->cachedPools.size();
+	}
+
+	// allocate a descriptor set from a list of pools, adding a new pool if all of them are exhausted
+	inline VkDescriptorSet VulkanDescriptorAllocator::allocate(
+			std::vector<VulkanDescriptorPool>& pools,
+			std::size_t& current,
+			VkDescriptorSetLayout layout
+	) {
+		VkDescriptorSet vulkanSet = VK_NULL_HANDLE;
+
+		for(; current < pools.size(); ++current)
+			if(pools[current].allocate(layout, vulkanSet))
+				return vulkanSet;
+
+		pools.emplace_back(this->parent, this->setsPerPool, this->poolSizes);
+
+		current = pools.size() - 1;
+
+		if(!(pools.back().allocate(layout, vulkanSet)))
+			throw Exception("Could not allocate descriptor set from a new descriptor pool");
+
+		return vulkanSet;
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANDESCRIPTORALLOCATOR_HPP_ */
@@ -0,0 +1,157 @@
+/*
+ * VulkanDescriptorPool.hpp
+ *
+ * Wraps a descriptor pool used by the Vulkan API.
+ *
+ * Descriptor sets allocated from the pool are not freed individually, but all at once when resetting the pool.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANDESCRIPTORPOOL_HPP_
+#define SRC_WRAPPER_VULKANDESCRIPTORPOOL_HPP_
+
+#include "VulkanDevice.hpp"
+#include "VulkanError.hpp"
+
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Main/Exception.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <utility>	// std::swap
+#include <vector>	// std::vector
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanDescriptorPool {
+	public:
+		VulkanDescriptorPool(
+				VulkanDevice& device,
+				unsigned int maxSets,
+				const std::vector<VkDescriptorPoolSize>& poolSizes
+		);
+		virtual ~VulkanDescriptorPool();
+
+		// allocate a descriptor set (returns false if the pool is exhausted)
+		bool allocate(VkDescriptorSetLayout layout, VkDescriptorSet& setTo);
+
+		// free all descriptor sets allocated from the pool
+		void reset();
+
+		// getters
+		VkDescriptorPool& get();
+		const VkDescriptorPool& get() const;
+
+		// not copyable, only moveable
+		VulkanDescriptorPool(const VulkanDescriptorPool&) = delete;
+		VulkanDescriptorPool(VulkanDescriptorPool&& other) noexcept;
+		VulkanDescriptorPool& operator=(const VulkanDescriptorPool&) = delete;
+		VulkanDescriptorPool& operator=(VulkanDescriptorPool&& other) noexcept;
+
+	private:
+		VulkanDevice& parent;
+		VkDescriptorPool instance;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the descriptor pool
+	inline VulkanDescriptorPool::VulkanDescriptorPool(
+			VulkanDevice& device,
+			unsigned int maxSets,
+			const std::vector<VkDescriptorPoolSize>& poolSizes
+	) : parent(device), instance(VK_NULL_HANDLE) {
+		VkDescriptorPoolCreateInfo vulkanCreateInfo = {};
+
+		vulkanCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		vulkanCreateInfo.flags = 0; // sets are not freed individually
+		vulkanCreateInfo.maxSets = maxSets;
+		vulkanCreateInfo.poolSizeCount = static_cast<unsigned int>(poolSizes.size());
+		vulkanCreateInfo.pPoolSizes = poolSizes.data();
+
+		VkResult vulkanResult = vkCreateDescriptorPool(
+				this->parent.get(),
+				&vulkanCreateInfo,
+				Helper::VulkanAllocator::ptr,
+				&(this->instance)
+		);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not create descriptor pool: " + Wrapper::VulkanError(vulkanResult).str());
+	}
+
+	// destructor: destroy the descriptor pool (and all descriptor sets allocated from it)
+	inline VulkanDescriptorPool::~VulkanDescriptorPool() {
+		if(this->instance)
+			vkDestroyDescriptorPool(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
+	}
+
+	// allocate a descriptor set (returns false if the pool is exhausted)
+	inline bool VulkanDescriptorPool::allocate(VkDescriptorSetLayout layout, VkDescriptorSet& setTo) {
+		VkDescriptorSetAllocateInfo vulkanAllocInfo = {};
+
+		vulkanAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		vulkanAllocInfo.descriptorPool = this->instance;
+		vulkanAllocInfo.descriptorSetCount = 1;
+		vulkanAllocInfo.pSetLayouts = &layout;
+
+		VkResult vulkanResult = vkAllocateDescriptorSets(this->parent.get(), &vulkanAllocInfo, &setTo);
+
+		if(vulkanResult == VK_ERROR_OUT_OF_POOL_MEMORY || vulkanResult == VK_ERROR_FRAGMENTED_POOL)
+			return false;
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not allocate descriptor set: " + Wrapper::VulkanError(vulkanResult).str());
+
+		return true;
+	}
+
+	// free all descriptor sets allocated from the pool
+	inline void VulkanDescriptorPool::reset() {
+		VkResult vulkanResult = vkResetDescriptorPool(this->parent.get(), this->instance, 0);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not reset descriptor pool: " + Wrapper::VulkanError(vulkanResult).str());
+	}
+
+	// get reference to the instance of the descriptor pool
+	inline VkDescriptorPool& VulkanDescriptorPool::get() {
+		return this->instance;
+	}
+
+	// get const reference to the instance of the descriptor pool
+	inline const VkDescriptorPool& VulkanDescriptorPool::get() const {
+		return this->instance;
+	}
+
+	// move constructor
+	inline VulkanDescriptorPool::VulkanDescriptorPool(VulkanDescriptorPool&& other) noexcept
+			:	parent(other.parent),
+				instance(other.instance) {
+		other.instance = VK_NULL_HANDLE;
+	}
+
+	// move assignment
+	inline VulkanDescriptorPool& VulkanDescriptorPool::operator=(VulkanDescriptorPool&& other) noexcept {
+		this->instance = other.instance;
+
+		other.instance = VK_NULL_HANDLE;
+
+		using std::swap;
+
+		swap(this->parent, other.parent);
+
+		return *this;
+	}
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANDESCRIPTORPOOL_HPP_ */
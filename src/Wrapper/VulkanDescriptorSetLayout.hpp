@@ -0,0 +1,114 @@
+/*
+ * VulkanDescriptorSetLayout.hpp
+ *
+ * Wraps a descriptor set layout used by the Vulkan API.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANDESCRIPTORSETLAYOUT_HPP_
+#define SRC_WRAPPER_VULKANDESCRIPTORSETLAYOUT_HPP_
+
+#include "VulkanDevice.hpp"
+#include "VulkanError.hpp"
+
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Main/Exception.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <utility>	// std::swap
+#include <vector>	// std::vector
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanDescriptorSetLayout {
+	public:
+		VulkanDescriptorSetLayout(VulkanDevice& device, const std::vector<VkDescriptorSetLayoutBinding>& bindings);
+		virtual ~VulkanDescriptorSetLayout();
+
+		// getters
+		VkDescriptorSetLayout& get();
+		const VkDescriptorSetLayout& get() const;
+
+		// not copyable, only moveable
+		VulkanDescriptorSetLayout(const VulkanDescriptorSetLayout&) = delete;
+		VulkanDescriptorSetLayout(VulkanDescriptorSetLayout&& other) noexcept;
+		VulkanDescriptorSetLayout& operator=(const VulkanDescriptorSetLayout&) = delete;
+		VulkanDescriptorSetLayout& operator=(VulkanDescriptorSetLayout&& other) noexcept;
+
+	private:
+		VulkanDevice& parent;
+		VkDescriptorSetLayout instance;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the descriptor set layout
+	inline VulkanDescriptorSetLayout::VulkanDescriptorSetLayout(
+			VulkanDevice& device,
+			const std::vector<VkDescriptorSetLayoutBinding>& bindings
+	) : parent(device), instance(VK_NULL_HANDLE) {
+		VkDescriptorSetLayoutCreateInfo vulkanCreateInfo = {};
+
+		vulkanCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		vulkanCreateInfo.bindingCount = static_cast<unsigned int>(bindings.size());
+		vulkanCreateInfo.pBindings = bindings.data();
+
+		VkResult vulkanResult = vkCreateDescriptorSetLayout(
+				this->parent.get(),
+				&vulkanCreateInfo,
+				Helper::VulkanAllocator::ptr,
+				&(this->instance)
+		);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not create descriptor set layout: " + Wrapper::VulkanError(vulkanResult).str());
+	}
+
+	// destructor: destroy the descriptor set layout
+	inline VulkanDescriptorSetLayout::~VulkanDescriptorSetLayout() {
+		if(this->instance)
+			vkDestroyDescriptorSetLayout(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
+	}
+
+	// get reference to the instance of the descriptor set layout
+	inline VkDescriptorSetLayout& VulkanDescriptorSetLayout::get() {
+		return this->instance;
+	}
+
+	// get const reference to the instance of the descriptor set layout
+	inline const VkDescriptorSetLayout& VulkanDescriptorSetLayout::get() const {
+		return this->instance;
+	}
+
+	// move constructor
+	inline VulkanDescriptorSetLayout::VulkanDescriptorSetLayout(VulkanDescriptorSetLayout&& other) noexcept
+			:	parent(other.parent),
+				instance(other.instance) {
+		other.instance = VK_NULL_HANDLE;
+	}
+
+	// move assignment
+	inline VulkanDescriptorSetLayout& VulkanDescriptorSetLayout::operator=(VulkanDescriptorSetLayout&& other) noexcept {
+		this->instance = other.instance;
+
+		other.instance = VK_NULL_HANDLE;
+
+		using std::swap;
+
+		swap(this->parent, other.parent);
+
+		return *this;
+	}
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANDESCRIPTORSETLAYOUT_HPP_ */
@@ -1,7 +1,13 @@
 /*
  * VulkanDevice.hpp
  *
- * Wraps a logical device with a presentation and a graphics queue.
+ * Wraps a logical device with a presentation and a graphics queue,
+ *  as well as a compute and a transfer queue (using dedicated queue families if available).
+ *
+ * Only one queue is created per queue family, i.e. roles sharing a family share the same queue.
+ *
+ * Optional extensions and features are negotiated with the physical device, i.e. they are enabled if supported.
+ *  The resulting capabilities can be used to choose the fastest available path at runtime.
  *
  *  Created on: Sep 13, 2019
  *      Author: ans
@@ -12,16 +18,25 @@
 
 #include "VulkanError.hpp"
 #include "VulkanPhysicalDevice.hpp"
+#include "VulkanQueue.hpp"
 
 #include "../Helper/VulkanAllocator.hpp"
 #include "../Main/Exception.hpp"
+#include "../Struct/VulkanCapabilities.hpp"
+#include "../Struct/VulkanFeatureChain.hpp"
+#include "../Struct/VulkanQueuePriorities.hpp"
 #include "../Struct/VulkanRequirements.hpp"
 
 #include <vulkan/vulkan_core.h>
 
-#include <set>		// std::set
-#include <utility>	// std::swap
-#include <vector>	// std::vector
+#include <algorithm>	// std::max
+#include <cstring>		// std::strcmp
+#include <map>			// std::map
+#include <memory>		// std::make_unique, std::unique_ptr
+#include <set>			// std::set
+#include <string>		// std::string
+#include <utility>		// std::move, std::swap
+#include <vector>		// std::vector
 
 namespace spacelite::Wrapper {
 
@@ -32,15 +47,20 @@ namespace spacelite::Wrapper {
 	public:
 		VulkanDevice(
 				VulkanPhysicalDevice& physicalDevice,
-				const Struct::VulkanRequirements& requirements
+				const Struct::VulkanRequirements& requirements,
+				const Struct::VulkanQueuePriorities& queuePriorities = Struct::VulkanQueuePriorities()
 		);
 		virtual ~VulkanDevice();
 
 		// getters
 		VkDevice& get();
 		const VkDevice& get() const;
-		VkQueue getPresentQueue();
-		VkQueue getGraphicsQueue();
+		VulkanQueue& getPresentQueue();
+		VulkanQueue& getGraphicsQueue();
+		VulkanQueue& getComputeQueue();
+		VulkanQueue& getTransferQueue();
+		const std::vector<unsigned int>& getQueueFamilyIndices() const;
+		const Struct::VulkanCapabilities& getCapabilities() const;
 
 		// operator
 		operator bool() const;
@@ -54,8 +74,21 @@ namespace spacelite::Wrapper {
 	private:
 		VulkanPhysicalDevice& parent;
 		VkDevice instance;
-		VkQueue presentQueue;
-		VkQueue graphicsQueue;
+
+		std::vector<std::unique_ptr<VulkanQueue>> queues; // one per used queue family
+		std::vector<unsigned int> queueFamilyIndices;
+		VulkanQueue * presentQueue;
+		VulkanQueue * graphicsQueue;
+		VulkanQueue * computeQueue;
+		VulkanQueue * transferQueue;
+
+		Struct::VulkanCapabilities capabilities;
+
+		// private helper function
+		std::vector<const char *> negotiate(
+				const Struct::VulkanRequirements& requirements,
+				Struct::VulkanFeatureChain& featuresTo
+		);
 
 		MAIN_EXCEPTION_CLASS();
 	};
@@ -67,39 +100,64 @@ namespace spacelite::Wrapper {
 	// constructor: create the logical device
 	inline VulkanDevice::VulkanDevice(
 			VulkanPhysicalDevice& physicalDevice,
-			const Struct::VulkanRequirements& requirements
-	) : parent(physicalDevice), instance(VK_NULL_HANDLE), presentQueue(VK_NULL_HANDLE), graphicsQueue(VK_NULL_HANDLE) {
+			const Struct::VulkanRequirements& requirements,
+			const Struct::VulkanQueuePriorities& queuePriorities
+	) :		parent(physicalDevice),
+			instance(VK_NULL_HANDLE),
+			presentQueue(nullptr),
+			graphicsQueue(nullptr),
+			computeQueue(nullptr),
+			transferQueue(nullptr) {
 		const Struct::VulkanQueueFamilies& vulkanQueueFamilyIndices = this->parent.findQueueFamilies();
 
-		std::vector<VkDeviceQueueCreateInfo> vulkanQueueCreateInfos;
-		std::set<unsigned int> vulkanUniqueQueueFamilies = {
-				vulkanQueueFamilyIndices.graphicsFamily.value(),
-				vulkanQueueFamilyIndices.presentFamily.value()
+		// get the unique queue families and their (highest) priorities
+		std::map<unsigned int, float> vulkanUniqueQueueFamilies;
+
+		const auto addFamily = [&vulkanUniqueQueueFamilies](unsigned int family, float priority) {
+			const auto it = vulkanUniqueQueueFamilies.find(family);
+
+			if(it == vulkanUniqueQueueFamilies.end())
+				vulkanUniqueQueueFamilies.emplace(family, priority);
+			else
+				it->second = std::max(it->second, priority);
 		};
 
-		float queuePriority = 1.0f;
+		addFamily(vulkanQueueFamilyIndices.graphicsFamily.value(), queuePriorities.graphics);
+		addFamily(vulkanQueueFamilyIndices.presentFamily.value(), queuePriorities.graphics);
+		addFamily(vulkanQueueFamilyIndices.getComputeFamily(), queuePriorities.compute);
+		addFamily(vulkanQueueFamilyIndices.getTransferFamily(), queuePriorities.transfer);
 
-		for(unsigned int queueFamily : vulkanUniqueQueueFamilies) {
+		std::vector<VkDeviceQueueCreateInfo> vulkanQueueCreateInfos;
+
+		for(const auto& queueFamily : vulkanUniqueQueueFamilies) {
 			VkDeviceQueueCreateInfo vulkanQueueCreateInfo = {};
 
 			vulkanQueueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-			vulkanQueueCreateInfo.queueFamilyIndex = queueFamily;
+			vulkanQueueCreateInfo.queueFamilyIndex = queueFamily.first;
 			vulkanQueueCreateInfo.queueCount = 1;
-			vulkanQueueCreateInfo.pQueuePriorities = &queuePriority;
+			vulkanQueueCreateInfo.pQueuePriorities = &(queueFamily.second);
 
 			vulkanQueueCreateInfos.push_back(vulkanQueueCreateInfo);
 		}
 
-		VkPhysicalDeviceFeatures vulkanDeviceFeatures = {};
+		// negotiate extensions and features
+		Struct::VulkanFeatureChain vulkanFeatures;
+
+		const std::vector<const char *> vulkanExtensions = this->negotiate(requirements, vulkanFeatures);
 
 		VkDeviceCreateInfo vulkanCreateInfo = {};
 
 		vulkanCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
 		vulkanCreateInfo.queueCreateInfoCount = static_cast<unsigned int>(vulkanQueueCreateInfos.size());
 		vulkanCreateInfo.pQueueCreateInfos = vulkanQueueCreateInfos.data();
-		vulkanCreateInfo.pEnabledFeatures = &vulkanDeviceFeatures;
-		vulkanCreateInfo.enabledExtensionCount = static_cast<uint32_t>(requirements.deviceExtensions.size());
-		vulkanCreateInfo.ppEnabledExtensionNames = requirements.deviceExtensions.data();
+		vulkanCreateInfo.enabledExtensionCount = static_cast<uint32_t>(vulkanExtensions.size());
+		vulkanCreateInfo.ppEnabledExtensionNames = vulkanExtensions.data();
+
+		// the chain of features can only be used with Vulkan 1.1 or newer
+		if(this->capabilities.apiVersion >= VK_API_VERSION_1_1)
+			vulkanCreateInfo.pNext = &(vulkanFeatures.core);
+		else
+			vulkanCreateInfo.pEnabledFeatures = &(vulkanFeatures.core.features);
 
 	#ifdef NDEBUG
 		vulkanCreateInfo.enabledLayerCount = 0;
@@ -118,9 +176,24 @@ namespace spacelite::Wrapper {
 		if(vulkanResult != VK_SUCCESS)
 			throw Exception("Could not create logical graphics device: " + Wrapper::VulkanError(vulkanResult).str());
 
-		// get rendering queue from device
-		vkGetDeviceQueue(this->instance, vulkanQueueFamilyIndices.presentFamily.value(), 0, &(this->presentQueue));
-		vkGetDeviceQueue(this->instance, vulkanQueueFamilyIndices.graphicsFamily.value(), 0, &(this->graphicsQueue));
+		// get queues from device
+		std::map<unsigned int, VulkanQueue *> vulkanQueuesByFamily;
+
+		for(const auto& queueFamily : vulkanUniqueQueueFamilies) {
+			VkQueue vulkanQueue = VK_NULL_HANDLE;
+
+			vkGetDeviceQueue(this->instance, queueFamily.first, 0, &vulkanQueue);
+
+			this->queues.emplace_back(std::make_unique<VulkanQueue>(vulkanQueue, queueFamily.first));
+			this->queueFamilyIndices.push_back(queueFamily.first);
+
+			vulkanQueuesByFamily[queueFamily.first] = this->queues.back().get();
+		}
+
+		this->presentQueue = vulkanQueuesByFamily.at(vulkanQueueFamilyIndices.presentFamily.value());
+		this->graphicsQueue = vulkanQueuesByFamily.at(vulkanQueueFamilyIndices.graphicsFamily.value());
+		this->computeQueue = vulkanQueuesByFamily.at(vulkanQueueFamilyIndices.getComputeFamily());
+		this->transferQueue = vulkanQueuesByFamily.at(vulkanQueueFamilyIndices.getTransferFamily());
 	}
 
 	// destructor: destroy the logical device
@@ -140,13 +213,33 @@ namespace spacelite::Wrapper {
 	}
 
 	// get the presentation queue
-	inline VkQueue VulkanDevice::getPresentQueue() {
-		return this->presentQueue;
+	inline VulkanQueue& VulkanDevice::getPresentQueue() {
+		return *(this->presentQueue);
 	}
 
 	// get the graphics queue
-	inline VkQueue VulkanDevice::getGraphicsQueue() {
-		return this->graphicsQueue;
+	inline VulkanQueue& VulkanDevice::getGraphicsQueue() {
+		return *(this->graphicsQueue);
+	}
+
+	// get the compute queue (might be the graphics queue if there is no dedicated compute family)
+	inline VulkanQueue& VulkanDevice::getComputeQueue() {
+		return *(this->computeQueue);
+	}
+
+	// get the transfer queue (might be the compute or graphics queue if there is no dedicated transfer family)
+	inline VulkanQueue& VulkanDevice::getTransferQueue() {
+		return *(this->transferQueue);
+	}
+
+	// get the indices of all used queue families (e.g. for sharing resources between them)
+	inline const std::vector<unsigned int>& VulkanDevice::getQueueFamilyIndices() const {
+		return this->queueFamilyIndices;
+	}
+
+	// get the optional features and extensions that have been enabled
+	inline const Struct::VulkanCapabilities& VulkanDevice::getCapabilities() const {
+		return this->capabilities;
 	}
 
 	// bool operator: return whether the instance to the logical device is valid
@@ -154,15 +247,104 @@ namespace spacelite::Wrapper {
 		return this->instance != VK_NULL_HANDLE;
 	}
 
+	// negotiate optional extensions and features with the physical device, returns the extensions to enable
+	//  NOTE:	Only features used by the engine will be enabled (if supported), not all of the supported features.
+	inline std::vector<const char *> VulkanDevice::negotiate(
+			const Struct::VulkanRequirements& requirements,
+			Struct::VulkanFeatureChain& featuresTo
+	) {
+		this->capabilities = Struct::VulkanCapabilities();
+		this->capabilities.apiVersion = this->parent.getApiVersion();
+
+		// enable optional extensions that are supported by the physical device
+		std::vector<const char *> result(requirements.deviceExtensions);
+
+		for(const char * extension : requirements.optionalDeviceExtensions) {
+#ifdef VK_KHR_dynamic_rendering
+			// dynamic rendering depends on extensions promoted to Vulkan 1.2 (i.e. depth/stencil resolve
+			//  and render pass 2), so it is only used with Vulkan 1.2 or newer
+			if(
+					this->capabilities.apiVersion < VK_API_VERSION_1_2
+					&& std::strcmp(extension, VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME) == 0
+			)
+				continue;
+#endif
+
+			if(this->parent.hasExtension(extension))
+				result.push_back(extension);
+		}
+
+		const std::set<std::string> vulkanExtensions(result.begin(), result.end());
+
+		// query the features supported by the physical device
+		Struct::VulkanFeatureChain vulkanSupported;
+
+		if(this->capabilities.apiVersion >= VK_API_VERSION_1_1)
+			vkGetPhysicalDeviceFeatures2(
+					this->parent.get(),
+					vulkanSupported.link(this->capabilities.apiVersion, vulkanExtensions)
+			);
+		else
+			vkGetPhysicalDeviceFeatures(this->parent.get(), &(vulkanSupported.core.features));
+
+		// enable the supported features used by the engine
+		featuresTo.link(this->capabilities.apiVersion, vulkanExtensions);
+
+		featuresTo.core.features.samplerAnisotropy = vulkanSupported.core.features.samplerAnisotropy;
+
+		this->capabilities.samplerAnisotropy = featuresTo.core.features.samplerAnisotropy;
+
+#ifdef VK_KHR_timeline_semaphore
+		featuresTo.timelineSemaphore.timelineSemaphore = vulkanSupported.timelineSemaphore.timelineSemaphore;
+
+		this->capabilities.timelineSemaphores = featuresTo.timelineSemaphore.timelineSemaphore;
+#endif
+
+#ifdef VK_KHR_synchronization2
+		featuresTo.synchronization2.synchronization2 = vulkanSupported.synchronization2.synchronization2;
+
+		this->capabilities.synchronization2 = featuresTo.synchronization2.synchronization2;
+#endif
+
+#ifdef VK_KHR_dynamic_rendering
+		featuresTo.dynamicRendering.dynamicRendering = vulkanSupported.dynamicRendering.dynamicRendering;
+
+		this->capabilities.dynamicRendering = featuresTo.dynamicRendering.dynamicRendering;
+#endif
+
+#ifdef VK_KHR_buffer_device_address
+		featuresTo.bufferDeviceAddress.bufferDeviceAddress = vulkanSupported.bufferDeviceAddress.bufferDeviceAddress;
+
+		this->capabilities.bufferDeviceAddress = featuresTo.bufferDeviceAddress.bufferDeviceAddress;
+#endif
+
+#ifdef VK_EXT_memory_budget
+		this->capabilities.memoryBudget = vulkanExtensions.count(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) > 0;
+#endif
+
+#ifdef VK_EXT_calibrated_timestamps
+		this->capabilities.calibratedTimestamps = vulkanExtensions.count(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME) > 0;
+#endif
+
+		return result;
+	}
+
 	// move constructor
 	inline VulkanDevice::VulkanDevice(VulkanDevice&& other) noexcept
 			:	parent(other.parent),
 				instance(other.instance),
+				queues(std::move(other.queues)),
+				queueFamilyIndices(std::move(other.queueFamilyIndices)),
 				presentQueue(other.presentQueue),
-				graphicsQueue(other.graphicsQueue) {
+				graphicsQueue(other.graphicsQueue),
+				computeQueue(other.computeQueue),
+				transferQueue(other.transferQueue),
+				capabilities(other.capabilities) {
 		other.instance = VK_NULL_HANDLE;
-		other.presentQueue = VK_NULL_HANDLE;
-		other.graphicsQueue = VK_NULL_HANDLE;
+		other.presentQueue = nullptr;
+		other.graphicsQueue = nullptr;
+		other.computeQueue = nullptr;
+		other.transferQueue = nullptr;
 	}
 
 	// move assignment
@@ -170,14 +352,21 @@ namespace spacelite::Wrapper {
 		this->instance = other.instance;
 		this->presentQueue = other.presentQueue;
 		this->graphicsQueue = other.graphicsQueue;
+		this->computeQueue = other.computeQueue;
+		this->transferQueue = other.transferQueue;
+		this->capabilities = other.capabilities;
 
 		other.instance = VK_NULL_HANDLE;
-		other.presentQueue = VK_NULL_HANDLE;
-		other.graphicsQueue = VK_NULL_HANDLE;
+		other.presentQueue = nullptr;
+		other.graphicsQueue = nullptr;
+		other.computeQueue = nullptr;
+		other.transferQueue = nullptr;
 
 		using std::swap;
 
 		swap(this->parent, other.parent);
+		swap(this->queues, other.queues);
+		swap(this->queueFamilyIndices, other.queueFamilyIndices);
 
 		return *this;
 	}
@@ -3,6 +3,8 @@
  *
  * Wraps device memory for the Vulkan API.
  *
+ * Keeps track of the device memory allocated by all instances (e.g. for reports).
+ *
  *  Created on: Sep 15, 2019
  *      Author: ans
  */
@@ -18,6 +20,7 @@
 
 #include <vulkan/vulkan_core.h>
 
+#include <atomic>		// std::atomic
 #include <utility>		// std::swap
 
 namespace spacelite::Wrapper {
@@ -37,6 +40,11 @@ namespace spacelite::Wrapper {
 		VkDeviceMemory& get();
 		const VkDeviceMemory& get() const;
 
+		// statistics (for all instances)
+		static unsigned long long getAllocated();
+		static unsigned long long getPeak();
+		static unsigned long long getNumberOfAllocations();
+
 		// not copyable, only moveable
 		VulkanDeviceMemory(const VulkanDeviceMemory&) = delete;
 		VulkanDeviceMemory(VulkanDeviceMemory&& other) noexcept;
@@ -46,6 +54,11 @@ namespace spacelite::Wrapper {
 	private:
 		VulkanDevice& parent;
 		VkDeviceMemory instance;
+		unsigned long size;
+
+		static std::atomic<unsigned long long> allocated;
+		static std::atomic<unsigned long long> peak;
+		static std::atomic<unsigned long long> numberOfAllocations;
 
 		MAIN_EXCEPTION_CLASS();
 	};
@@ -54,8 +67,13 @@ namespace spacelite::Wrapper {
 	 * IMPLEMENTATION
 	 */
 
+	inline std::atomic<unsigned long long> VulkanDeviceMemory::allocated{0};
+	inline std::atomic<unsigned long long> VulkanDeviceMemory::peak{0};
+	inline std::atomic<unsigned long long> VulkanDeviceMemory::numberOfAllocations{0};
+
 	// constructor: save device instance
-	inline VulkanDeviceMemory::VulkanDeviceMemory(VulkanDevice& device) : parent(device), instance(VK_NULL_HANDLE) {}
+	inline VulkanDeviceMemory::VulkanDeviceMemory(VulkanDevice& device)
+			: parent(device), instance(VK_NULL_HANDLE), size(0) {}
 
 	// allocate memory
 	inline void VulkanDeviceMemory::allocate(unsigned long size, unsigned int typeIndex) {
@@ -73,13 +91,26 @@ namespace spacelite::Wrapper {
 		);
 
 		if(vulkanResult != VK_SUCCESS)
-			throw Exception("Could not allocate memory for vertex buffer: " + Wrapper::VulkanError(vulkanResult).str());
+			throw Exception("Could not allocate device memory: " + Wrapper::VulkanError(vulkanResult).str());
+
+		// update statistics
+		this->size = size;
+
+		const unsigned long long total = VulkanDeviceMemory::allocated += size;
+		unsigned long long oldPeak = VulkanDeviceMemory::peak;
+
+		while(total > oldPeak && !VulkanDeviceMemory::peak.compare_exchange_weak(oldPeak, total)) {}
+
+		++VulkanDeviceMemory::numberOfAllocations;
 	}
 
 	// destructor: free allocated memory if necessary
 	inline VulkanDeviceMemory::~VulkanDeviceMemory() {
-		if(this->instance)
+		if(this->instance) {
 			vkFreeMemory(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
+
+			VulkanDeviceMemory::allocated -= this->size;
+		}
 	}
 
 	// get reference to the instance of the device memory
@@ -92,16 +123,33 @@ namespace spacelite::Wrapper {
 		return this->instance;
 	}
 
+	// get the number of bytes currently allocated by all instances
+	inline unsigned long long VulkanDeviceMemory::getAllocated() {
+		return VulkanDeviceMemory::allocated;
+	}
+
+	// get the maximum number of bytes allocated by all instances at the same time
+	inline unsigned long long VulkanDeviceMemory::getPeak() {
+		return VulkanDeviceMemory::peak;
+	}
+
+	// get the number of allocations by all instances
+	inline unsigned long long VulkanDeviceMemory::getNumberOfAllocations() {
+		return VulkanDeviceMemory::numberOfAllocations;
+	}
+
 	// move constructor
 	inline VulkanDeviceMemory::VulkanDeviceMemory(VulkanDeviceMemory&& other) noexcept
 			:	parent(other.parent),
-				instance(other.instance) {
+				instance(other.instance),
+				size(other.size) {
 		other.instance = VK_NULL_HANDLE;
 	}
 
 	// move assignment
 	inline VulkanDeviceMemory& VulkanDeviceMemory::operator=(VulkanDeviceMemory&& other) noexcept {
 		this->instance = other.instance;
+		this->size = other.size;
 
 		other.instance = VK_NULL_HANDLE;
 
@@ -68,8 +68,10 @@ namespace spacelite::Wrapper {
 			STR(ERROR_FRAGMENTATION_EXT);
 			STR(ERROR_INVALID_DEVICE_ADDRESS_EXT);
 			STR(ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT);
+#if VK_HEADER_VERSION < 140 // removed from newer Vulkan headers
 			STR(RESULT_BEGIN_RANGE);
 			STR(RESULT_RANGE_SIZE);
+#endif
 			STR(RESULT_MAX_ENUM);
 			STR(SUCCESS);
 #undef STR
@@ -23,7 +23,7 @@ namespace spacelite::Wrapper {
 	 */
 	class VulkanFence{
 	public:
-		VulkanFence(VulkanDevice& device);
+		VulkanFence(VulkanDevice& device, bool isSignaled = true);
 		virtual ~VulkanFence();
 
 		// getters
@@ -50,12 +50,12 @@ namespace spacelite::Wrapper {
 	 * IMPLEMENTATION
 	 */
 
-	// constructor: create the semaphore
-	inline VulkanFence::VulkanFence(VulkanDevice& device) : parent(device), instance(VK_NULL_HANDLE) {
+	// constructor: create the semaphore (signaled by default)
+	inline VulkanFence::VulkanFence(VulkanDevice& device, bool isSignaled) : parent(device), instance(VK_NULL_HANDLE) {
 		VkFenceCreateInfo vulkanFenceInfo = {};
 
 		vulkanFenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-		vulkanFenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+		vulkanFenceInfo.flags = isSignaled ? VK_FENCE_CREATE_SIGNALED_BIT : 0;
 
 		VkResult vulkanResult = vkCreateFence(
 				this->parent.get(),
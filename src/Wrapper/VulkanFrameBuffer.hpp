@@ -21,6 +21,7 @@
 #include <vulkan/vulkan_core.h>
 
 #include <utility>	// std::swap
+#include <vector>	// std::vector
 
 namespace spacelite::Wrapper {
 
@@ -31,7 +32,7 @@ namespace spacelite::Wrapper {
 	public:
 		VulkanFrameBuffer(
 				VulkanDevice& device,
-				const VulkanImageView& imageView,
+				const std::vector<VkImageView>& attachments,
 				const VulkanRenderPass& renderPass,
 				const VkExtent2D& extent
 		);
@@ -66,20 +67,16 @@ namespace spacelite::Wrapper {
 	// constructor: create frame buffers
 	inline VulkanFrameBuffer::VulkanFrameBuffer(
 			VulkanDevice& device,
-			const VulkanImageView& imageView,
+			const std::vector<VkImageView>& attachments,
 			const VulkanRenderPass& renderPass,
 			const VkExtent2D& extent
 	) : parent(device), instance(VK_NULL_HANDLE) {
-		VkImageView attachments[] = {
-			imageView.get()
-		};
-
 		VkFramebufferCreateInfo vulkanFrameBufferInfo = {};
 
 		vulkanFrameBufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
 		vulkanFrameBufferInfo.renderPass = renderPass.get();
-		vulkanFrameBufferInfo.attachmentCount = 1;
-		vulkanFrameBufferInfo.pAttachments = attachments;
+		vulkanFrameBufferInfo.attachmentCount = static_cast<unsigned int>(attachments.size());
+		vulkanFrameBufferInfo.pAttachments = attachments.data();
 		vulkanFrameBufferInfo.width = extent.width;
 		vulkanFrameBufferInfo.height = extent.height;
 		vulkanFrameBufferInfo.layers = 1;
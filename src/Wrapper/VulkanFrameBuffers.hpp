@@ -3,6 +3,17 @@
  *
  * Wraps the frame buffers (one for each image view) used by the Vulkan API.
  *
+ * No frame buffers are created when dynamic rendering is used instead of a render pass object.
+ *
+ * The depth buffer, the multisampled color buffer and the input image of the post-processing subpass
+ *  (if used by the render pass) are shared by all frame buffers, because their contents are not stored.
+ *
+ * Offscreen images (e.g. created by a render graph) can be added as targets after the swap chain images.
+ *  They need to be added again after the frame buffers have been re-created.
+ *
+ * If the render pass does not use the format of the swap chain (e.g. when rendering an HDR scene),
+ *  only offscreen images can be used as targets.
+ *
  *  Created on: Sep 15, 2019
  *      Author: ans
  */
@@ -12,10 +23,17 @@
 
 #include "VulkanDevice.hpp"
 #include "VulkanFrameBuffer.hpp"
+#include "VulkanImage.hpp"
+#include "VulkanPhysicalDevice.hpp"
 #include "VulkanRenderPass.hpp"
 #include "VulkanSwapChain.hpp"
 
-#include <utility>	// std::move, std::swap
+#include "../Main/Exception.hpp"
+#include "../Struct/VulkanRenderTarget.hpp"
+
+#include <memory>	// std::make_unique, std::unique_ptr
+#include <string>	// std::to_string
+#include <utility>	// std::move, std::pair, std::swap
 #include <vector>	// std::vector
 
 namespace spacelite::Wrapper {
@@ -25,17 +43,26 @@ namespace spacelite::Wrapper {
 	 */
 	class VulkanFrameBuffers {
 	public:
-		VulkanFrameBuffers(VulkanDevice& device, VulkanSwapChain& swapChain, VulkanRenderPass& renderPass);
+		VulkanFrameBuffers(
+				VulkanDevice& device,
+				VulkanPhysicalDevice& physicalDevice,
+				VulkanSwapChain& swapChain,
+				VulkanRenderPass& renderPass
+		);
 		virtual ~VulkanFrameBuffers();
 
 		// creation and destruction
 		void create();
 		void destroy();
 
+		// add an offscreen image as target (returns its index)
+		unsigned int addOffscreenTarget(VkImage image, VkImageView imageView);
+
 		// getters
 		VulkanFrameBuffer& get(unsigned int index);
 		const VulkanFrameBuffer& get(unsigned int index) const;
 		unsigned int getNumberOfBuffers() const;
+		Struct::VulkanRenderTarget getTarget(unsigned int index) const;
 
 		// not copyable, only moveable
 		VulkanFrameBuffers(const VulkanFrameBuffers&) = delete;
@@ -45,9 +72,20 @@ namespace spacelite::Wrapper {
 
 	private:
 		VulkanDevice& parent;
+		VulkanPhysicalDevice& physical;
 		std::vector<VulkanFrameBuffer> buffers;
+		std::unique_ptr<VulkanImage> depthImage;
+		std::unique_ptr<VulkanImage> multisampledImage;
+		std::unique_ptr<VulkanImage> inputImage;
+		std::vector<std::pair<VkImage, VkImageView>> offscreenTargets;
 		VulkanSwapChain& chain;
 		VulkanRenderPass& pass;
+		bool offscreenOnly;
+
+		// create the frame buffer for a target image
+		void createFrameBuffer(VkImageView imageView);
+
+		MAIN_EXCEPTION_CLASS();
 	};
 
 	/*
@@ -57,26 +95,84 @@ namespace spacelite::Wrapper {
 	// constructor: outsourced to create()
 	inline VulkanFrameBuffers::VulkanFrameBuffers(
 			VulkanDevice& device,
+			VulkanPhysicalDevice& physicalDevice,
 			VulkanSwapChain& swapChain,
 			VulkanRenderPass& renderPass
-	) : parent(device), chain(swapChain), pass(renderPass) {
+	) : parent(device), physical(physicalDevice), chain(swapChain), pass(renderPass), offscreenOnly(false) {
 		this->create();
 	}
 
 	// destructor: outsourced to destroy()
 	inline VulkanFrameBuffers::~VulkanFrameBuffers() {}
 
-	// create the frame buffers
+	// create the depth buffer, the multisampled color buffer, the input image and the frame buffers (if needed)
 	inline void VulkanFrameBuffers::create() {
+		if(this->pass.hasDepth())
+			this->depthImage = std::make_unique<VulkanImage>(
+					this->parent,
+					this->physical,
+					this->chain.getExtent(),
+					this->pass.getDepthFormat(),
+					VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+					VK_IMAGE_ASPECT_DEPTH_BIT,
+					this->pass.getSamples(),
+					true /* transient */
+			);
+
+		if(this->pass.isMultisampled())
+			this->multisampledImage = std::make_unique<VulkanImage>(
+					this->parent,
+					this->physical,
+					this->chain.getExtent(),
+					this->pass.getFormat(),
+					VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+					VK_IMAGE_ASPECT_COLOR_BIT,
+					this->pass.getSamples(),
+					true /* transient */
+			);
+
+		if(this->pass.hasPostProcessingSubpass())
+			this->inputImage = std::make_unique<VulkanImage>(
+					this->parent,
+					this->physical,
+					this->chain.getExtent(),
+					this->pass.getFormat(),
+					VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT,
+					VK_IMAGE_ASPECT_COLOR_BIT,
+					VK_SAMPLE_COUNT_1_BIT,
+					true /* transient */
+			);
+
+		// swap chain images can only be targets if they have the format used by the render pass
+		this->offscreenOnly = this->pass.getFormat() != this->chain.getImageFormat();
+
+		if(this->pass.isDynamic() || this->offscreenOnly)
+			return;
+
 		this->buffers.reserve(this->chain.getNumberOfImageViews());
 
 		for(unsigned int n = 0; n < this->chain.getNumberOfImageViews(); ++n)
-			this->buffers.emplace_back(this->parent, this->chain.getImageView(n), this->pass, this->chain.getExtent());
+			this->createFrameBuffer(this->chain.getImageView(n).get());
 	}
 
-	// destroy the frame buffers
+	// destroy the frame buffers, the depth buffer, the multisampled color buffer and the input image
+	//  (removes all offscreen targets as well)
 	inline void VulkanFrameBuffers::destroy() {
 		this->buffers.clear();
+		this->offscreenTargets.clear();
+		this->depthImage.reset();
+		this->multisampledImage.reset();
+		this->inputImage.reset();
+	}
+
+	// add an offscreen image as target (returns its index), which needs to have the extent of the swap chain
+	inline unsigned int VulkanFrameBuffers::addOffscreenTarget(VkImage image, VkImageView imageView) {
+		if(!(this->pass.isDynamic()))
+			this->createFrameBuffer(imageView);
+
+		this->offscreenTargets.emplace_back(image, imageView);
+
+		return this->chain.getNumberOfImageViews() + this->offscreenTargets.size() - 1;
 	}
 
 	// get reference to the instance of an index-specified frame buffer
@@ -94,21 +190,102 @@ namespace spacelite::Wrapper {
 		return this->buffers.size();
 	}
 
+	// get the index-specified swap chain image (or offscreen image) as target for rendering
+	//  (including its frame buffer, if needed)
+	inline Struct::VulkanRenderTarget VulkanFrameBuffers::getTarget(unsigned int index) const {
+		Struct::VulkanRenderTarget result;
+
+		if(index < this->chain.getNumberOfImageViews()) {
+			if(this->offscreenOnly)
+				throw Exception("Swap chain image #" + std::to_string(index) + " does not have the format of the render pass");
+
+			result.image = this->chain.getImage(index);
+			result.imageView = this->chain.getImageView(index).get();
+		}
+		else {
+			const auto& offscreenTarget = this->offscreenTargets.at(index - this->chain.getNumberOfImageViews());
+
+			result.image = offscreenTarget.first;
+			result.imageView = offscreenTarget.second;
+		}
+
+		result.extent = this->chain.getExtent();
+
+		if(this->depthImage) {
+			result.depthImage = this->depthImage->get();
+			result.depthImageView = this->depthImage->getView().get();
+		}
+
+		if(this->multisampledImage) {
+			result.multisampledImage = this->multisampledImage->get();
+			result.multisampledImageView = this->multisampledImage->getView().get();
+		}
+
+		if(this->inputImage) {
+			result.inputImage = this->inputImage->get();
+			result.inputImageView = this->inputImage->getView().get();
+		}
+
+		if(!(this->pass.isDynamic()))
+			result.frameBuffer = this->buffers.at(
+					this->offscreenOnly ? index - this->chain.getNumberOfImageViews() : index
+			).get();
+
+		return result;
+	}
+
+	// create the frame buffer for a target image
+	//  (attachments in the order used by the render pass: color, depth, resolve target, post-processing target)
+	inline void VulkanFrameBuffers::createFrameBuffer(VkImageView imageView) {
+		std::vector<VkImageView> attachments;
+
+		// the scene is rendered into the multisampled image, the input image or the target image
+		if(this->multisampledImage)
+			attachments.push_back(this->multisampledImage->getView().get());
+		else if(this->inputImage)
+			attachments.push_back(this->inputImage->getView().get());
+		else
+			attachments.push_back(imageView);
+
+		if(this->depthImage)
+			attachments.push_back(this->depthImage->getView().get());
+
+		if(this->multisampledImage)
+			attachments.push_back(this->inputImage ? this->inputImage->getView().get() : imageView);
+
+		if(this->inputImage)
+			attachments.push_back(imageView);
+
+		this->buffers.emplace_back(this->parent, attachments, this->pass, this->chain.getExtent());
+	}
+
 	// move constructor
 	inline VulkanFrameBuffers::VulkanFrameBuffers(VulkanFrameBuffers&& other) noexcept
 			:	parent(other.parent),
+				physical(other.physical),
 				buffers(std::move(other.buffers)),
+				depthImage(std::move(other.depthImage)),
+				multisampledImage(std::move(other.multisampledImage)),
+				inputImage(std::move(other.inputImage)),
+				offscreenTargets(std::move(other.offscreenTargets)),
 				chain(other.chain),
-				pass(other.pass) {}
+				pass(other.pass),
+				offscreenOnly(other.offscreenOnly) {}
 
 	// move assignment
 	inline VulkanFrameBuffers& VulkanFrameBuffers::operator=(VulkanFrameBuffers&& other) noexcept {
 		using std::swap;
 
 		swap(this->parent, other.parent);
+		swap(this->physical, other.physical);
 		swap(this->buffers, other.buffers);
+		swap(this->depthImage, other.depthImage);
+		swap(this->multisampledImage, other.multisampledImage);
+		swap(this->inputImage, other.inputImage);
+		swap(this->offscreenTargets, other.offscreenTargets);
 		swap(this->chain, other.chain);
 		swap(this->pass, other.pass);
+		swap(this->offscreenOnly, other.offscreenOnly);
 
 		return *this;
 	}
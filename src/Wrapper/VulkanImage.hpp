@@ -0,0 +1,233 @@
+/*
+ * VulkanImage.hpp
+ *
+ * Wraps an image used by the Vulkan API, including its (device-local) memory and its image view.
+ *
+ * Transient images (e.g. depth buffers that are not stored after rendering) use lazily allocated memory if available,
+ *  so that tile-based GPUs might not need to allocate any memory for them at all.
+ *
+ * Shared images (e.g. written on the graphics queue and read on the compute queue) can be used by all queue families
+ *  of the device without transferring their ownership.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANIMAGE_HPP_
+#define SRC_WRAPPER_VULKANIMAGE_HPP_
+
+#include "VulkanDevice.hpp"
+#include "VulkanDeviceMemory.hpp"
+#include "VulkanError.hpp"
+#include "VulkanImageView.hpp"
+#include "VulkanPhysicalDevice.hpp"
+
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Main/Exception.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <memory>	// std::make_unique, std::unique_ptr
+#include <utility>	// std::move, std::swap
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanImage {
+	public:
+		VulkanImage(
+				VulkanDevice& device,
+				VulkanPhysicalDevice& physicalDevice,
+				const VkExtent2D& imageExtent,
+				VkFormat imageFormat,
+				VkImageUsageFlags usage,
+				VkImageAspectFlags aspect,
+				VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT,
+				bool isTransient = false,
+				bool isShared = false
+		);
+		virtual ~VulkanImage();
+
+		// getters
+		VkImage& get();
+		const VkImage& get() const;
+		const VulkanImageView& getView() const;
+		VkFormat getFormat() const;
+		const VkExtent2D& getExtent() const;
+		bool isLazilyAllocated() const;
+
+		// not copyable, only moveable
+		VulkanImage(const VulkanImage&) = delete;
+		VulkanImage(VulkanImage&& other) noexcept;
+		VulkanImage& operator=(const VulkanImage&) = delete;
+		VulkanImage& operator=(VulkanImage&& other) noexcept;
+
+	private:
+		VulkanDevice& parent;
+		VkImage instance;
+		VulkanDeviceMemory memory;
+		std::unique_ptr<VulkanImageView> view;
+		VkFormat format;
+		VkExtent2D extent;
+		bool lazy;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the image, allocate its memory and create its image view
+	inline VulkanImage::VulkanImage(
+			VulkanDevice& device,
+			VulkanPhysicalDevice& physicalDevice,
+			const VkExtent2D& imageExtent,
+			VkFormat imageFormat,
+			VkImageUsageFlags usage,
+			VkImageAspectFlags aspect,
+			VkSampleCountFlagBits samples,
+			bool isTransient,
+			bool isShared
+	) :		parent(device),
+			instance(VK_NULL_HANDLE),
+			memory(device),
+			format(imageFormat),
+			extent(imageExtent),
+			lazy(false) {
+		// create image
+		VkImageCreateInfo vulkanImageInfo = {};
+
+		vulkanImageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+		vulkanImageInfo.imageType = VK_IMAGE_TYPE_2D;
+		vulkanImageInfo.extent.width = this->extent.width;
+		vulkanImageInfo.extent.height = this->extent.height;
+		vulkanImageInfo.extent.depth = 1;
+		vulkanImageInfo.mipLevels = 1;
+		vulkanImageInfo.arrayLayers = 1;
+		vulkanImageInfo.format = this->format;
+		vulkanImageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+		vulkanImageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		vulkanImageInfo.usage = isTransient ? (usage | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) : usage;
+		vulkanImageInfo.samples = samples;
+
+		const auto& vulkanQueueFamilyIndices = this->parent.getQueueFamilyIndices();
+
+		if(!isShared || vulkanQueueFamilyIndices.size() < 2)
+			vulkanImageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		else {
+			vulkanImageInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+			vulkanImageInfo.queueFamilyIndexCount = static_cast<unsigned int>(vulkanQueueFamilyIndices.size());
+			vulkanImageInfo.pQueueFamilyIndices = vulkanQueueFamilyIndices.data();
+		}
+
+		VkResult vulkanResult = vkCreateImage(
+				this->parent.get(),
+				&vulkanImageInfo,
+				Helper::VulkanAllocator::ptr,
+				&(this->instance)
+		);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not create image: " + Wrapper::VulkanError(vulkanResult).str());
+
+		// allocate GPU memory (lazily, if the image is transient and lazily allocated memory is available)
+		VkMemoryRequirements vulkanMemRequirements;
+
+		vkGetImageMemoryRequirements(this->parent.get(), this->instance, &vulkanMemRequirements);
+
+		const VkMemoryPropertyFlags vulkanLazyFlags =
+				VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+
+		this->lazy = isTransient && physicalDevice.hasMemoryType(vulkanMemRequirements.memoryTypeBits, vulkanLazyFlags);
+
+		this->memory.allocate(
+				vulkanMemRequirements.size,
+				physicalDevice.findMemoryType(
+						vulkanMemRequirements.memoryTypeBits,
+						this->lazy ? vulkanLazyFlags : static_cast<VkMemoryPropertyFlags>(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+				)
+		);
+
+		vulkanResult = vkBindImageMemory(this->parent.get(), this->instance, this->memory.get(), 0);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not bind memory to image: " + Wrapper::VulkanError(vulkanResult).str());
+
+		// create image view
+		this->view = std::make_unique<VulkanImageView>(this->parent, this->instance, this->format, aspect);
+	}
+
+	// destructor: destroy the image view and the image (the memory will be freed afterwards)
+	inline VulkanImage::~VulkanImage() {
+		this->view.reset();
+
+		if(this->instance)
+			vkDestroyImage(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
+	}
+
+	// get reference to the instance of the image
+	inline VkImage& VulkanImage::get() {
+		return this->instance;
+	}
+
+	// get const reference to the instance of the image
+	inline const VkImage& VulkanImage::get() const {
+		return this->instance;
+	}
+
+	// get const reference to the image view of the image
+	inline const VulkanImageView& VulkanImage::getView() const {
+		return *(this->view);
+	}
+
+	// get the format of the image
+	inline VkFormat VulkanImage::getFormat() const {
+		return this->format;
+	}
+
+	// get const reference to the extent of the image
+	inline const VkExtent2D& VulkanImage::getExtent() const {
+		return this->extent;
+	}
+
+	// check whether the memory of the image is lazily allocated
+	inline bool VulkanImage::isLazilyAllocated() const {
+		return this->lazy;
+	}
+
+	// move constructor
+	inline VulkanImage::VulkanImage(VulkanImage&& other) noexcept
+			:	parent(other.parent),
+				instance(other.instance),
+				memory(std::move(other.memory)),
+				view(std::move(other.view)),
+				format(other.format),
+				extent(other.extent),
+				lazy(other.lazy) {
+		other.instance = VK_NULL_HANDLE;
+	}
+
+	// move assignment
+	inline VulkanImage& VulkanImage::operator=(VulkanImage&& other) noexcept {
+		this->instance = other.instance;
+		this->format = other.format;
+		this->extent = other.extent;
+		this->lazy = other.lazy;
+
+		other.instance = VK_NULL_HANDLE;
+
+		using std::swap;
+
+		swap(this->parent, other.parent);
+		swap(this->memory, other.memory);
+		swap(this->view, other.view);
+
+		return *this;
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANIMAGE_HPP_ */
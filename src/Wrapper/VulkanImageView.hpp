@@ -24,7 +24,12 @@ namespace spacelite::Wrapper {
 	 */
 	class VulkanImageView {
 	public:
-		VulkanImageView(VulkanDevice& device, const VkImage& imagem, const VkFormat& format);
+		VulkanImageView(
+				VulkanDevice& device,
+				const VkImage& imagem,
+				const VkFormat& format,
+				VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT
+		);
 		virtual ~VulkanImageView();
 
 		// getters
@@ -52,7 +57,8 @@ namespace spacelite::Wrapper {
 	inline VulkanImageView::VulkanImageView(
 			VulkanDevice& device,
 			const VkImage& image,
-			const VkFormat& format
+			const VkFormat& format,
+			VkImageAspectFlags aspect
 	) : parent(device), instance(VK_NULL_HANDLE) {
 		VkImageViewCreateInfo vulkanCreateInfo = {};
 
@@ -64,7 +70,7 @@ namespace spacelite::Wrapper {
 		vulkanCreateInfo.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
 		vulkanCreateInfo.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
 		vulkanCreateInfo.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
-		vulkanCreateInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		vulkanCreateInfo.subresourceRange.aspectMask = aspect;
 		vulkanCreateInfo.subresourceRange.baseMipLevel = 0;
 		vulkanCreateInfo.subresourceRange.levelCount = 1;
 		vulkanCreateInfo.subresourceRange.baseArrayLayer = 0;
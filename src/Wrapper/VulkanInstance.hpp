@@ -50,6 +50,7 @@ namespace spacelite::Wrapper {
 
 		VkInstance& get();
 		const VkInstance& get() const;
+		unsigned int getApiVersion() const;
 
 		// not copyable, only moveable
 		VulkanInstance(const VulkanInstance&) = delete;
@@ -59,6 +60,7 @@ namespace spacelite::Wrapper {
 
 	private:
 		VkInstance instance;
+		unsigned int apiVersion;
 
 		VkApplicationInfo getApplicationInfo(const Struct::AppInfo& appInfo, const Struct::EngineInfo& engineInfo);
 		void checkValidationLayers(const Struct::VulkanRequirements& vulkanRequirements);
@@ -78,7 +80,7 @@ namespace spacelite::Wrapper {
 			const Struct::VulkanRequirements& requirements,
 			const Wrapper::VulkanDebugInfo& debugInfo
 #endif
-	) : instance(VK_NULL_HANDLE) {
+	) : instance(VK_NULL_HANDLE), apiVersion(engineInfo.vulkanVersion) {
 		// get application info
 		VkApplicationInfo vulkanApplicationInfo = this->getApplicationInfo(appInfo, engineInfo);
 
@@ -134,6 +136,11 @@ namespace spacelite::Wrapper {
 		return this->instance;
 	}
 
+	// get the (highest) version of the Vulkan API used by the application
+	inline unsigned int VulkanInstance::getApiVersion() const {
+		return this->apiVersion;
+	}
+
 	// set application info
 	inline VkApplicationInfo VulkanInstance::getApplicationInfo(const Struct::AppInfo& appInfo, const Struct::EngineInfo& engineInfo) {
 		VkApplicationInfo vulkanAppInfo = {};
@@ -193,13 +200,15 @@ namespace spacelite::Wrapper {
 	}
 
 	// move constructor
-	inline VulkanInstance::VulkanInstance(VulkanInstance&& other) noexcept : instance(other.instance) {
+	inline VulkanInstance::VulkanInstance(VulkanInstance&& other) noexcept
+			: instance(other.instance), apiVersion(other.apiVersion) {
 		other.instance = VK_NULL_HANDLE;
 	}
 
 	// move assignment
 	inline VulkanInstance& VulkanInstance::operator=(VulkanInstance&& other) noexcept {
 		this->instance = other.instance;
+		this->apiVersion = other.apiVersion;
 
 		other.instance = VK_NULL_HANDLE;
 
@@ -3,6 +3,8 @@
  *
  * Wraps a physical device used by the Vulkan API - and its selection process.
  *
+ * If a thread pool is given, the available devices are rated in parallel.
+ *
  *  Created on: Sep 13, 2019
  *      Author: ans
  */
@@ -14,15 +16,20 @@
 #include "VulkanInstance.hpp"
 #include "VulkanSurface.hpp"
 
+#include "../Helper/ThreadPool.hpp"
 #include "../Main/Exception.hpp"
 #include "../Struct/VulkanQueueFamilies.hpp"
 #include "../Struct/VulkanSwapChainSupport.hpp"
 
 #include <vulkan/vulkan_core.h>
 
-#include <set>		// std::set
-#include <utility>	// std::swap
-#include <vector>	// std::vector
+#include <algorithm>	// std::min
+#include <cstddef>		// std::size_t
+#include <future>		// std::future
+#include <set>			// std::set
+#include <string>		// std::string
+#include <utility>		// std::move, std::swap
+#include <vector>		// std::vector
 
 namespace spacelite::Wrapper {
 	/*
@@ -33,7 +40,8 @@ namespace spacelite::Wrapper {
 		VulkanPhysicalDevice(
 				VulkanInstance& instance,
 				VulkanSurface& surface,
-				const std::vector<const char *>& deviceExtensions
+				const std::vector<const char *>& deviceExtensions,
+				Helper::ThreadPool * threadPool = nullptr
 		);
 		virtual ~VulkanPhysicalDevice();
 
@@ -41,10 +49,21 @@ namespace spacelite::Wrapper {
 		VkPhysicalDevice& get();
 		const VkPhysicalDevice& get() const;
 		Struct::VulkanSwapChainSupport getSwapChainSupport() const;
+		const VkPhysicalDeviceProperties& getProperties() const;
+		unsigned int getApiVersion() const;
+		bool hasExtension(const std::string& name) const;
 
 		// public helper functions
 		const Struct::VulkanQueueFamilies& findQueueFamilies() const;
 		unsigned int findMemoryType(unsigned int typeFilter, VkMemoryPropertyFlags properties) const;
+		bool hasMemoryType(unsigned int typeFilter, VkMemoryPropertyFlags properties) const;
+		VkFormat findSupportedFormat(
+				const std::vector<VkFormat>& candidates,
+				VkImageTiling tiling,
+				VkFormatFeatureFlags features
+		) const;
+		VkFormat findDepthFormat() const;
+		VkSampleCountFlagBits findSampleCount(VkSampleCountFlagBits requested) const;
 
 		// not copyable, only moveable
 		VulkanPhysicalDevice(const VulkanPhysicalDevice&) = delete;
@@ -57,8 +76,11 @@ namespace spacelite::Wrapper {
 		VkPhysicalDevice instance;
 		VulkanSurface& surface;
 		Struct::VulkanQueueFamilies queueFamily;
+		VkPhysicalDeviceProperties properties;
+		std::set<std::string> extensions;
 
 		// private helper functions
+		std::set<std::string> getExtensions(const VkPhysicalDevice& device) const;
 		unsigned int rateDevice(const VkPhysicalDevice& device, const std::vector<const char *>& deviceExtensions) const;
 		Struct::VulkanSwapChainSupport getSwapChainSupport(const VkPhysicalDevice& device) const;
 		Struct::VulkanQueueFamilies findQueueFamilies(const VkPhysicalDevice& device) const;
@@ -74,8 +96,9 @@ namespace spacelite::Wrapper {
 	inline VulkanPhysicalDevice::VulkanPhysicalDevice(
 			VulkanInstance& instance,
 			VulkanSurface& surface,
-			const std::vector<const char *>& deviceExtensions
-	) : parent(instance), instance(VK_NULL_HANDLE), surface(surface) {
+			const std::vector<const char *>& deviceExtensions,
+			Helper::ThreadPool * threadPool
+	) : parent(instance), instance(VK_NULL_HANDLE), surface(surface), properties({}) {
 		unsigned int vulkanDeviceCount = 0;
 
 		vkEnumeratePhysicalDevices(this->parent.get(), &vulkanDeviceCount, nullptr);
@@ -87,16 +110,35 @@ namespace spacelite::Wrapper {
 
 		vkEnumeratePhysicalDevices(this->parent.get(), &vulkanDeviceCount, vulkanDevices.data());
 
+		// rate the devices (in parallel, if possible)
+		std::vector<unsigned int> scores(vulkanDevices.size(), 0);
+
+		if(threadPool && vulkanDevices.size() > 1) {
+			std::vector<std::future<void>> futures;
+
+			futures.reserve(vulkanDevices.size());
+
+			for(std::size_t n = 0; n < vulkanDevices.size(); ++n)
+				futures.emplace_back(
+						threadPool->run([this, &vulkanDevices, &deviceExtensions, &scores, n]() {
+							scores[n] = this->rateDevice(vulkanDevices[n], deviceExtensions);
+						})
+				);
+
+			Helper::ThreadPool::waitForAll(futures);
+		}
+		else
+			for(std::size_t n = 0; n < vulkanDevices.size(); ++n)
+				scores[n] = this->rateDevice(vulkanDevices[n], deviceExtensions);
+
 		unsigned int highScore = 0;
 
-		for(const VkPhysicalDevice& device : vulkanDevices) {
+		for(std::size_t n = 0; n < vulkanDevices.size(); ++n) {
 			// choose current device depending on score
-			unsigned int score = this->rateDevice(device, deviceExtensions);
-
-			if(score > highScore) {
-				this->instance = device;
+			if(scores[n] > highScore) {
+				this->instance = vulkanDevices[n];
 
-				highScore = score;
+				highScore = scores[n];
 			}
 		}
 
@@ -104,6 +146,10 @@ namespace spacelite::Wrapper {
 			throw Exception("Could not find a suitable GPU");
 
 		this->queueFamily = this->findQueueFamilies(this->instance);
+
+		vkGetPhysicalDeviceProperties(this->instance, &(this->properties));
+
+		this->extensions = this->getExtensions(this->instance);
 	}
 
 	// destructor: de-select physical device
@@ -124,6 +170,21 @@ namespace spacelite::Wrapper {
 		return this->getSwapChainSupport(this->instance);
 	}
 
+	// get const reference to the properties (including the limits) of the physical device
+	inline const VkPhysicalDeviceProperties& VulkanPhysicalDevice::getProperties() const {
+		return this->properties;
+	}
+
+	// get the version of the Vulkan API usable with the physical device (i.e. supported by both, device and application)
+	inline unsigned int VulkanPhysicalDevice::getApiVersion() const {
+		return std::min(this->parent.getApiVersion(), this->properties.apiVersion);
+	}
+
+	// check whether the physical device supports the specified extension
+	inline bool VulkanPhysicalDevice::hasExtension(const std::string& name) const {
+		return this->extensions.count(name) > 0;
+	}
+
 	// find memory type
 	inline unsigned int VulkanPhysicalDevice::findMemoryType(unsigned int typeFilter, VkMemoryPropertyFlags properties) const {
 		VkPhysicalDeviceMemoryProperties vulkanMemProperties;
@@ -140,6 +201,67 @@ namespace spacelite::Wrapper {
 		throw Exception("Graphics::vulkanFindMemoryType(): Failed to find suitable memory");
 	}
 
+	// check whether a suitable memory type exists
+	inline bool VulkanPhysicalDevice::hasMemoryType(unsigned int typeFilter, VkMemoryPropertyFlags properties) const {
+		VkPhysicalDeviceMemoryProperties vulkanMemProperties;
+
+		vkGetPhysicalDeviceMemoryProperties(this->instance, &vulkanMemProperties);
+
+		for(unsigned int i = 0; i < vulkanMemProperties.memoryTypeCount; ++i)
+			if(
+					(typeFilter & (1 << i))
+					&& (vulkanMemProperties.memoryTypes[i].propertyFlags & properties) == properties
+			)
+				return true;
+
+		return false;
+	}
+
+	// find the first of the candidate formats that supports the specified features
+	inline VkFormat VulkanPhysicalDevice::findSupportedFormat(
+			const std::vector<VkFormat>& candidates,
+			VkImageTiling tiling,
+			VkFormatFeatureFlags features
+	) const {
+		for(const auto format : candidates) {
+			VkFormatProperties vulkanProperties;
+
+			vkGetPhysicalDeviceFormatProperties(this->instance, format, &vulkanProperties);
+
+			const VkFormatFeatureFlags vulkanFeatures =
+					tiling == VK_IMAGE_TILING_LINEAR ?
+					vulkanProperties.linearTilingFeatures
+					: vulkanProperties.optimalTilingFeatures;
+
+			if((vulkanFeatures & features) == features)
+				return format;
+		}
+
+		throw Exception("Could not find a supported format");
+	}
+
+	// find the format to be used for depth buffers (preferring precision over a stencil component)
+	inline VkFormat VulkanPhysicalDevice::findDepthFormat() const {
+		return this->findSupportedFormat(
+				{ VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT },
+				VK_IMAGE_TILING_OPTIMAL,
+				VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT
+		);
+	}
+
+	// find the highest number of samples per pixel supported for color and depth attachments (up to the requested number)
+	inline VkSampleCountFlagBits VulkanPhysicalDevice::findSampleCount(VkSampleCountFlagBits requested) const {
+		const VkSampleCountFlags vulkanSupported =
+				this->properties.limits.framebufferColorSampleCounts
+				& this->properties.limits.framebufferDepthSampleCounts;
+
+		for(unsigned int n = requested; n > VK_SAMPLE_COUNT_1_BIT; n >>= 1)
+			if(vulkanSupported & n)
+				return static_cast<VkSampleCountFlagBits>(n);
+
+		return VK_SAMPLE_COUNT_1_BIT;
+	}
+
 	// find queue families
 	inline const Struct::VulkanQueueFamilies& VulkanPhysicalDevice::findQueueFamilies() const {
 		return this->queueFamily;
@@ -180,6 +302,24 @@ namespace spacelite::Wrapper {
 			return 0;
 
 		// check for extensions
+		const std::set<std::string> vulkanAvailableExtensions = this->getExtensions(device);
+
+		for(const auto& extension : deviceExtensions)
+			if(!vulkanAvailableExtensions.count(extension))
+				return 0;
+
+		// check whether swap chain is adequate
+		Struct::VulkanSwapChainSupport vulkanSwapChainSupport = this->getSwapChainSupport(device);
+
+		if(vulkanSwapChainSupport.formats.empty() || vulkanSwapChainSupport.presentModes.empty())
+			return 0;
+
+		// device could be used: return score
+		return score;
+	}
+
+	// get the names of the extensions supported by the specified physical device
+	inline std::set<std::string> VulkanPhysicalDevice::getExtensions(const VkPhysicalDevice& device) const {
 		unsigned int vulkanExtensionCount = 0;
 
 		vkEnumerateDeviceExtensionProperties(device, nullptr, &vulkanExtensionCount, nullptr);
@@ -193,28 +333,17 @@ namespace spacelite::Wrapper {
 				vulkanAvailableExtensions.data()
 		);
 
-		std::set<std::string> vulkanRequiredExtensions(
-				deviceExtensions.begin(),
-				deviceExtensions.end()
-		);
+		std::set<std::string> result;
 
 		for(const auto& extension : vulkanAvailableExtensions)
-			vulkanRequiredExtensions.erase(extension.extensionName);
-
-		if(!vulkanRequiredExtensions.empty())
-			return 0;
+			result.emplace(extension.extensionName);
 
-		// check whether swap chain is adequate
-		Struct::VulkanSwapChainSupport vulkanSwapChainSupport = this->getSwapChainSupport(device);
-
-		if(vulkanSwapChainSupport.formats.empty() || vulkanSwapChainSupport.presentModes.empty())
-			return 0;
-
-		// device could be used: return score
-		return score;
+		return result;
 	}
 
 	// find queue families for the specified physical device
+	//  NOTE:	Presentation from the graphics family is preferred,
+	//			while compute and transfer families are only used if they are dedicated to this kind of work.
 	inline Struct::VulkanQueueFamilies VulkanPhysicalDevice::findQueueFamilies(const VkPhysicalDevice& device) const {
 		Struct::VulkanQueueFamilies vulkanQueueFamilyIndices;
 
@@ -226,7 +355,7 @@ namespace spacelite::Wrapper {
 
 		vkGetPhysicalDeviceQueueFamilyProperties(device, &vulkanQueueFamilyCount, vulkanQueueFamilies.data());
 
-		int i = 0;
+		unsigned int i = 0;
 
 		for(const auto& queueFamily : vulkanQueueFamilies) {
 			VkBool32 presentSupport = false;
@@ -234,15 +363,28 @@ namespace spacelite::Wrapper {
 			vkGetPhysicalDeviceSurfaceSupportKHR(device, i, this->surface.get(), &presentSupport);
 
 			if(queueFamily.queueCount > 0) {
-				if(queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT)
+				const bool isGraphics = queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT;
+				const bool isCompute = queueFamily.queueFlags & VK_QUEUE_COMPUTE_BIT;
+				const bool isTransfer = queueFamily.queueFlags & VK_QUEUE_TRANSFER_BIT;
+
+				if(isGraphics && !vulkanQueueFamilyIndices.graphicsFamily.has_value())
 					vulkanQueueFamilyIndices.graphicsFamily = i;
 
-				if(presentSupport)
+				if(
+						presentSupport
+						&& (
+								!vulkanQueueFamilyIndices.presentFamily.has_value()
+								|| vulkanQueueFamilyIndices.graphicsFamily == i
+						)
+				)
 					vulkanQueueFamilyIndices.presentFamily = i;
-			}
 
-			if(vulkanQueueFamilyIndices.isComplete())
-				break;
+				if(isCompute && !isGraphics && !vulkanQueueFamilyIndices.computeFamily.has_value())
+					vulkanQueueFamilyIndices.computeFamily = i;
+
+				if(isTransfer && !isGraphics && !isCompute && !vulkanQueueFamilyIndices.transferFamily.has_value())
+					vulkanQueueFamilyIndices.transferFamily = i;
+			}
 
 		    ++i;
 		}
@@ -294,7 +436,9 @@ namespace spacelite::Wrapper {
 			:	parent(other.parent),
 				instance(other.instance),
 				surface(other.surface),
-				queueFamily(other.queueFamily) {
+				queueFamily(other.queueFamily),
+				properties(other.properties),
+				extensions(std::move(other.extensions)) {
 		other.instance = VK_NULL_HANDLE;
 	}
 
@@ -309,6 +453,8 @@ namespace spacelite::Wrapper {
 		swap(this->parent, other.parent);
 		swap(this->surface, other.surface);
 		swap(this->queueFamily, other.queueFamily);
+		swap(this->properties, other.properties);
+		swap(this->extensions, other.extensions);
 
 		return *this;
 	}
@@ -3,6 +3,16 @@
  *
  * Wraps a graphics pipeline used by the Vulkan API.
  *
+ * Specialized variants of an existing pipeline share its (already loaded) shader code.
+ *
+ * Viewport and scissor are dynamic, i.e. they need to be set when recording the command buffer.
+ *
+ * The pipeline layout is generated from the resources used by the shaders, as reflected from their SPIR-V code,
+ *  while the vertex inputs of the vertex shader are validated against the vertex format (if the pipeline uses it).
+ *  If the shaders use push constants, they need to start with the transform of a draw.
+ *
+ * Keeps track of the time needed for loading and compiling shaders by all instances (e.g. for startup reports).
+ *
  *  Created on: Sep 13, 2019
  *      Author: ans
  */
@@ -12,18 +22,33 @@
 
 #include "VulkanDevice.hpp"
 #include "VulkanError.hpp"
+#include "VulkanPipelineLayout.hpp"
+#include "VulkanPipelineLayoutCache.hpp"
 #include "VulkanRenderPass.hpp"
 #include "VulkanShaderModule.hpp"
 
-#include "../Helper/File.hpp"
+#include "../Helper/FileCache.hpp"
+#include "../Helper/SpirVReflection.hpp"
+#include "../Helper/TimerHighRes.hpp"
+#include "../Helper/Trace.hpp"
 #include "../Helper/VulkanAllocator.hpp"
 #include "../Main/Exception.hpp"
 #include "../Struct/ShaderFiles.hpp"
+#include "../Struct/ShaderReflection.hpp"
+#include "../Struct/Vertex.hpp"
+#include "../Struct/VulkanDraw.hpp"
+#include "../Struct/VulkanPipelineState.hpp"
+#include "../Struct/VulkanSpecialization.hpp"
 
 #include <vulkan/vulkan_core.h>
 
-#include <utility>	// std::move, std::swap
-#include <vector>	// std::vector
+#include <algorithm>	// std::max, std::min
+#include <atomic>		// std::atomic
+#include <cstdint>		// std::uint32_t
+#include <memory>		// std::make_shared, std::shared_ptr
+#include <string>		// std::string, std::to_string
+#include <utility>		// std::move, std::swap
+#include <vector>		// std::vector
 
 namespace spacelite::Wrapper {
 
@@ -35,8 +60,20 @@ namespace spacelite::Wrapper {
 		VulkanPipeline(
 				VulkanDevice& device,
 				VulkanRenderPass& renderPass,
-				VkExtent2D& targetExtent,
-				const Struct::ShaderFiles& shaderFiles
+				const Struct::ShaderFiles& shaderFiles,
+				const Struct::VulkanPipelineState& pipelineState = Struct::VulkanPipelineState(),
+				const Struct::ShaderConstants& shaderConstants = Struct::ShaderConstants(),
+				VkPipelineCache pipelineCache = VK_NULL_HANDLE,
+				VulkanPipelineLayoutCache * pipelineLayoutCache = nullptr
+		);
+		VulkanPipeline(
+				const VulkanPipeline& base,
+				const Struct::ShaderConstants& shaderConstants
+		);
+		VulkanPipeline(
+				const VulkanPipeline& base,
+				const Struct::VulkanPipelineState& pipelineState,
+				const Struct::ShaderConstants& shaderConstants
 		);
 		virtual ~VulkanPipeline();
 
@@ -47,6 +84,18 @@ namespace spacelite::Wrapper {
 		// getters
 		VkPipeline& get();
 		const VkPipeline& get() const;
+		const Struct::ShaderConstants& getShaderConstants() const;
+		const Struct::VulkanPipelineState& getState() const;
+		VkPipelineLayout& getLayout();
+		const VkPipelineLayout& getLayout() const;
+		const Struct::VulkanPipelineLayoutInfo& getLayoutInfo() const;
+		VkDescriptorSetLayout getSetLayout(std::uint32_t set) const;
+		const Struct::ShaderReflection& getVertexShaderReflection() const;
+		const Struct::ShaderReflection& getFragmentShaderReflection() const;
+
+		// statistics (for all instances, summed over all threads, in ms)
+		static double getLoadingTime();
+		static double getCompilationTime();
 
 		// not copyable, only moveable
 		VulkanPipeline(const VulkanPipeline&) = delete;
@@ -57,12 +106,29 @@ namespace spacelite::Wrapper {
 	private:
 		VulkanDevice& parent;
 		VkPipeline instance;
-		VkPipelineLayout layout;
+		std::shared_ptr<VulkanPipelineLayout> layout;
 		VulkanRenderPass& pass;
-		VkExtent2D& extent;
+		VkPipelineCache cache;
+		VulkanPipelineLayoutCache * layoutCache;
+
+		std::shared_ptr<const std::vector<char>> vertexShader;
+		std::shared_ptr<const std::vector<char>> fragmentShader;
+		std::shared_ptr<const Struct::ShaderReflection> vertexReflection;
+		std::shared_ptr<const Struct::ShaderReflection> fragmentReflection;
+
+		Struct::ShaderConstants constants;
+		Struct::VulkanPipelineState state;
+
+		// check the shader stages, the push constants and the vertex inputs of the vertex shader against the vertex format
+		void validate() const;
+
+		// read and reflect shader code
+		static std::shared_ptr<const std::vector<char>> load(const std::string& fileName);
+		static std::shared_ptr<const Struct::ShaderReflection> reflect(const std::vector<char>& shader);
 
-		std::vector<char> vertexShader;
-		std::vector<char> fragmentShader;
+		// time needed for loading (i.e. reading and reflecting) and compiling shaders (in μs)
+		static std::atomic<unsigned long long> loadingTime;
+		static std::atomic<unsigned long long> compilationTime;
 
 		MAIN_EXCEPTION_CLASS();
 	};
@@ -70,20 +136,58 @@ namespace spacelite::Wrapper {
 	/*
 	 * IMPLEMENTATION
 	 */
+
+	inline std::atomic<unsigned long long> VulkanPipeline::loadingTime{0};
+	inline std::atomic<unsigned long long> VulkanPipeline::compilationTime{0};
+
 	// constructor: outsourced to create()
 	inline VulkanPipeline::VulkanPipeline(
 			VulkanDevice& device,
 			VulkanRenderPass& renderPass,
-			VkExtent2D& targetExtent,
-			const Struct::ShaderFiles& shaderFiles
+			const Struct::ShaderFiles& shaderFiles,
+			const Struct::VulkanPipelineState& pipelineState,
+			const Struct::ShaderConstants& shaderConstants,
+			VkPipelineCache pipelineCache,
+			VulkanPipelineLayoutCache * pipelineLayoutCache
 	)
 			: parent(device),
 			  instance(VK_NULL_HANDLE),
-			  layout(VK_NULL_HANDLE),
 			  pass(renderPass),
-			  extent(targetExtent),
-			  vertexShader(Helper::File::readBinary(shaderFiles.vertexShader)),
-			  fragmentShader(Helper::File::readBinary(shaderFiles.fragmentShader)) {
+			  cache(pipelineCache),
+			  layoutCache(pipelineLayoutCache),
+			  vertexShader(VulkanPipeline::load(shaderFiles.vertexShader)),
+			  fragmentShader(VulkanPipeline::load(shaderFiles.fragmentShader)),
+			  vertexReflection(VulkanPipeline::reflect(*(this->vertexShader))),
+			  fragmentReflection(VulkanPipeline::reflect(*(this->fragmentShader))),
+			  constants(shaderConstants),
+			  state(pipelineState) {
+		this->create();
+	}
+
+	// constructor for a specialized variant of an existing pipeline, sharing its shader code and state
+	inline VulkanPipeline::VulkanPipeline(
+			const VulkanPipeline& base,
+			const Struct::ShaderConstants& shaderConstants
+	) : VulkanPipeline(base, base.state, shaderConstants) {}
+
+	// constructor for a variant of an existing pipeline, sharing its shader code and layout: outsourced to create()
+	inline VulkanPipeline::VulkanPipeline(
+			const VulkanPipeline& base,
+			const Struct::VulkanPipelineState& pipelineState,
+			const Struct::ShaderConstants& shaderConstants
+	)
+			: parent(base.parent),
+			  instance(VK_NULL_HANDLE),
+			  layout(base.layout),
+			  pass(base.pass),
+			  cache(base.cache),
+			  layoutCache(base.layoutCache),
+			  vertexShader(base.vertexShader),
+			  fragmentShader(base.fragmentShader),
+			  vertexReflection(base.vertexReflection),
+			  fragmentReflection(base.fragmentReflection),
+			  constants(shaderConstants),
+			  state(pipelineState) {
 		this->create();
 	}
 
@@ -102,11 +206,82 @@ namespace spacelite::Wrapper {
 		return this->instance;
 	}
 
+	// get const reference to the specialization constants of the graphics pipeline
+	inline const Struct::ShaderConstants& VulkanPipeline::getShaderConstants() const {
+		return this->constants;
+	}
+
+	// get const reference to the fixed-function state of the graphics pipeline
+	inline const Struct::VulkanPipelineState& VulkanPipeline::getState() const {
+		return this->state;
+	}
+
+	// get reference to the layout of the graphics pipeline
+	inline VkPipelineLayout& VulkanPipeline::getLayout() {
+		if(!(this->layout))
+			throw Exception("Graphics pipeline has no layout");
+
+		return this->layout->get();
+	}
+
+	// get const reference to the layout of the graphics pipeline
+	inline const VkPipelineLayout& VulkanPipeline::getLayout() const {
+		if(!(this->layout))
+			throw Exception("Graphics pipeline has no layout");
+
+		return this->layout->get();
+	}
+
+	// get const reference to the description of the layout of the graphics pipeline
+	inline const Struct::VulkanPipelineLayoutInfo& VulkanPipeline::getLayoutInfo() const {
+		if(!(this->layout))
+			throw Exception("Graphics pipeline has no layout");
+
+		return this->layout->getInfo();
+	}
+
+	// get the layout of a descriptor set used by the graphics pipeline
+	inline VkDescriptorSetLayout VulkanPipeline::getSetLayout(std::uint32_t set) const {
+		if(!(this->layout))
+			throw Exception("Graphics pipeline has no layout");
+
+		return this->layout->getSetLayout(set);
+	}
+
+	// get const reference to the reflected resources of the vertex shader
+	inline const Struct::ShaderReflection& VulkanPipeline::getVertexShaderReflection() const {
+		return *(this->vertexReflection);
+	}
+
+	// get const reference to the reflected resources of the fragment shader
+	inline const Struct::ShaderReflection& VulkanPipeline::getFragmentShaderReflection() const {
+		return *(this->fragmentReflection);
+	}
+
+	// get the time needed for loading shaders by all instances (summed over all threads, in ms)
+	inline double VulkanPipeline::getLoadingTime() {
+		return static_cast<double>(VulkanPipeline::loadingTime) / 1000;
+	}
+
+	// get the time needed for compiling shaders and creating pipelines by all instances (summed over all threads, in ms)
+	inline double VulkanPipeline::getCompilationTime() {
+		return static_cast<double>(VulkanPipeline::compilationTime) / 1000;
+	}
+
 	// create the graphics pipeline
 	inline void VulkanPipeline::create() {
+		const Helper::Trace::Zone zone("pipeline creation");
+		const Helper::TimerHighRes timer;
+
+		this->validate();
+
 		// setup shaders
-		VulkanShaderModule vulkanVertShaderModule(this->parent, this->vertexShader);
-		VulkanShaderModule fragShaderModule(this->parent, this->fragmentShader);
+		VulkanShaderModule vulkanVertShaderModule(this->parent, *(this->vertexShader));
+		VulkanShaderModule fragShaderModule(this->parent, *(this->fragmentShader));
+
+		// setup shader constants (the infos point into the constants, which will not change until the pipeline has been created)
+		const VkSpecializationInfo vulkanVertSpecializationInfo = this->constants.vertexShader.getInfo();
+		const VkSpecializationInfo vulkanFragSpecializationInfo = this->constants.fragmentShader.getInfo();
 
 		VkPipelineShaderStageCreateInfo vulkanVertShaderStageInfo = {};
 
@@ -114,7 +289,8 @@ namespace spacelite::Wrapper {
 		vulkanVertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;	// shader stage
 		vulkanVertShaderStageInfo.module = vulkanVertShaderModule.get();// shader code
 		vulkanVertShaderStageInfo.pName = "main";						// shader entry point
-		vulkanVertShaderStageInfo.pSpecializationInfo = nullptr;		// shader constants (none atm)
+		vulkanVertShaderStageInfo.pSpecializationInfo =				// shader constants
+				this->constants.vertexShader.empty() ? nullptr : &vulkanVertSpecializationInfo;
 
 		VkPipelineShaderStageCreateInfo vulkanFragShaderStageInfo = {};
 
@@ -122,51 +298,49 @@ namespace spacelite::Wrapper {
 		vulkanFragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;	// shader stage
 		vulkanFragShaderStageInfo.module = fragShaderModule.get();		// shader code
 		vulkanFragShaderStageInfo.pName = "main";						// shader entry point
-		vulkanFragShaderStageInfo.pSpecializationInfo = nullptr;		// shader constants (none atm)
+		vulkanFragShaderStageInfo.pSpecializationInfo =				// shader constants
+				this->constants.fragmentShader.empty() ? nullptr : &vulkanFragSpecializationInfo;
 
 		VkPipelineShaderStageCreateInfo vulkanShaderStages[] = { vulkanVertShaderStageInfo, vulkanFragShaderStageInfo };
 
-		// setup vertex input
+		// setup vertex input (none if the vertices are generated by the vertex shader)
 		VkPipelineVertexInputStateCreateInfo vulkanVertexInputInfo = {};
 
 		auto vulkanBindingDescription = Struct::Vertex::getBindingDescription();
 		auto vulkanAttributeDescriptions = Struct::Vertex::getAttributeDescriptions();
 
 		vulkanVertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-		vulkanVertexInputInfo.vertexBindingDescriptionCount = 1;
-		vulkanVertexInputInfo.vertexAttributeDescriptionCount = static_cast<unsigned int>(vulkanAttributeDescriptions.size());;
-		vulkanVertexInputInfo.pVertexBindingDescriptions = &vulkanBindingDescription;
-		vulkanVertexInputInfo.pVertexAttributeDescriptions = vulkanAttributeDescriptions.data();
+
+		if(this->state.vertexInput) {
+			vulkanVertexInputInfo.vertexBindingDescriptionCount = 1;
+			vulkanVertexInputInfo.vertexAttributeDescriptionCount = static_cast<unsigned int>(vulkanAttributeDescriptions.size());
+			vulkanVertexInputInfo.pVertexBindingDescriptions = &vulkanBindingDescription;
+			vulkanVertexInputInfo.pVertexAttributeDescriptions = vulkanAttributeDescriptions.data();
+		}
 
 		// setup input assembly
 		VkPipelineInputAssemblyStateCreateInfo vulkanInputAssembly = {};
 
 		vulkanInputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-		vulkanInputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		vulkanInputAssembly.topology = this->state.topology;
 		vulkanInputAssembly.primitiveRestartEnable = VK_FALSE;
 
-		// setup viewport and scissor
-		VkViewport vulkanViewport = {};
-
-		vulkanViewport.x = 0.0f;
-		vulkanViewport.y = 0.0f;
-		vulkanViewport.width = (float) this->extent.width;
-		vulkanViewport.height = (float) this->extent.height;
-		vulkanViewport.minDepth = 0.0f;
-		vulkanViewport.maxDepth = 1.0f;
-
-		VkRect2D vulkanScissor = {};
-
-		vulkanScissor.offset = {0, 0};
-		vulkanScissor.extent = this->extent;
-
+		// setup viewport and scissor (both dynamic, so that the pipeline does not depend on the extent of the swap chain)
 		VkPipelineViewportStateCreateInfo vulkanViewportState = {};
 
 		vulkanViewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
 		vulkanViewportState.viewportCount = 1;
-		vulkanViewportState.pViewports = &vulkanViewport;
+		vulkanViewportState.pViewports = nullptr;
 		vulkanViewportState.scissorCount = 1;
-		vulkanViewportState.pScissors = &vulkanScissor;
+		vulkanViewportState.pScissors = nullptr;
+
+		const VkDynamicState vulkanDynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+
+		VkPipelineDynamicStateCreateInfo vulkanDynamicState = {};
+
+		vulkanDynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+		vulkanDynamicState.dynamicStateCount = 2;
+		vulkanDynamicState.pDynamicStates = vulkanDynamicStates;
 
 		// setup vulkanRasterizer
 		VkPipelineRasterizationStateCreateInfo vulkanRasterizer = {};
@@ -174,10 +348,10 @@ namespace spacelite::Wrapper {
 		vulkanRasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
 		vulkanRasterizer.depthClampEnable = VK_FALSE;
 		vulkanRasterizer.rasterizerDiscardEnable = VK_FALSE;
-		vulkanRasterizer.polygonMode = VK_POLYGON_MODE_FILL;
-		vulkanRasterizer.lineWidth = 1.0f;
-		vulkanRasterizer.cullMode = VK_CULL_MODE_BACK_BIT;
-		vulkanRasterizer.frontFace = VK_FRONT_FACE_CLOCKWISE;
+		vulkanRasterizer.polygonMode = this->state.polygonMode;
+		vulkanRasterizer.lineWidth = this->state.lineWidth;
+		vulkanRasterizer.cullMode = this->state.cullMode;
+		vulkanRasterizer.frontFace = this->state.frontFace;
 		vulkanRasterizer.depthBiasEnable = VK_FALSE;
 		vulkanRasterizer.depthBiasConstantFactor = 0.0f;
 		vulkanRasterizer.depthBiasClamp = 0.0f;
@@ -188,7 +362,8 @@ namespace spacelite::Wrapper {
 
 		vulkanMultisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
 		vulkanMultisampling.sampleShadingEnable = VK_FALSE;
-		vulkanMultisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+		vulkanMultisampling.rasterizationSamples = // needs to match the attachments of the subpass
+				this->state.subpass ? VK_SAMPLE_COUNT_1_BIT : this->pass.getSamples();
 		vulkanMultisampling.minSampleShading = 1.0f;
 		vulkanMultisampling.pSampleMask = nullptr;
 		vulkanMultisampling.alphaToCoverageEnable = VK_FALSE;
@@ -197,19 +372,23 @@ namespace spacelite::Wrapper {
 		// setup alpha and color blending
 		VkPipelineColorBlendAttachmentState vulkanColorBlendAttachment = {};
 
-		vulkanColorBlendAttachment.colorWriteMask =
+		vulkanColorBlendAttachment.colorWriteMask = this->state.depthOnly ? 0 :
 				VK_COLOR_COMPONENT_R_BIT
 				| VK_COLOR_COMPONENT_G_BIT
 				| VK_COLOR_COMPONENT_B_BIT
 				| VK_COLOR_COMPONENT_A_BIT;
-/* to enable alpha blending:
-		vulkanColorBlendAttachment.blendEnable = VK_TRUE;
-		vulkanColorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
-		vulkanColorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
-*/
-		vulkanColorBlendAttachment.blendEnable = VK_FALSE;
-		vulkanColorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
-		vulkanColorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
+
+		if(this->state.alphaBlending) {
+			vulkanColorBlendAttachment.blendEnable = VK_TRUE;
+			vulkanColorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+			vulkanColorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+		}
+		else {
+			vulkanColorBlendAttachment.blendEnable = VK_FALSE;
+			vulkanColorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+			vulkanColorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
+		}
+
 		vulkanColorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
 		vulkanColorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
 		vulkanColorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
@@ -227,59 +406,83 @@ namespace spacelite::Wrapper {
 		vulkanColorBlending.blendConstants[2] = 0.0f;
 		vulkanColorBlending.blendConstants[3] = 0.0f;
 
-		// setup pipeline layout
-		VkPipelineLayoutCreateInfo vulkanPipelineLayoutInfo = {};
-
-		vulkanPipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-		vulkanPipelineLayoutInfo.setLayoutCount = 0;
-		vulkanPipelineLayoutInfo.pSetLayouts = nullptr;
-		vulkanPipelineLayoutInfo.pushConstantRangeCount = 0;
-		vulkanPipelineLayoutInfo.pPushConstantRanges = nullptr;
-
-		VkResult vulkanResult = vkCreatePipelineLayout(
-				this->parent.get(),
-				&vulkanPipelineLayoutInfo,
-				Helper::VulkanAllocator::ptr,
-				&(this->layout)
-		);
-
-		if(vulkanResult != VK_SUCCESS)
-			throw Exception("Could not create graphics pipeline layout: " + Wrapper::VulkanError(vulkanResult).str());
+		// setup depth testing (only used if the subpass has a depth attachment)
+		const bool useDepth = this->pass.hasDepth() && !(this->state.subpass);
+
+		VkPipelineDepthStencilStateCreateInfo vulkanDepthStencil = {};
+
+		vulkanDepthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+		vulkanDepthStencil.depthTestEnable = this->state.depthTest ? VK_TRUE : VK_FALSE;
+		vulkanDepthStencil.depthWriteEnable = this->state.depthWrite ? VK_TRUE : VK_FALSE;
+		vulkanDepthStencil.depthCompareOp = this->state.depthCompareOp;
+		vulkanDepthStencil.depthBoundsTestEnable = VK_FALSE;
+		vulkanDepthStencil.stencilTestEnable = VK_FALSE;
+		vulkanDepthStencil.minDepthBounds = 0.0f;
+		vulkanDepthStencil.maxDepthBounds = 1.0f;
+
+		// setup pipeline layout (generated from the shaders and shared with other pipelines using the same resources)
+		if(!(this->layout)) {
+			const Struct::VulkanPipelineLayoutInfo layoutInfo = VulkanPipelineLayout::describe(
+					{ this->vertexReflection.get(), this->fragmentReflection.get() }
+			);
+
+			if(this->layoutCache)
+				this->layout = this->layoutCache->add(layoutInfo);
+			else
+				this->layout = std::make_shared<VulkanPipelineLayout>(this->parent, layoutInfo);
+		}
 
 		// setup graphics pipeline
 		VkGraphicsPipelineCreateInfo vulkanPipelineInfo = {};
 
 		vulkanPipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-		vulkanPipelineInfo.stageCount = 2;
+		vulkanPipelineInfo.stageCount = this->state.depthOnly ? 1 : 2; // no fragment shader for a depth prepass
 		vulkanPipelineInfo.pStages = vulkanShaderStages;
 		vulkanPipelineInfo.pVertexInputState = &vulkanVertexInputInfo;
 		vulkanPipelineInfo.pInputAssemblyState = &vulkanInputAssembly;
 		vulkanPipelineInfo.pViewportState = &vulkanViewportState;
 		vulkanPipelineInfo.pRasterizationState = &vulkanRasterizer;
 		vulkanPipelineInfo.pMultisampleState = &vulkanMultisampling;
-		vulkanPipelineInfo.pDepthStencilState = nullptr;
+		vulkanPipelineInfo.pDepthStencilState = useDepth ? &vulkanDepthStencil : nullptr;
 		vulkanPipelineInfo.pColorBlendState = &vulkanColorBlending;
-		vulkanPipelineInfo.pDynamicState = nullptr;
-		vulkanPipelineInfo.layout = this->layout;
-		vulkanPipelineInfo.renderPass = this->pass.get();
-		vulkanPipelineInfo.subpass = 0;
+		vulkanPipelineInfo.pDynamicState = &vulkanDynamicState;
+		vulkanPipelineInfo.layout = this->layout->get();
+		vulkanPipelineInfo.renderPass = this->pass.get(); // none with dynamic rendering
+		vulkanPipelineInfo.subpass = this->state.subpass;
 		vulkanPipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
 		vulkanPipelineInfo.basePipelineIndex = -1;
 
-		vulkanResult = vkCreateGraphicsPipelines(
+#ifdef VK_KHR_dynamic_rendering
+		// set the formats of the attachments instead of the render pass object when using dynamic rendering
+		VkPipelineRenderingCreateInfoKHR vulkanRenderingInfo = {};
+
+		if(this->pass.isDynamic()) {
+			vulkanRenderingInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+			vulkanRenderingInfo.colorAttachmentCount = 1;
+			vulkanRenderingInfo.pColorAttachmentFormats = &(this->pass.getFormat());
+			vulkanRenderingInfo.depthAttachmentFormat = useDepth ? this->pass.getDepthFormat() : VK_FORMAT_UNDEFINED;
+
+			vulkanPipelineInfo.pNext = &vulkanRenderingInfo;
+		}
+#endif
+
+		VkResult vulkanResult = vkCreateGraphicsPipelines(
 				this->parent.get(),
-				VK_NULL_HANDLE,
+				this->cache,
 				1,
 				&vulkanPipelineInfo,
 				Helper::VulkanAllocator::ptr,
 				&(this->instance)
 		);
 
+		VulkanPipeline::compilationTime += timer.since();
+
 		if(vulkanResult != VK_SUCCESS)
 			throw Exception("Could not create graphics pipeline: " + Wrapper::VulkanError(vulkanResult).str());
 	}
 
 	// destroy the graphics pipeline (may not throw an exception as it is used by the destructor, too)
+	//  NOTE:	The pipeline layout will only be destroyed when it is not used anymore.
 	inline void VulkanPipeline::destroy() noexcept {
 		if(this->instance) {
 			vkDestroyPipeline(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
@@ -287,41 +490,140 @@ namespace spacelite::Wrapper {
 			this->instance = VK_NULL_HANDLE;
 		}
 
-		if(this->layout) {
-			vkDestroyPipelineLayout(this->parent.get(), this->layout, Helper::VulkanAllocator::ptr);
+		this->layout.reset();
+	}
 
-			this->layout = VK_NULL_HANDLE;
+	// check the shader stages, the push constants and the vertex inputs of the vertex shader against the vertex format
+	inline void VulkanPipeline::validate() const {
+		if(this->vertexReflection->stage != VK_SHADER_STAGE_VERTEX_BIT)
+			throw Exception("Vertex shader is not a vertex shader");
+
+		if(this->fragmentReflection->stage != VK_SHADER_STAGE_FRAGMENT_BIT)
+			throw Exception("Fragment shader is not a fragment shader");
+
+		if(this->state.subpass > (this->pass.hasPostProcessingSubpass() ? 1 : 0))
+			throw Exception("Render pass has no subpass #" + std::to_string(this->state.subpass));
+
+		// the transform of each draw will be pushed to the beginning of the push constants (if used)
+		constexpr std::uint32_t transformSize = sizeof(Struct::VulkanDraw::transform);
+
+		bool hasPushConstants = false;
+		std::uint32_t pushConstantsBegin = 0;
+		std::uint32_t pushConstantsEnd = 0;
+
+		for(const auto * reflection : { this->vertexReflection.get(), this->fragmentReflection.get() })
+			for(const auto& range : reflection->pushConstantRanges) {
+				if(hasPushConstants) {
+					pushConstantsBegin = std::min(pushConstantsBegin, range.offset);
+					pushConstantsEnd = std::max(pushConstantsEnd, range.offset + range.size);
+				}
+				else {
+					pushConstantsBegin = range.offset;
+					pushConstantsEnd = range.offset + range.size;
+					hasPushConstants = true;
+				}
+			}
+
+		if(hasPushConstants && (pushConstantsBegin || pushConstantsEnd < transformSize))
+			throw Exception(
+					"Push constants do not cover the transform of a draw (i.e. bytes 0 to "
+					+ std::to_string(transformSize - 1)
+					+ ")"
+			);
+
+		if(!(this->state.vertexInput)) {
+			if(!(this->vertexReflection->vertexInputs.empty()))
+				throw Exception("Vertex shader uses vertex inputs, but the pipeline has none");
+
+			return;
 		}
+
+		const auto vulkanAttributeDescriptions = Struct::Vertex::getAttributeDescriptions();
+
+		for(const auto& input : this->vertexReflection->vertexInputs) {
+			bool found = false;
+
+			for(const auto& vulkanAttributeDescription : vulkanAttributeDescriptions)
+				if(vulkanAttributeDescription.location == input.location) {
+					if(vulkanAttributeDescription.format != input.format)
+						throw Exception(
+								"Vertex shader input at location #"
+								+ std::to_string(input.location)
+								+ " does not match the vertex format"
+						);
+
+					found = true;
+
+					break;
+				}
+
+			if(!found)
+				throw Exception(
+						"Vertex shader input at location #"
+						+ std::to_string(input.location)
+						+ " is not provided by the vertex format"
+				);
+		}
+	}
+
+	// read shader code from a file (unless it has been preloaded)
+	inline std::shared_ptr<const std::vector<char>> VulkanPipeline::load(const std::string& fileName) {
+		const Helper::TimerHighRes timer;
+
+		auto result = Helper::FileCache::get(fileName);
+
+		VulkanPipeline::loadingTime += timer.since();
+
+		return result;
+	}
+
+	// reflect the resources used by shader code
+	inline std::shared_ptr<const Struct::ShaderReflection> VulkanPipeline::reflect(const std::vector<char>& shader) {
+		const Helper::TimerHighRes timer;
+
+		auto result = std::make_shared<const Struct::ShaderReflection>(Helper::SpirVReflection(shader).get());
+
+		VulkanPipeline::loadingTime += timer.since();
+
+		return result;
 	}
 
 	// move constructor
 	inline VulkanPipeline::VulkanPipeline(VulkanPipeline&& other) noexcept
 			:	parent(other.parent),
 				instance(other.instance),
-				layout(other.layout),
+				layout(std::move(other.layout)),
 				pass(other.pass),
-				extent(other.extent),
+				cache(other.cache),
+				layoutCache(other.layoutCache),
 				vertexShader(std::move(other.vertexShader)),
-				fragmentShader(std::move(other.fragmentShader)) {
+				fragmentShader(std::move(other.fragmentShader)),
+				vertexReflection(std::move(other.vertexReflection)),
+				fragmentReflection(std::move(other.fragmentReflection)),
+				constants(std::move(other.constants)),
+				state(other.state) {
 		other.instance = VK_NULL_HANDLE;
-		other.layout = VK_NULL_HANDLE;
 	}
 
 	// move assignment
 	inline VulkanPipeline& VulkanPipeline::operator=(VulkanPipeline&& other) noexcept {
 		this->instance = other.instance;
-		this->layout = other.layout;
 
 		other.instance = VK_NULL_HANDLE;
-		other.layout = VK_NULL_HANDLE;
 
 		using std::swap;
 
 		swap(this->parent, other.parent);
 		swap(this->pass, other.pass);
-		swap(this->extent, other.extent);
+		swap(this->layout, other.layout);
+		swap(this->cache, other.cache);
+		swap(this->layoutCache, other.layoutCache);
 		swap(this->vertexShader, other.vertexShader);
 		swap(this->fragmentShader, other.fragmentShader);
+		swap(this->vertexReflection, other.vertexReflection);
+		swap(this->fragmentReflection, other.fragmentReflection);
+		swap(this->constants, other.constants);
+		swap(this->state, other.state);
 
 		return *this;
 	}
@@ -0,0 +1,682 @@
+/*
+ * VulkanPipelineCache.hpp
+ *
+ * Wraps a pipeline cache used by the Vulkan API and keeps all graphics pipelines created with it.
+ *
+ * Pipelines are identified by their shaders, their specialization constants, their fixed-function state
+ *  and the compatibility of the render pass, so that draws with the same description share one pipeline.
+ *
+ * Pipelines using the same resources share their pipeline layouts, which are kept in a separate cache.
+ *
+ * Batches of pipelines can be created in parallel, because the pipeline cache is internally synchronized.
+ *
+ * The data of the pipeline cache can be stored (e.g. in a file) and used to initialize it on the next run.
+ *  Data not matching the device or its driver will be ignored by the driver.
+ *
+ * Pipelines can also be created asynchronously in the background (e.g. when a new variant is needed at runtime).
+ *  Until such a pipeline is ready, draws using it will be drawn with the fallback pipeline instead (if set) or skipped.
+ *  If the creation of such a pipeline fails, the error is logged and the pipeline is marked as failed,
+ *  so that draws using it keep falling back without it being created again.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANPIPELINECACHE_HPP_
+#define SRC_WRAPPER_VULKANPIPELINECACHE_HPP_
+
+#include "VulkanDevice.hpp"
+#include "VulkanError.hpp"
+#include "VulkanPipeline.hpp"
+#include "VulkanPipelineLayoutCache.hpp"
+#include "VulkanRenderPass.hpp"
+
+#include "../Helper/Hash.hpp"
+#include "../Helper/Log.hpp"
+#include "../Helper/ThreadPool.hpp"
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Main/Exception.hpp"
+#include "../Struct/ShaderFiles.hpp"
+#include "../Struct/VulkanPipelineRequest.hpp"
+#include "../Struct/VulkanPipelineState.hpp"
+#include "../Struct/VulkanSpecialization.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstddef>			// std::size_t
+#include <exception>			// std::exception
+#include <chrono>			// std::chrono::seconds
+#include <future>			// std::future, std::future_status
+#include <limits>			// std::numeric_limits
+#include <memory>			// std::make_unique, std::unique_ptr
+#include <string>			// std::hash<std::string>, std::to_string
+#include <unordered_map>	// std::unordered_map
+#include <unordered_set>	// std::unordered_set
+#include <utility>			// std::move, std::swap
+#include <vector>			// std::vector
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanPipelineCache {
+	public:
+		/* STATIC CONSTANTS */
+		static const std::size_t none;
+		/* END STATIC CONSTANTS */
+
+		VulkanPipelineCache(
+				VulkanDevice& device,
+				VulkanRenderPass& renderPass,
+				const std::vector<char>& initialData = {}
+		);
+		virtual ~VulkanPipelineCache();
+
+		// creation and destruction
+		void create(const std::vector<char>& initialData = {});
+		void destroy() noexcept;
+
+		// update the pipelines after the render pass has been re-created
+		void update();
+
+		// get the ID of a matching pipeline (creates the pipeline if necessary)
+		//  (throws an exception if a matching pipeline could not be created in the background)
+		std::size_t add(
+				const Struct::ShaderFiles& shaderFiles,
+				const Struct::VulkanPipelineState& pipelineState = Struct::VulkanPipelineState(),
+				const Struct::ShaderConstants& shaderConstants = Struct::ShaderConstants()
+		);
+
+		// get the IDs of matching pipelines (creates missing pipelines in parallel and waits for all of them)
+		//  (throws an exception if a matching pipeline could not be created in the background)
+		std::vector<std::size_t> addBatch(
+				const std::vector<Struct::VulkanPipelineRequest>& requests,
+				Helper::ThreadPool& threadPool
+		);
+
+		// get the ID of a matching pipeline (creates the pipeline in the background if necessary)
+		std::size_t addAsync(
+				const Struct::VulkanPipelineRequest& request,
+				Helper::ThreadPool& threadPool
+		);
+
+		// take over all pipelines that have been created in the background in the meantime
+		void poll();
+
+		// wait for all pipelines that are created in the background
+		void wait();
+
+		// set the fallback pipeline to be used while other pipelines are created in the background
+		//  (use VulkanPipelineCache::none to skip draws with pipelines that are not ready yet)
+		void setFallback(std::size_t id);
+
+		// get the ID of the pipeline to be used for a pipeline (returns VulkanPipelineCache::none if none is ready)
+		std::size_t resolve(std::size_t id) const;
+
+		// getters
+		VkPipelineCache& get();
+		const VkPipelineCache& get() const;
+		std::vector<char> getData() const;
+		VulkanPipeline& getPipeline(std::size_t id);
+		const VulkanPipeline& getPipeline(std::size_t id) const;
+		std::size_t getNumberOfPipelines() const;
+		bool isReady(std::size_t id) const;
+		bool isFailed(std::size_t id) const;
+
+		// not copyable, only moveable
+		VulkanPipelineCache(const VulkanPipelineCache&) = delete;
+		VulkanPipelineCache(VulkanPipelineCache&& other) noexcept;
+		VulkanPipelineCache& operator=(const VulkanPipelineCache&) = delete;
+		VulkanPipelineCache& operator=(VulkanPipelineCache&& other) noexcept;
+
+	private:
+		// key identifying a pipeline
+		struct Key {
+			Struct::ShaderFiles shaderFiles;
+			Struct::VulkanPipelineState state;
+			Struct::ShaderConstants constants;
+			std::size_t passHash;
+
+			bool operator==(const Key& other) const {
+				return this->passHash == other.passHash
+						&& this->shaderFiles.vertexShader == other.shaderFiles.vertexShader
+						&& this->shaderFiles.fragmentShader == other.shaderFiles.fragmentShader
+						&& this->state == other.state
+						&& this->constants == other.constants;
+			}
+		};
+
+		struct KeyHash {
+			std::size_t operator()(const Key& key) const {
+				std::size_t result = key.passHash;
+
+				Helper::Hash::combine(result, key.shaderFiles.vertexShader);
+				Helper::Hash::combine(result, key.shaderFiles.fragmentShader);
+				Helper::Hash::combine(result, key.state.hash());
+				Helper::Hash::combine(result, key.constants.hash());
+
+				return result;
+			}
+		};
+
+		// find a pipeline using the same shaders (returns false if none exists)
+		bool findShaders(const Struct::ShaderFiles& shaderFiles, std::size_t& idTo) const;
+
+		// wait for a pipeline that is created in the background (if necessary)
+		void finish(std::size_t id);
+
+		// take over a pipeline that has been created in the background (marks it as failed on error)
+		void take(std::size_t id, std::future<std::unique_ptr<VulkanPipeline>>& future);
+
+		VulkanDevice& parent;
+		VulkanRenderPass& pass;
+		VkPipelineCache instance;
+
+		std::unique_ptr<VulkanPipelineLayoutCache> layoutCache;
+		std::vector<std::unique_ptr<VulkanPipeline>> pipelines;
+		std::vector<Key> keys;
+		std::unordered_map<Key, std::size_t, KeyHash> ids;
+		std::unordered_map<std::size_t, std::future<std::unique_ptr<VulkanPipeline>>> pending;
+		std::unordered_set<std::size_t> failed;
+		std::size_t passHash;
+		std::size_t fallback;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// ID of no pipeline at all
+	inline const std::size_t VulkanPipelineCache::none = std::numeric_limits<std::size_t>::max();
+
+	// constructor: outsourced to create()
+	inline VulkanPipelineCache::VulkanPipelineCache(
+			VulkanDevice& device,
+			VulkanRenderPass& renderPass,
+			const std::vector<char>& initialData
+	)		:	parent(device),
+				pass(renderPass),
+				instance(VK_NULL_HANDLE),
+				layoutCache(std::make_unique<VulkanPipelineLayoutCache>(device)),
+				passHash(renderPass.getCompatibilityHash()),
+				fallback(VulkanPipelineCache::none) {
+		this->create(initialData);
+	}
+
+	// destructor: outsourced to destroy()
+	inline VulkanPipelineCache::~VulkanPipelineCache() {
+		this->destroy();
+	}
+
+	// create the pipeline cache (initialized with the data of an earlier one, if given)
+	inline void VulkanPipelineCache::create(const std::vector<char>& initialData) {
+		VkPipelineCacheCreateInfo vulkanCreateInfo = {};
+
+		vulkanCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		vulkanCreateInfo.initialDataSize = initialData.size();
+		vulkanCreateInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+		VkResult vulkanResult = vkCreatePipelineCache(
+				this->parent.get(),
+				&vulkanCreateInfo,
+				Helper::VulkanAllocator::ptr,
+				&(this->instance)
+		);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not create pipeline cache: " + Wrapper::VulkanError(vulkanResult).str());
+	}
+
+	// destroy all pipelines and the pipeline cache (may not throw an exception as it is used by the destructor, too)
+	inline void VulkanPipelineCache::destroy() noexcept {
+		// wait for pipelines that are still created in the background (ignoring their results)
+		for(auto& entry : this->pending)
+			entry.second.wait();
+
+		this->pending.clear();
+		this->failed.clear();
+
+		this->fallback = VulkanPipelineCache::none;
+
+		this->ids.clear();
+		this->keys.clear();
+		this->pipelines.clear();
+
+		if(this->layoutCache)
+			this->layoutCache->clear();
+
+		if(this->instance) {
+			vkDestroyPipelineCache(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
+
+			this->instance = VK_NULL_HANDLE;
+		}
+	}
+
+	// update the pipelines after the render pass has been re-created
+	//  (the pipelines only need to be re-created if the new render pass is not compatible to the old one)
+	inline void VulkanPipelineCache::update() {
+		const std::size_t newPassHash = this->pass.getCompatibilityHash();
+
+		if(newPassHash == this->passHash)
+			return;
+
+		this->wait();
+
+		this->passHash = newPassHash;
+
+		this->ids.clear();
+
+		for(std::size_t n = 0; n < this->pipelines.size(); ++n) {
+			if(this->pipelines[n]) {
+				this->pipelines[n]->destroy();
+				this->pipelines[n]->create();
+			}
+
+			this->keys[n].passHash = newPassHash;
+
+			this->ids.emplace(this->keys[n], n);
+		}
+	}
+
+	// get the ID of a matching pipeline (creates the pipeline if necessary)
+	inline std::size_t VulkanPipelineCache::add(
+			const Struct::ShaderFiles& shaderFiles,
+			const Struct::VulkanPipelineState& pipelineState,
+			const Struct::ShaderConstants& shaderConstants
+	) {
+		Key key{shaderFiles, pipelineState, shaderConstants, this->passHash};
+
+		const auto it = this->ids.find(key);
+
+		if(it != this->ids.end()) {
+			this->finish(it->second);
+
+			if(this->isFailed(it->second))
+				throw Exception("Pipeline #" + std::to_string(it->second) + " could not be created");
+
+			return it->second;
+		}
+
+		// look for a pipeline with the same shaders to share their (already loaded) code
+		std::unique_ptr<VulkanPipeline> pipeline;
+		std::size_t baseId = 0;
+
+		if(this->findShaders(shaderFiles, baseId))
+			pipeline = std::make_unique<VulkanPipeline>(*(this->pipelines[baseId]), pipelineState, shaderConstants);
+		else
+			pipeline = std::make_unique<VulkanPipeline>(
+					this->parent,
+					this->pass,
+					shaderFiles,
+					pipelineState,
+					shaderConstants,
+					this->instance,
+					this->layoutCache.get()
+			);
+
+		const std::size_t id = this->pipelines.size();
+
+		this->pipelines.emplace_back(std::move(pipeline));
+		this->keys.emplace_back(key);
+		this->ids.emplace(std::move(key), id);
+
+		return id;
+	}
+
+	// get the IDs of matching pipelines (creates missing pipelines in parallel and waits for all of them)
+	//  NOTE:	Pipelines with new shaders are created first, while their variants are created afterwards,
+	//			so that all variants can share the shader code loaded for the first pipeline using the same shaders.
+	inline std::vector<std::size_t> VulkanPipelineCache::addBatch(
+			const std::vector<Struct::VulkanPipelineRequest>& requests,
+			Helper::ThreadPool& threadPool
+	) {
+		std::vector<std::size_t> result(requests.size(), 0);
+		std::vector<Key> newKeys;
+		std::unordered_map<Key, std::size_t, KeyHash> newIds;
+
+		const std::size_t first = this->pipelines.size();
+
+		// find existing and duplicate pipelines
+		for(std::size_t n = 0; n < requests.size(); ++n) {
+			Key key{requests[n].shaderFiles, requests[n].state, requests[n].constants, this->passHash};
+
+			auto it = this->ids.find(key);
+
+			if(it != this->ids.end()) {
+				this->finish(it->second);
+
+				if(this->isFailed(it->second))
+					throw Exception("Pipeline #" + std::to_string(it->second) + " could not be created");
+
+				result[n] = it->second;
+
+				continue;
+			}
+
+			it = newIds.find(key);
+
+			if(it != newIds.end()) {
+				result[n] = it->second;
+
+				continue;
+			}
+
+			result[n] = first + newKeys.size();
+
+			newIds.emplace(key, result[n]);
+			newKeys.emplace_back(std::move(key));
+		}
+
+		if(newKeys.empty())
+			return result;
+
+		// find the base pipelines of the new pipelines (i.e. the pipelines with the same shaders)
+		std::vector<std::size_t> bases(newKeys.size(), 0);
+		std::vector<bool> hasBase(newKeys.size(), false);
+
+		for(std::size_t n = 0; n < newKeys.size(); ++n) {
+			hasBase[n] = this->findShaders(newKeys[n].shaderFiles, bases[n]);
+
+			if(hasBase[n])
+				continue;
+
+			for(std::size_t m = 0; m < n; ++m)
+				if(
+						newKeys[m].shaderFiles.vertexShader == newKeys[n].shaderFiles.vertexShader
+						&& newKeys[m].shaderFiles.fragmentShader == newKeys[n].shaderFiles.fragmentShader
+				) {
+					bases[n] = first + m;
+					hasBase[n] = true;
+
+					break;
+				}
+		}
+
+		// reserve the new pipelines (so that the worker threads will not need to change the vector itself)
+		this->pipelines.resize(first + newKeys.size());
+
+		try {
+			// first, create the pipelines with new shaders in parallel, then their variants
+			for(const bool variants : { false, true }) {
+				std::vector<std::future<void>> futures;
+
+				for(std::size_t n = 0; n < newKeys.size(); ++n) {
+					if(hasBase[n] != variants)
+						continue;
+
+					futures.emplace_back(threadPool.run([this, &newKeys, &bases, first, n, variants]() {
+						if(variants)
+							this->pipelines[first + n] = std::make_unique<VulkanPipeline>(
+									*(this->pipelines[bases[n]]),
+									newKeys[n].state,
+									newKeys[n].constants
+							);
+						else
+							this->pipelines[first + n] = std::make_unique<VulkanPipeline>(
+									this->parent,
+									this->pass,
+									newKeys[n].shaderFiles,
+									newKeys[n].state,
+									newKeys[n].constants,
+									this->instance,
+									this->layoutCache.get()
+							);
+					}));
+				}
+
+				// barrier
+				Helper::ThreadPool::waitForAll(futures);
+			}
+		}
+		catch(...) {
+			this->pipelines.resize(first);
+
+			throw;
+		}
+
+		// add the keys of the new pipelines
+		for(auto& key : newKeys)
+			this->keys.emplace_back(std::move(key));
+
+		this->ids.merge(newIds);
+
+		return result;
+	}
+
+	// get the ID of a matching pipeline (creates the pipeline in the background if necessary)
+	inline std::size_t VulkanPipelineCache::addAsync(
+			const Struct::VulkanPipelineRequest& request,
+			Helper::ThreadPool& threadPool
+	) {
+		Key key{request.shaderFiles, request.state, request.constants, this->passHash};
+
+		const auto it = this->ids.find(key);
+
+		if(it != this->ids.end())
+			return it->second;
+
+		// look for a pipeline with the same shaders to share their (already loaded) code
+		const VulkanPipeline * base = nullptr;
+		std::size_t baseId = 0;
+
+		if(this->findShaders(request.shaderFiles, baseId))
+			base = this->pipelines[baseId].get();
+
+		// queue the creation of the pipeline
+		const std::size_t id = this->pipelines.size();
+
+		this->pending.emplace(id, threadPool.run([this, base, request]() {
+			if(base)
+				return std::make_unique<VulkanPipeline>(*base, request.state, request.constants);
+
+			return std::make_unique<VulkanPipeline>(
+					this->parent,
+					this->pass,
+					request.shaderFiles,
+					request.state,
+					request.constants,
+					this->instance,
+					this->layoutCache.get()
+			);
+		}));
+
+		// reserve the pipeline
+		this->pipelines.emplace_back(nullptr);
+		this->keys.emplace_back(key);
+		this->ids.emplace(std::move(key), id);
+
+		return id;
+	}
+
+	// take over all pipelines that have been created in the background in the meantime (does not block)
+	inline void VulkanPipelineCache::poll() {
+		for(auto it = this->pending.begin(); it != this->pending.end(); ) {
+			if(it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+				++it;
+
+				continue;
+			}
+
+			const std::size_t id = it->first;
+			auto future = std::move(it->second);
+
+			it = this->pending.erase(it);
+
+			this->take(id, future);
+		}
+	}
+
+	// wait for all pipelines that are created in the background
+	inline void VulkanPipelineCache::wait() {
+		while(!(this->pending.empty()))
+			this->finish(this->pending.begin()->first);
+	}
+
+	// set the fallback pipeline to be used while other pipelines are created in the background
+	inline void VulkanPipelineCache::setFallback(std::size_t id) {
+		this->fallback = id;
+	}
+
+	// get the ID of the pipeline to be used for a pipeline (returns VulkanPipelineCache::none if none is ready)
+	inline std::size_t VulkanPipelineCache::resolve(std::size_t id) const {
+		if(this->isReady(id))
+			return id;
+
+		if(this->isReady(this->fallback))
+			return this->fallback;
+
+		return VulkanPipelineCache::none;
+	}
+
+	// find a pipeline using the same shaders (returns false if none exists)
+	inline bool VulkanPipelineCache::findShaders(const Struct::ShaderFiles& shaderFiles, std::size_t& idTo) const {
+		for(std::size_t n = 0; n < this->keys.size(); ++n)
+			if(
+					this->pipelines[n]
+					&& this->keys[n].shaderFiles.vertexShader == shaderFiles.vertexShader
+					&& this->keys[n].shaderFiles.fragmentShader == shaderFiles.fragmentShader
+			) {
+				idTo = n;
+
+				return true;
+			}
+
+		return false;
+	}
+
+	// wait for a pipeline that is created in the background (if necessary)
+	inline void VulkanPipelineCache::finish(std::size_t id) {
+		const auto it = this->pending.find(id);
+
+		if(it == this->pending.end())
+			return;
+
+		auto future = std::move(it->second);
+
+		this->pending.erase(it);
+
+		this->take(id, future);
+	}
+
+	// take over a pipeline that has been created in the background (marks it as failed on error)
+	inline void VulkanPipelineCache::take(std::size_t id, std::future<std::unique_ptr<VulkanPipeline>>& future) {
+		try {
+			this->pipelines[id] = future.get();
+		}
+		catch(const std::exception& exception) {
+			Helper::Log::error()	<< "(ERROR: could not create pipeline #"
+									<< id
+									<< " in the background: "
+									<< exception.what()
+									<< ")";
+
+			this->failed.insert(id);
+		}
+	}
+
+	// get reference to the instance of the pipeline cache
+	inline VkPipelineCache& VulkanPipelineCache::get() {
+		return this->instance;
+	}
+
+	// get const reference to the instance of the pipeline cache
+	inline const VkPipelineCache& VulkanPipelineCache::get() const {
+		return this->instance;
+	}
+
+	// get the data of the pipeline cache (e.g. for initializing the pipeline cache on the next run)
+	inline std::vector<char> VulkanPipelineCache::getData() const {
+		std::size_t vulkanSize = 0;
+
+		VkResult vulkanResult = vkGetPipelineCacheData(this->parent.get(), this->instance, &vulkanSize, nullptr);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not get size of pipeline cache data: " + Wrapper::VulkanError(vulkanResult).str());
+
+		std::vector<char> result(vulkanSize);
+
+		vulkanResult = vkGetPipelineCacheData(this->parent.get(), this->instance, &vulkanSize, result.data());
+
+		if(vulkanResult != VK_SUCCESS && vulkanResult != VK_INCOMPLETE)
+			throw Exception("Could not get pipeline cache data: " + Wrapper::VulkanError(vulkanResult).str());
+
+		result.resize(vulkanSize);
+
+		return result;
+	}
+
+	// get reference to an ID-specified pipeline
+	inline VulkanPipeline& VulkanPipelineCache::getPipeline(std::size_t id) {
+		if(!(this->isReady(id)))
+			throw Exception("Pipeline #" + std::to_string(id) + " is not ready");
+
+		return *(this->pipelines[id]);
+	}
+
+	// get const reference to an ID-specified pipeline
+	inline const VulkanPipeline& VulkanPipelineCache::getPipeline(std::size_t id) const {
+		if(!(this->isReady(id)))
+			throw Exception("Pipeline #" + std::to_string(id) + " is not ready");
+
+		return *(this->pipelines[id]);
+	}
+
+	// get number of pipelines
+	inline std::size_t VulkanPipelineCache::getNumberOfPipelines() const {
+		return this->pipelines.size();
+	}
+
+	// check whether an ID-specified pipeline exists and is ready to be used
+	inline bool VulkanPipelineCache::isReady(std::size_t id) const {
+		return id < this->pipelines.size() && this->pipelines[id];
+	}
+
+	// check whether the creation of an ID-specified pipeline in the background has failed
+	inline bool VulkanPipelineCache::isFailed(std::size_t id) const {
+		return this->failed.count(id) > 0;
+	}
+
+	// move constructor
+	inline VulkanPipelineCache::VulkanPipelineCache(VulkanPipelineCache&& other) noexcept
+			:	parent(other.parent),
+				pass(other.pass),
+				instance(other.instance),
+				layoutCache(std::move(other.layoutCache)),
+				pipelines(std::move(other.pipelines)),
+				keys(std::move(other.keys)),
+				ids(std::move(other.ids)),
+				pending(std::move(other.pending)),
+				failed(std::move(other.failed)),
+				passHash(other.passHash),
+				fallback(other.fallback) {
+		other.instance = VK_NULL_HANDLE;
+	}
+
+	// move assignment
+	inline VulkanPipelineCache& VulkanPipelineCache::operator=(VulkanPipelineCache&& other) noexcept {
+		this->instance = other.instance;
+
+		other.instance = VK_NULL_HANDLE;
+
+		using std::swap;
+
+		swap(this->parent, other.parent);
+		swap(this->pass, other.pass);
+		swap(this->layoutCache, other.layoutCache);
+		swap(this->pipelines, other.pipelines);
+		swap(this->keys, other.keys);
+		swap(this->ids, other.ids);
+		swap(this->pending, other.pending);
+		swap(this->failed, other.failed);
+		swap(this->passHash, other.passHash);
+		swap(this->fallback, other.fallback);
+
+		return *this;
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANPIPELINECACHE_HPP_ */
@@ -0,0 +1,236 @@
+/*
+ * VulkanPipelineLayout.hpp
+ *
+ * Wraps a pipeline layout used by the Vulkan API, including the layouts of its descriptor sets.
+ *
+ * The description of a pipeline layout can be generated from the reflected resources of its shaders.
+ *  Uniform buffers are always bound with dynamic offsets, because they are sub-allocated from uniform ring buffers.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANPIPELINELAYOUT_HPP_
+#define SRC_WRAPPER_VULKANPIPELINELAYOUT_HPP_
+
+#include "VulkanDescriptorSetLayout.hpp"
+#include "VulkanDevice.hpp"
+#include "VulkanError.hpp"
+
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Main/Exception.hpp"
+#include "../Struct/ShaderReflection.hpp"
+#include "../Struct/VulkanPipelineLayoutInfo.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <algorithm>	// std::max, std::min
+#include <cstdint>		// std::uint32_t
+#include <map>			// std::map
+#include <string>		// std::to_string
+#include <utility>		// std::move, std::swap
+#include <vector>		// std::vector
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanPipelineLayout {
+	public:
+		VulkanPipelineLayout(VulkanDevice& device, const Struct::VulkanPipelineLayoutInfo& layoutInfo);
+		virtual ~VulkanPipelineLayout();
+
+		// getters
+		VkPipelineLayout& get();
+		const VkPipelineLayout& get() const;
+		const Struct::VulkanPipelineLayoutInfo& getInfo() const;
+		VkDescriptorSetLayout getSetLayout(std::uint32_t set) const;
+
+		// generate the description of a pipeline layout from the reflected resources of its shaders
+		static Struct::VulkanPipelineLayoutInfo describe(const std::vector<const Struct::ShaderReflection *>& shaders);
+
+		// not copyable, only moveable
+		VulkanPipelineLayout(const VulkanPipelineLayout&) = delete;
+		VulkanPipelineLayout(VulkanPipelineLayout&& other) noexcept;
+		VulkanPipelineLayout& operator=(const VulkanPipelineLayout&) = delete;
+		VulkanPipelineLayout& operator=(VulkanPipelineLayout&& other) noexcept;
+
+	private:
+		VulkanDevice& parent;
+		VkPipelineLayout instance;
+
+		std::vector<VulkanDescriptorSetLayout> setLayouts;
+		Struct::VulkanPipelineLayoutInfo info;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the descriptor set layouts and the pipeline layout
+	inline VulkanPipelineLayout::VulkanPipelineLayout(
+			VulkanDevice& device,
+			const Struct::VulkanPipelineLayoutInfo& layoutInfo
+	) : parent(device), instance(VK_NULL_HANDLE), info(layoutInfo) {
+		std::vector<VkDescriptorSetLayout> vulkanSetLayouts;
+
+		this->setLayouts.reserve(this->info.sets.size());
+
+		vulkanSetLayouts.reserve(this->info.sets.size());
+
+		for(const auto& set : this->info.sets) {
+			this->setLayouts.emplace_back(this->parent, set);
+
+			vulkanSetLayouts.push_back(this->setLayouts.back().get());
+		}
+
+		VkPipelineLayoutCreateInfo vulkanCreateInfo = {};
+
+		vulkanCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		vulkanCreateInfo.setLayoutCount = static_cast<unsigned int>(vulkanSetLayouts.size());
+		vulkanCreateInfo.pSetLayouts = vulkanSetLayouts.data();
+		vulkanCreateInfo.pushConstantRangeCount = static_cast<unsigned int>(this->info.pushConstantRanges.size());
+		vulkanCreateInfo.pPushConstantRanges = this->info.pushConstantRanges.data();
+
+		VkResult vulkanResult = vkCreatePipelineLayout(
+				this->parent.get(),
+				&vulkanCreateInfo,
+				Helper::VulkanAllocator::ptr,
+				&(this->instance)
+		);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not create pipeline layout: " + Wrapper::VulkanError(vulkanResult).str());
+	}
+
+	// destructor: destroy the pipeline layout (the descriptor set layouts will be destroyed afterwards)
+	inline VulkanPipelineLayout::~VulkanPipelineLayout() {
+		if(this->instance)
+			vkDestroyPipelineLayout(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
+	}
+
+	// get reference to the instance of the pipeline layout
+	inline VkPipelineLayout& VulkanPipelineLayout::get() {
+		return this->instance;
+	}
+
+	// get const reference to the instance of the pipeline layout
+	inline const VkPipelineLayout& VulkanPipelineLayout::get() const {
+		return this->instance;
+	}
+
+	// get const reference to the description of the pipeline layout
+	inline const Struct::VulkanPipelineLayoutInfo& VulkanPipelineLayout::getInfo() const {
+		return this->info;
+	}
+
+	// get the layout of a descriptor set
+	inline VkDescriptorSetLayout VulkanPipelineLayout::getSetLayout(std::uint32_t set) const {
+		if(set >= this->setLayouts.size())
+			throw Exception("Pipeline layout has no descriptor set #" + std::to_string(set));
+
+		return this->setLayouts[set].get();
+	}
+
+	// generate the description of a pipeline layout from the reflected resources of its shaders
+	//  NOTE:	Bindings used by multiple shaders will be visible to all of them,
+	//			while all push constants will be merged into one range visible to all stages using them.
+	//			Uniform buffers will be turned into dynamic uniform buffers.
+	inline Struct::VulkanPipelineLayoutInfo VulkanPipelineLayout::describe(
+			const std::vector<const Struct::ShaderReflection *>& shaders
+	) {
+		Struct::VulkanPipelineLayoutInfo result;
+		std::map<std::uint32_t, std::map<std::uint32_t, VkDescriptorSetLayoutBinding>> bindings;
+		VkPushConstantRange vulkanPushConstantRange = {};
+
+		for(const auto * shader : shaders) {
+			for(const auto& descriptor : shader->descriptorBindings) {
+				auto& set = bindings[descriptor.set];
+				auto it = set.find(descriptor.binding);
+
+				const VkDescriptorType vulkanType =
+						descriptor.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ?
+						VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC
+						: descriptor.type;
+
+				if(it == set.end()) {
+					VkDescriptorSetLayoutBinding vulkanBinding = {};
+
+					vulkanBinding.binding = descriptor.binding;
+					vulkanBinding.descriptorType = vulkanType;
+					vulkanBinding.descriptorCount = descriptor.count;
+					vulkanBinding.stageFlags = shader->stage;
+					vulkanBinding.pImmutableSamplers = nullptr;
+
+					set.emplace(descriptor.binding, vulkanBinding);
+				}
+				else if(it->second.descriptorType != vulkanType || it->second.descriptorCount != descriptor.count)
+					throw Exception(
+							"Shaders do not agree on descriptor set #"
+							+ std::to_string(descriptor.set)
+							+ ", binding #"
+							+ std::to_string(descriptor.binding)
+					);
+				else
+					it->second.stageFlags |= shader->stage;
+			}
+
+			for(const auto& range : shader->pushConstantRanges) {
+				if(vulkanPushConstantRange.stageFlags) {
+					const std::uint32_t end = std::max(
+							vulkanPushConstantRange.offset + vulkanPushConstantRange.size,
+							range.offset + range.size
+					);
+
+					vulkanPushConstantRange.offset = std::min(vulkanPushConstantRange.offset, range.offset);
+					vulkanPushConstantRange.size = end - vulkanPushConstantRange.offset;
+					vulkanPushConstantRange.stageFlags |= range.stageFlags;
+				}
+				else
+					vulkanPushConstantRange = range;
+			}
+		}
+
+		// sets without bindings still need (empty) layouts, if a set with a higher number is used
+		if(!bindings.empty())
+			result.sets.resize(bindings.rbegin()->first + 1);
+
+		for(const auto& set : bindings)
+			for(const auto& binding : set.second)
+				result.sets[set.first].push_back(binding.second);
+
+		if(vulkanPushConstantRange.stageFlags)
+			result.pushConstantRanges.push_back(vulkanPushConstantRange);
+
+		return result;
+	}
+
+	// move constructor
+	inline VulkanPipelineLayout::VulkanPipelineLayout(VulkanPipelineLayout&& other) noexcept
+			:	parent(other.parent),
+				instance(other.instance),
+				setLayouts(std::move(other.setLayouts)),
+				info(std::move(other.info)) {
+		other.instance = VK_NULL_HANDLE;
+	}
+
+	// move assignment
+	inline VulkanPipelineLayout& VulkanPipelineLayout::operator=(VulkanPipelineLayout&& other) noexcept {
+		this->instance = other.instance;
+
+		other.instance = VK_NULL_HANDLE;
+
+		using std::swap;
+
+		swap(this->parent, other.parent);
+		swap(this->setLayouts, other.setLayouts);
+		swap(this->info, other.info);
+
+		return *this;
+	}
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANPIPELINELAYOUT_HPP_ */
@@ -0,0 +1,110 @@
+/*
+ * VulkanPipelineLayoutCache.hpp
+ *
+ * Keeps the pipeline layouts used by the Vulkan API, identified by the hash of their description,
+ *  so that pipelines with the same resources share one pipeline layout (and its descriptor set layouts).
+ *
+ * Adding layouts is synchronized, so that pipelines can be created in parallel.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANPIPELINELAYOUTCACHE_HPP_
+#define SRC_WRAPPER_VULKANPIPELINELAYOUTCACHE_HPP_
+
+#include "VulkanDevice.hpp"
+#include "VulkanPipelineLayout.hpp"
+
+#include "../Main/Exception.hpp"
+#include "../Struct/VulkanPipelineLayoutInfo.hpp"
+
+#include <cstddef>			// std::size_t
+#include <memory>			// std::make_shared, std::shared_ptr
+#include <mutex>			// std::lock_guard, std::mutex
+#include <unordered_map>	// std::unordered_map
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanPipelineLayoutCache {
+	public:
+		explicit VulkanPipelineLayoutCache(VulkanDevice& device);
+
+		// get a matching pipeline layout (creates the pipeline layout if necessary)
+		std::shared_ptr<VulkanPipelineLayout> add(const Struct::VulkanPipelineLayoutInfo& layoutInfo);
+
+		// remove all pipeline layouts (layouts still used by pipelines will be destroyed with them)
+		void clear();
+
+		// getters
+		std::size_t getNumberOfLayouts() const;
+
+		// not copyable, not moveable
+		VulkanPipelineLayoutCache(const VulkanPipelineLayoutCache&) = delete;
+		VulkanPipelineLayoutCache(VulkanPipelineLayoutCache&&) = delete;
+		VulkanPipelineLayoutCache& operator=(const VulkanPipelineLayoutCache&) = delete;
+		VulkanPipelineLayoutCache& operator=(VulkanPipelineLayoutCache&&) = delete;
+
+	private:
+		struct InfoHash {
+			std::size_t operator()(const Struct::VulkanPipelineLayoutInfo& layoutInfo) const {
+				return layoutInfo.hash();
+			}
+		};
+
+		VulkanDevice& parent;
+
+		std::unordered_map<Struct::VulkanPipelineLayoutInfo, std::shared_ptr<VulkanPipelineLayout>, InfoHash> layouts;
+		mutable std::mutex layoutsLock;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: set the device
+	inline VulkanPipelineLayoutCache::VulkanPipelineLayoutCache(VulkanDevice& device) : parent(device) {}
+
+	// get a matching pipeline layout (creates the pipeline layout if necessary)
+	inline std::shared_ptr<VulkanPipelineLayout> VulkanPipelineLayoutCache::add(
+			const Struct::VulkanPipelineLayoutInfo& layoutInfo
+	) {
+		std::lock_guard<std::mutex> lock(this->layoutsLock);
+
+		auto& layout = this->layouts[layoutInfo];
+
+		if(!layout)
+			try {
+				layout = std::make_shared<VulkanPipelineLayout>(this->parent, layoutInfo);
+			}
+			catch(...) {
+				this->layouts.erase(layoutInfo);
+
+				throw;
+			}
+
+		return layout;
+	}
+
+	// remove all pipeline layouts (layouts still used by pipelines will be destroyed with them)
+	inline void VulkanPipelineLayoutCache::clear() {
+		std::lock_guard<std::mutex> lock(this->layoutsLock);
+
+		this->layouts.clear();
+	}
+
+	// get the number of pipeline layouts
+	inline std::size_t VulkanPipelineLayoutCache::getNumberOfLayouts() const {
+		std::lock_guard<std::mutex> lock(this->layoutsLock);
+
+		return this->layouts.size();
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANPIPELINELAYOUTCACHE_HPP_ */
@@ -0,0 +1,182 @@
+/*
+ * VulkanQueryPool.hpp
+ *
+ * Wraps a pool of timestamp queries used by the Vulkan API.
+ *
+ * The queries need to be reset (in a command buffer) before they are written again.
+ *  Their results are converted into nanoseconds using the timestamp period of the device.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANQUERYPOOL_HPP_
+#define SRC_WRAPPER_VULKANQUERYPOOL_HPP_
+
+#include "VulkanDevice.hpp"
+#include "VulkanError.hpp"
+#include "VulkanPhysicalDevice.hpp"
+
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Main/Exception.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>	// std::uint32_t, std::uint64_t
+#include <string>	// std::to_string
+#include <utility>	// std::swap
+#include <vector>	// std::vector
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanQueryPool {
+	public:
+		VulkanQueryPool(
+				VulkanDevice& device,
+				VulkanPhysicalDevice& physicalDevice,
+				std::uint32_t numberOfQueries
+		);
+		virtual ~VulkanQueryPool();
+
+		// record commands into a command buffer
+		void reset(VkCommandBuffer commandBuffer);
+		void write(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits stage, std::uint32_t query);
+
+		// get the timestamps of a range of queries in nanoseconds (returns false if they are not all available)
+		bool getResults(std::uint32_t first, std::uint32_t number, std::vector<double>& resultsTo) const;
+
+		// getters
+		VkQueryPool& get();
+		const VkQueryPool& get() const;
+
+		// not copyable, only moveable
+		VulkanQueryPool(const VulkanQueryPool&) = delete;
+		VulkanQueryPool(VulkanQueryPool&& other) noexcept;
+		VulkanQueryPool& operator=(const VulkanQueryPool&) = delete;
+		VulkanQueryPool& operator=(VulkanQueryPool&& other) noexcept;
+
+	private:
+		VulkanDevice& parent;
+		VkQueryPool instance;
+		std::uint32_t count;
+		double period;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the query pool
+	inline VulkanQueryPool::VulkanQueryPool(
+			VulkanDevice& device,
+			VulkanPhysicalDevice& physicalDevice,
+			std::uint32_t numberOfQueries
+	) :		parent(device),
+			instance(VK_NULL_HANDLE),
+			count(numberOfQueries),
+			period(physicalDevice.getProperties().limits.timestampPeriod) {
+		VkQueryPoolCreateInfo vulkanCreateInfo = {};
+
+		vulkanCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		vulkanCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		vulkanCreateInfo.queryCount = this->count;
+
+		VkResult vulkanResult = vkCreateQueryPool(
+				this->parent.get(),
+				&vulkanCreateInfo,
+				Helper::VulkanAllocator::ptr,
+				&(this->instance)
+		);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not create query pool: " + Wrapper::VulkanError(vulkanResult).str());
+	}
+
+	// destructor: destroy the query pool
+	inline VulkanQueryPool::~VulkanQueryPool() {
+		if(this->instance)
+			vkDestroyQueryPool(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
+	}
+
+	// record the reset of all queries into a command buffer
+	inline void VulkanQueryPool::reset(VkCommandBuffer commandBuffer) {
+		vkCmdResetQueryPool(commandBuffer, this->instance, 0, this->count);
+	}
+
+	// record writing a timestamp (after all previous commands have reached the specified stage) into a command buffer
+	inline void VulkanQueryPool::write(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits stage, std::uint32_t query) {
+		vkCmdWriteTimestamp(commandBuffer, stage, this->instance, query);
+	}
+
+	// get the timestamps of a range of queries in nanoseconds (returns false if they are not all available)
+	inline bool VulkanQueryPool::getResults(std::uint32_t first, std::uint32_t number, std::vector<double>& resultsTo) const {
+		if(first + number > this->count)
+			throw Exception("Query pool has no queries #" + std::to_string(first) + "-#" + std::to_string(first + number - 1));
+
+		std::vector<std::uint64_t> vulkanResults(number);
+
+		VkResult vulkanResult = vkGetQueryPoolResults(
+				this->parent.get(),
+				this->instance,
+				first,
+				number,
+				vulkanResults.size() * sizeof(std::uint64_t),
+				vulkanResults.data(),
+				sizeof(std::uint64_t),
+				VK_QUERY_RESULT_64_BIT
+		);
+
+		if(vulkanResult == VK_NOT_READY)
+			return false;
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not get results of query pool: " + Wrapper::VulkanError(vulkanResult).str());
+
+		resultsTo.clear();
+		resultsTo.reserve(number);
+
+		for(const auto vulkanTimestamp : vulkanResults)
+			resultsTo.push_back(static_cast<double>(vulkanTimestamp) * this->period);
+
+		return true;
+	}
+
+	// get reference to the instance of the query pool
+	inline VkQueryPool& VulkanQueryPool::get() {
+		return this->instance;
+	}
+
+	// get const reference to the instance of the query pool
+	inline const VkQueryPool& VulkanQueryPool::get() const {
+		return this->instance;
+	}
+
+	// move constructor
+	inline VulkanQueryPool::VulkanQueryPool(VulkanQueryPool&& other) noexcept
+			:	parent(other.parent),
+				instance(other.instance),
+				count(other.count),
+				period(other.period) {
+		other.instance = VK_NULL_HANDLE;
+	}
+
+	// move assignment
+	inline VulkanQueryPool& VulkanQueryPool::operator=(VulkanQueryPool&& other) noexcept {
+		using std::swap;
+
+		swap(this->parent, other.parent);
+		swap(this->instance, other.instance);
+		swap(this->count, other.count);
+		swap(this->period, other.period);
+
+		return *this;
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANQUERYPOOL_HPP_ */
@@ -0,0 +1,123 @@
+/*
+ * VulkanQueue.hpp
+ *
+ * Wraps a queue of a logical device used by the Vulkan API.
+ *
+ * Submissions and presentations are synchronized, because the same queue might be used by multiple threads
+ *  (e.g. when the device has no dedicated queue family for compute work or transfers).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANQUEUE_HPP_
+#define SRC_WRAPPER_VULKANQUEUE_HPP_
+
+#include "VulkanError.hpp"
+
+#include "../Main/Exception.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <mutex>	// std::lock_guard, std::mutex
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanQueue {
+	public:
+		VulkanQueue(VkQueue queue, unsigned int familyIndex);
+		virtual ~VulkanQueue();
+
+		// submit work to the queue
+		void submit(const VkSubmitInfo& submitInfo, VkFence fence = VK_NULL_HANDLE);
+		void submit(unsigned int submitCount, const VkSubmitInfo * submitInfos, VkFence fence = VK_NULL_HANDLE);
+
+		// present swap chain images (returns the result, because an out-of-date swap chain needs to be handled)
+		VkResult present(const VkPresentInfoKHR& presentInfo);
+
+		// wait for the queue to become idle
+		void waitIdle();
+
+		// getters
+		VkQueue& get();
+		const VkQueue& get() const;
+		unsigned int getFamily() const;
+
+		// not copyable, not moveable
+		VulkanQueue(const VulkanQueue&) = delete;
+		VulkanQueue(VulkanQueue&&) = delete;
+		VulkanQueue& operator=(const VulkanQueue&) = delete;
+		VulkanQueue& operator=(VulkanQueue&&) = delete;
+
+	private:
+		VkQueue instance;
+		unsigned int family;
+		std::mutex queueLock;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: set queue (queues are owned by the logical device)
+	inline VulkanQueue::VulkanQueue(VkQueue queue, unsigned int familyIndex) : instance(queue), family(familyIndex) {}
+
+	// destructor stub
+	inline VulkanQueue::~VulkanQueue() {}
+
+	// submit work to the queue
+	inline void VulkanQueue::submit(const VkSubmitInfo& submitInfo, VkFence fence) {
+		this->submit(1, &submitInfo, fence);
+	}
+
+	// submit work to the queue (multiple batches)
+	inline void VulkanQueue::submit(unsigned int submitCount, const VkSubmitInfo * submitInfos, VkFence fence) {
+		VkResult vulkanResult = VK_SUCCESS;
+
+		{
+			std::lock_guard<std::mutex> lock(this->queueLock);
+
+			vulkanResult = vkQueueSubmit(this->instance, submitCount, submitInfos, fence);
+		}
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not submit to queue: " + Wrapper::VulkanError(vulkanResult).str());
+	}
+
+	// present swap chain images
+	inline VkResult VulkanQueue::present(const VkPresentInfoKHR& presentInfo) {
+		std::lock_guard<std::mutex> lock(this->queueLock);
+
+		return vkQueuePresentKHR(this->instance, &presentInfo);
+	}
+
+	// wait for the queue to become idle
+	inline void VulkanQueue::waitIdle() {
+		std::lock_guard<std::mutex> lock(this->queueLock);
+
+		vkQueueWaitIdle(this->instance);
+	}
+
+	// get reference to the instance of the queue
+	inline VkQueue& VulkanQueue::get() {
+		return this->instance;
+	}
+
+	// get const reference to the instance of the queue
+	inline const VkQueue& VulkanQueue::get() const {
+		return this->instance;
+	}
+
+	// get the index of the queue family
+	inline unsigned int VulkanQueue::getFamily() const {
+		return this->family;
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANQUEUE_HPP_ */
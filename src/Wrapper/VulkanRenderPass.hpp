@@ -3,6 +3,23 @@
  *
  * Wraps a render pass used by the Vulkan API.
  *
+ * If supported by the device, dynamic rendering (core in Vulkan 1.3) can be used instead of a render pass object.
+ *  The image layout transitions otherwise performed by the render pass will then be recorded explicitly,
+ *  while no frame buffers are needed (i.e. they do not need to be re-created when the swap chain changes).
+ *
+ * The optional depth attachment is cleared at the beginning and not stored afterwards,
+ *  so that its memory can be allocated lazily (or not at all) on tile-based GPUs.
+ *
+ * When multisampling is used, the same applies to the multisampled color attachment,
+ *  which is resolved into the target image at the end of the (sub)pass.
+ *
+ * With a post-processing subpass, the scene is rendered into an intermediate image instead,
+ *  which is read by the second subpass as input attachment and never stored, so that both subpasses
+ *  stay on-chip on tile-based GPUs. This needs a render pass object, i.e. it takes precedence over dynamic rendering.
+ *
+ * The target image is left in the specified layout. If that is the attachment layout, it is expected
+ *  to be in that layout already when beginning rendering (e.g. because it is transitioned by a render graph).
+ *
  *  Created on: Sep 13, 2019
  *      Author: ans
  */
@@ -13,12 +30,16 @@
 #include "VulkanDevice.hpp"
 #include "VulkanError.hpp"
 
+#include "../Helper/Hash.hpp"
 #include "../Helper/VulkanAllocator.hpp"
 #include "../Main/Exception.hpp"
+#include "../Struct/VulkanRenderTarget.hpp"
 
 #include <vulkan/vulkan_core.h>
 
+#include <cstddef>	// std::size_t
 #include <utility>	// std::swap
+#include <vector>	// std::vector
 
 namespace spacelite::Wrapper {
 
@@ -27,16 +48,40 @@ namespace spacelite::Wrapper {
 	 */
 	class VulkanRenderPass {
 	public:
-		VulkanRenderPass(VulkanDevice& device, VkFormat& targetFormat);
+		VulkanRenderPass(
+				VulkanDevice& device,
+				VkFormat& targetFormat,
+				VkFormat depthBufferFormat = VK_FORMAT_UNDEFINED,
+				VkSampleCountFlagBits sampleCount = VK_SAMPLE_COUNT_1_BIT,
+				bool preferDynamicRendering = false,
+				bool postProcessingSubpass = false,
+				VkImageLayout targetImageLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+		);
 		virtual ~VulkanRenderPass();
 
 		// creation and destruction
 		void create();
 		void destroy() noexcept;
 
+		// begin and end rendering into a target
+		void begin(VkCommandBuffer commandBuffer, const Struct::VulkanRenderTarget& target, const VkClearValue& clearValue);
+		void end(VkCommandBuffer commandBuffer, const Struct::VulkanRenderTarget& target);
+
+		// continue with the post-processing subpass (if the render pass has one)
+		void next(VkCommandBuffer commandBuffer);
+
 		// getters
 		VkRenderPass& get();
 		const VkRenderPass& get() const;
+		const VkFormat& getFormat() const;
+		const VkFormat& getDepthFormat() const;
+		bool hasDepth() const;
+		VkSampleCountFlagBits getSamples() const;
+		bool isMultisampled() const;
+		bool isDynamic() const;
+		bool hasPostProcessingSubpass() const;
+		VkImageLayout getTargetLayout() const;
+		std::size_t getCompatibilityHash() const;
 
 		// not copyable, only moveable
 		VulkanRenderPass(const VulkanRenderPass&) = delete;
@@ -48,6 +93,30 @@ namespace spacelite::Wrapper {
 		VulkanDevice& parent;
 		VkRenderPass instance;
 		VkFormat& format;
+		VkFormat depthFormat;
+		VkSampleCountFlagBits samples;
+		bool dynamic;
+		bool postSubpass;
+		VkImageLayout targetLayout;
+
+#ifdef VK_KHR_dynamic_rendering
+		PFN_vkCmdBeginRenderingKHR beginRendering;
+		PFN_vkCmdEndRenderingKHR endRendering;
+#endif
+
+		// static private helper functions
+		static VkImageAspectFlags getDepthAspect(VkFormat format);
+		static void transition(
+				VkCommandBuffer commandBuffer,
+				VkImage image,
+				VkImageAspectFlags aspect,
+				VkImageLayout oldLayout,
+				VkImageLayout newLayout,
+				VkPipelineStageFlags srcStage,
+				VkAccessFlags srcAccess,
+				VkPipelineStageFlags dstStage,
+				VkAccessFlags dstAccess
+		);
 
 		MAIN_EXCEPTION_CLASS();
 	};
@@ -56,9 +125,57 @@ namespace spacelite::Wrapper {
 	 * IMPLEMENTATION
 	 */
 
-	// constructor: outsourced to create()
-	inline VulkanRenderPass::VulkanRenderPass(VulkanDevice& device, VkFormat& targetFormat)
-			: parent(device), instance(VK_NULL_HANDLE), format(targetFormat) {
+	// constructor: check for dynamic rendering, creation outsourced to create()
+	inline VulkanRenderPass::VulkanRenderPass(
+			VulkanDevice& device,
+			VkFormat& targetFormat,
+			VkFormat depthBufferFormat,
+			VkSampleCountFlagBits sampleCount,
+			bool preferDynamicRendering,
+			bool postProcessingSubpass,
+			VkImageLayout targetImageLayout
+	)
+			:	parent(device),
+				instance(VK_NULL_HANDLE),
+				format(targetFormat),
+				depthFormat(depthBufferFormat),
+				samples(sampleCount),
+				dynamic(preferDynamicRendering && !postProcessingSubpass && device.getCapabilities().dynamicRendering),
+				postSubpass(postProcessingSubpass),
+				targetLayout(targetImageLayout)
+#ifdef VK_KHR_dynamic_rendering
+				,
+				beginRendering(nullptr),
+				endRendering(nullptr)
+#endif
+	{
+#ifdef VK_KHR_dynamic_rendering
+		if(this->dynamic) {
+			// get the functions for dynamic rendering (either from the core API or from the extension)
+			this->beginRendering = reinterpret_cast<PFN_vkCmdBeginRenderingKHR>(
+					vkGetDeviceProcAddr(this->parent.get(), "vkCmdBeginRendering")
+			);
+			this->endRendering = reinterpret_cast<PFN_vkCmdEndRenderingKHR>(
+					vkGetDeviceProcAddr(this->parent.get(), "vkCmdEndRendering")
+			);
+
+			if(!(this->beginRendering) || !(this->endRendering)) {
+				this->beginRendering = reinterpret_cast<PFN_vkCmdBeginRenderingKHR>(
+						vkGetDeviceProcAddr(this->parent.get(), "vkCmdBeginRenderingKHR")
+				);
+				this->endRendering = reinterpret_cast<PFN_vkCmdEndRenderingKHR>(
+						vkGetDeviceProcAddr(this->parent.get(), "vkCmdEndRenderingKHR")
+				);
+			}
+
+			// fall back to the render pass object if the functions are not available
+			if(!(this->beginRendering) || !(this->endRendering))
+				this->dynamic = false;
+		}
+#else
+		this->dynamic = false;
+#endif
+
 		this->create();
 	}
 
@@ -67,31 +184,120 @@ namespace spacelite::Wrapper {
 		this->destroy();
 	}
 
-	// create the render pass
+	// create the render pass (not needed for dynamic rendering)
 	inline void VulkanRenderPass::create() {
+		if(this->dynamic)
+			return;
+
+		// attachments: color (multisampled, if needed), depth (if needed), resolve target (if multisampled)
+		//  and target of the post-processing subpass (if any)
+		std::vector<VkAttachmentDescription> vulkanAttachments;
+
+		// the (resolved) scene is either stored in the target image or only kept for the post-processing subpass
+		const VkAttachmentStoreOp vulkanSceneStoreOp =
+				this->postSubpass ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
+		const VkImageLayout vulkanSceneLayout =
+				this->postSubpass ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : this->targetLayout;
+
 		VkAttachmentDescription vulkanColorAttachment = {};
 
 		vulkanColorAttachment.format = this->format;
-		vulkanColorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+		vulkanColorAttachment.samples = this->samples;
 		vulkanColorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-		vulkanColorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+		vulkanColorAttachment.storeOp = this->isMultisampled() ? VK_ATTACHMENT_STORE_OP_DONT_CARE : vulkanSceneStoreOp;
 		vulkanColorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
 		vulkanColorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
 		vulkanColorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		vulkanColorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+		vulkanColorAttachment.finalLayout =
+				this->isMultisampled() ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : vulkanSceneLayout;
 
 		VkAttachmentReference vulkanColorAttachmentRef = {};
 
-		vulkanColorAttachmentRef.attachment = 0;
+		vulkanColorAttachmentRef.attachment = static_cast<unsigned int>(vulkanAttachments.size());
 		vulkanColorAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 
-		VkSubpassDescription vulkanSubpass = {};
+		vulkanAttachments.push_back(vulkanColorAttachment);
+
+		VkAttachmentDescription vulkanDepthAttachment = {};
+
+		vulkanDepthAttachment.format = this->depthFormat;
+		vulkanDepthAttachment.samples = this->samples;
+		vulkanDepthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+		vulkanDepthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		vulkanDepthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		vulkanDepthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		vulkanDepthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		vulkanDepthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+		VkAttachmentReference vulkanDepthAttachmentRef = {};
+
+		vulkanDepthAttachmentRef.attachment = static_cast<unsigned int>(vulkanAttachments.size());
+		vulkanDepthAttachmentRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+		if(this->hasDepth())
+			vulkanAttachments.push_back(vulkanDepthAttachment);
+
+		VkAttachmentDescription vulkanResolveAttachment = {};
+
+		vulkanResolveAttachment.format = this->format;
+		vulkanResolveAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+		vulkanResolveAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		vulkanResolveAttachment.storeOp = vulkanSceneStoreOp;
+		vulkanResolveAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		vulkanResolveAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		vulkanResolveAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		vulkanResolveAttachment.finalLayout = vulkanSceneLayout;
 
-		vulkanSubpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
-		vulkanSubpass.colorAttachmentCount = 1;
-		vulkanSubpass.pColorAttachments = &vulkanColorAttachmentRef;
+		VkAttachmentReference vulkanResolveAttachmentRef = {};
+
+		vulkanResolveAttachmentRef.attachment = static_cast<unsigned int>(vulkanAttachments.size());
+		vulkanResolveAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+		if(this->isMultisampled())
+			vulkanAttachments.push_back(vulkanResolveAttachment);
+
+		// the post-processing subpass reads the (resolved) scene as input attachment and writes the target image
+		VkAttachmentReference vulkanInputAttachmentRef = {};
+
+		vulkanInputAttachmentRef.attachment = this->isMultisampled() ? vulkanResolveAttachmentRef.attachment : 0;
+		vulkanInputAttachmentRef.layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+		VkAttachmentDescription vulkanTargetAttachment = {};
+
+		vulkanTargetAttachment.format = this->format;
+		vulkanTargetAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+		vulkanTargetAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE; // completely overwritten
+		vulkanTargetAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+		vulkanTargetAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+		vulkanTargetAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+		vulkanTargetAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		vulkanTargetAttachment.finalLayout = this->targetLayout;
+
+		VkAttachmentReference vulkanTargetAttachmentRef = {};
+
+		vulkanTargetAttachmentRef.attachment = static_cast<unsigned int>(vulkanAttachments.size());
+		vulkanTargetAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+		if(this->postSubpass)
+			vulkanAttachments.push_back(vulkanTargetAttachment);
+
+		VkSubpassDescription vulkanSubpasses[2] = {};
+
+		vulkanSubpasses[0].pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+		vulkanSubpasses[0].colorAttachmentCount = 1;
+		vulkanSubpasses[0].pColorAttachments = &vulkanColorAttachmentRef;
+		vulkanSubpasses[0].pResolveAttachments = this->isMultisampled() ? &vulkanResolveAttachmentRef : nullptr;
+		vulkanSubpasses[0].pDepthStencilAttachment = this->hasDepth() ? &vulkanDepthAttachmentRef : nullptr;
+
+		vulkanSubpasses[1].pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+		vulkanSubpasses[1].inputAttachmentCount = 1;
+		vulkanSubpasses[1].pInputAttachments = &vulkanInputAttachmentRef;
+		vulkanSubpasses[1].colorAttachmentCount = 1;
+		vulkanSubpasses[1].pColorAttachments = &vulkanTargetAttachmentRef;
+
+		// subpass dependencies (the depth buffer is shared by all frames, so that writing to it needs to be serialized)
+		std::vector<VkSubpassDependency> vulkanDependencies;
 
-		// subpass dependencies
 		VkSubpassDependency vulkanDependency = {};
 
 		vulkanDependency.srcSubpass = VK_SUBPASS_EXTERNAL;
@@ -101,15 +307,51 @@ namespace spacelite::Wrapper {
 		vulkanDependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 		vulkanDependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
 
+		if(this->hasDepth()) {
+			vulkanDependency.srcStageMask |= VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+			vulkanDependency.srcAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+			vulkanDependency.dstStageMask |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+			vulkanDependency.dstAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+		}
+
+		vulkanDependencies.push_back(vulkanDependency);
+
+		if(this->postSubpass) {
+			// read the scene only where it has been written (by region, i.e. without leaving the tile)
+			VkSubpassDependency vulkanInputDependency = {};
+
+			vulkanInputDependency.srcSubpass = 0;
+			vulkanInputDependency.dstSubpass = 1;
+			vulkanInputDependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+			vulkanInputDependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+			vulkanInputDependency.dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+			vulkanInputDependency.dstAccessMask = VK_ACCESS_INPUT_ATTACHMENT_READ_BIT;
+			vulkanInputDependency.dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
+
+			vulkanDependencies.push_back(vulkanInputDependency);
+
+			// write the target image only after it has been acquired
+			VkSubpassDependency vulkanTargetDependency = {};
+
+			vulkanTargetDependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+			vulkanTargetDependency.dstSubpass = 1;
+			vulkanTargetDependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+			vulkanTargetDependency.srcAccessMask = 0;
+			vulkanTargetDependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+			vulkanTargetDependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+			vulkanDependencies.push_back(vulkanTargetDependency);
+		}
+
 		VkRenderPassCreateInfo vulkanRenderPassInfo = {};
 
 		vulkanRenderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-		vulkanRenderPassInfo.attachmentCount = 1;
-		vulkanRenderPassInfo.pAttachments = &vulkanColorAttachment;
-		vulkanRenderPassInfo.subpassCount = 1;
-		vulkanRenderPassInfo.pSubpasses = &vulkanSubpass;
-		vulkanRenderPassInfo.dependencyCount = 1;
-		vulkanRenderPassInfo.pDependencies = &vulkanDependency;
+		vulkanRenderPassInfo.attachmentCount = static_cast<unsigned int>(vulkanAttachments.size());
+		vulkanRenderPassInfo.pAttachments = vulkanAttachments.data();
+		vulkanRenderPassInfo.subpassCount = this->postSubpass ? 2 : 1;
+		vulkanRenderPassInfo.pSubpasses = vulkanSubpasses;
+		vulkanRenderPassInfo.dependencyCount = static_cast<unsigned int>(vulkanDependencies.size());
+		vulkanRenderPassInfo.pDependencies = vulkanDependencies.data();
 
 		VkResult vulkanResult = vkCreateRenderPass(
 				this->parent.get(),
@@ -131,6 +373,161 @@ namespace spacelite::Wrapper {
 		}
 	}
 
+	// begin rendering into a target (the command buffer needs to be recording)
+	inline void VulkanRenderPass::begin(
+			VkCommandBuffer commandBuffer,
+			const Struct::VulkanRenderTarget& target,
+			const VkClearValue& clearValue
+	) {
+		VkRect2D vulkanRenderArea = {};
+
+		vulkanRenderArea.offset = { 0, 0 };
+		vulkanRenderArea.extent = target.extent;
+
+		VkClearValue vulkanDepthClearValue = {};
+
+		vulkanDepthClearValue.depthStencil = { 1.0f, 0 };
+
+#ifdef VK_KHR_dynamic_rendering
+		if(this->dynamic) {
+			// transition the image for rendering (discarding its previous contents, because it will be cleared),
+			//  unless it is already in the attachment layout
+			if(this->targetLayout != VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL)
+				VulkanRenderPass::transition(
+						commandBuffer,
+						target.image,
+						VK_IMAGE_ASPECT_COLOR_BIT,
+						VK_IMAGE_LAYOUT_UNDEFINED,
+						VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+						VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+						0,
+						VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+						VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+				);
+
+			// transition the multisampled image (after the previous frame has finished using it)
+			if(this->isMultisampled())
+				VulkanRenderPass::transition(
+						commandBuffer,
+						target.multisampledImage,
+						VK_IMAGE_ASPECT_COLOR_BIT,
+						VK_IMAGE_LAYOUT_UNDEFINED,
+						VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+						VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+						VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+						VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+						VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+				);
+
+			// transition the depth buffer (after the previous frame has finished using it)
+			if(this->hasDepth())
+				VulkanRenderPass::transition(
+						commandBuffer,
+						target.depthImage,
+						VulkanRenderPass::getDepthAspect(this->depthFormat),
+						VK_IMAGE_LAYOUT_UNDEFINED,
+						VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+						VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+						VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+						VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+						VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+				);
+
+			VkRenderingAttachmentInfoKHR vulkanColorAttachment = {};
+
+			vulkanColorAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+			vulkanColorAttachment.imageView = target.imageView;
+			vulkanColorAttachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+			vulkanColorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+			vulkanColorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+			vulkanColorAttachment.clearValue = clearValue;
+
+			if(this->isMultisampled()) {
+				// render into the multisampled image, resolve into the target image
+				vulkanColorAttachment.imageView = target.multisampledImageView;
+				vulkanColorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+				vulkanColorAttachment.resolveMode = VK_RESOLVE_MODE_AVERAGE_BIT_KHR;
+				vulkanColorAttachment.resolveImageView = target.imageView;
+				vulkanColorAttachment.resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+			}
+
+			VkRenderingAttachmentInfoKHR vulkanDepthAttachment = {};
+
+			vulkanDepthAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+			vulkanDepthAttachment.imageView = target.depthImageView;
+			vulkanDepthAttachment.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+			vulkanDepthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+			vulkanDepthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+			vulkanDepthAttachment.clearValue = vulkanDepthClearValue;
+
+			VkRenderingInfoKHR vulkanRenderingInfo = {};
+
+			vulkanRenderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+			vulkanRenderingInfo.renderArea = vulkanRenderArea;
+			vulkanRenderingInfo.layerCount = 1;
+			vulkanRenderingInfo.colorAttachmentCount = 1;
+			vulkanRenderingInfo.pColorAttachments = &vulkanColorAttachment;
+			vulkanRenderingInfo.pDepthAttachment = this->hasDepth() ? &vulkanDepthAttachment : nullptr;
+
+			this->beginRendering(commandBuffer, &vulkanRenderingInfo);
+
+			return;
+		}
+#endif
+
+		VkRenderPassBeginInfo vulkanRenderPassInfo = {};
+
+		vulkanRenderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+		vulkanRenderPassInfo.renderPass = this->instance;
+		vulkanRenderPassInfo.framebuffer = target.frameBuffer;
+		vulkanRenderPassInfo.renderArea = vulkanRenderArea;
+
+		// the resolve attachment and the target of the post-processing subpass (if any) are not cleared
+		const VkClearValue vulkanClearValues[] = { clearValue, vulkanDepthClearValue };
+
+		vulkanRenderPassInfo.clearValueCount = this->hasDepth() ? 2 : 1;
+		vulkanRenderPassInfo.pClearValues = vulkanClearValues;
+
+		vkCmdBeginRenderPass(commandBuffer, &vulkanRenderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+	}
+
+	// end rendering into a target (the image will be in the target layout afterwards)
+	//  NOTE:	Accesses to the image after the render pass need to be synchronized separately,
+	//			unless it is presented afterwards.
+	inline void VulkanRenderPass::end(VkCommandBuffer commandBuffer, const Struct::VulkanRenderTarget& target) {
+#ifdef VK_KHR_dynamic_rendering
+		if(this->dynamic) {
+			this->endRendering(commandBuffer);
+
+			// transition the image into the target layout (e.g. for presentation)
+			if(this->targetLayout != VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL)
+				VulkanRenderPass::transition(
+						commandBuffer,
+						target.image,
+						VK_IMAGE_ASPECT_COLOR_BIT,
+						VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+						this->targetLayout,
+						VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+						VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+						VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+						0
+				);
+
+			return;
+		}
+#else
+		static_cast<void>(target);
+#endif
+
+		vkCmdEndRenderPass(commandBuffer);
+	}
+
+	// continue with the post-processing subpass (if the render pass has one)
+	inline void VulkanRenderPass::next(VkCommandBuffer commandBuffer) {
+		if(this->postSubpass)
+			vkCmdNextSubpass(commandBuffer, VK_SUBPASS_CONTENTS_INLINE);
+	}
+
 	// get reference to the instance of the render pass
 	inline VkRenderPass& VulkanRenderPass::get() {
 		return this->instance;
@@ -141,17 +538,130 @@ namespace spacelite::Wrapper {
 		return this->instance;
 	}
 
+	// get const reference to the format of the (color) attachment
+	inline const VkFormat& VulkanRenderPass::getFormat() const {
+		return this->format;
+	}
+
+	// get const reference to the format of the depth attachment (undefined if there is none)
+	inline const VkFormat& VulkanRenderPass::getDepthFormat() const {
+		return this->depthFormat;
+	}
+
+	// check whether the render pass uses a depth attachment
+	inline bool VulkanRenderPass::hasDepth() const {
+		return this->depthFormat != VK_FORMAT_UNDEFINED;
+	}
+
+	// get the number of samples per pixel used by the color and depth attachments
+	inline VkSampleCountFlagBits VulkanRenderPass::getSamples() const {
+		return this->samples;
+	}
+
+	// check whether multisampling is used (i.e. whether the color attachment needs to be resolved)
+	inline bool VulkanRenderPass::isMultisampled() const {
+		return this->samples != VK_SAMPLE_COUNT_1_BIT;
+	}
+
+	// check whether dynamic rendering is used instead of a render pass object
+	inline bool VulkanRenderPass::isDynamic() const {
+		return this->dynamic;
+	}
+
+	// check whether the render pass has a post-processing subpass (reading the scene as input attachment)
+	inline bool VulkanRenderPass::hasPostProcessingSubpass() const {
+		return this->postSubpass;
+	}
+
+	// get the layout the target image is left in
+	inline VkImageLayout VulkanRenderPass::getTargetLayout() const {
+		return this->targetLayout;
+	}
+
+	// get a hash of all properties that decide whether the render pass is compatible to another one
+	//  (graphics pipelines created for a render pass can be used with all compatible render passes)
+	inline std::size_t VulkanRenderPass::getCompatibilityHash() const {
+		std::size_t result = 0;
+
+		Helper::Hash::combine(result, static_cast<int>(this->format));					// color attachment format
+		Helper::Hash::combine(result, static_cast<int>(this->samples));				// attachment samples
+		Helper::Hash::combine(result, static_cast<int>(this->depthFormat));			// depth attachment format
+		Helper::Hash::combine(result, this->dynamic);									// dynamic rendering
+		Helper::Hash::combine(result, this->postSubpass);								// number of subpasses
+
+		return result;
+	}
+
+	// static helper function to get the aspects of a depth buffer (including its stencil component, if available)
+	inline VkImageAspectFlags VulkanRenderPass::getDepthAspect(VkFormat format) {
+		if(format == VK_FORMAT_D32_SFLOAT_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT)
+			return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+
+		return VK_IMAGE_ASPECT_DEPTH_BIT;
+	}
+
+	// static helper function to record the transition of an image into another layout
+	inline void VulkanRenderPass::transition(
+			VkCommandBuffer commandBuffer,
+			VkImage image,
+			VkImageAspectFlags aspect,
+			VkImageLayout oldLayout,
+			VkImageLayout newLayout,
+			VkPipelineStageFlags srcStage,
+			VkAccessFlags srcAccess,
+			VkPipelineStageFlags dstStage,
+			VkAccessFlags dstAccess
+	) {
+		VkImageMemoryBarrier vulkanBarrier = {};
+
+		vulkanBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		vulkanBarrier.srcAccessMask = srcAccess;
+		vulkanBarrier.dstAccessMask = dstAccess;
+		vulkanBarrier.oldLayout = oldLayout;
+		vulkanBarrier.newLayout = newLayout;
+		vulkanBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		vulkanBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		vulkanBarrier.image = image;
+		vulkanBarrier.subresourceRange.aspectMask = aspect;
+		vulkanBarrier.subresourceRange.baseMipLevel = 0;
+		vulkanBarrier.subresourceRange.levelCount = 1;
+		vulkanBarrier.subresourceRange.baseArrayLayer = 0;
+		vulkanBarrier.subresourceRange.layerCount = 1;
+
+		vkCmdPipelineBarrier(commandBuffer, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &vulkanBarrier);
+	}
+
 	// move constructor
 	inline VulkanRenderPass::VulkanRenderPass(VulkanRenderPass&& other) noexcept
 			:	parent(other.parent),
 				instance(other.instance),
-				format(other.format) {
+				format(other.format),
+				depthFormat(other.depthFormat),
+				samples(other.samples),
+				dynamic(other.dynamic),
+				postSubpass(other.postSubpass),
+				targetLayout(other.targetLayout)
+#ifdef VK_KHR_dynamic_rendering
+				,
+				beginRendering(other.beginRendering),
+				endRendering(other.endRendering)
+#endif
+	{
 		other.instance = VK_NULL_HANDLE;
 	}
 
 	// move assignment
 	inline VulkanRenderPass& VulkanRenderPass::operator=(VulkanRenderPass&& other) noexcept {
 		this->instance = other.instance;
+		this->depthFormat = other.depthFormat;
+		this->samples = other.samples;
+		this->dynamic = other.dynamic;
+		this->postSubpass = other.postSubpass;
+		this->targetLayout = other.targetLayout;
+#ifdef VK_KHR_dynamic_rendering
+		this->beginRendering = other.beginRendering;
+		this->endRendering = other.endRendering;
+#endif
 
 		other.instance = VK_NULL_HANDLE;
 
@@ -0,0 +1,131 @@
+/*
+ * VulkanSampler.hpp
+ *
+ * Wraps a sampler used by the Vulkan API.
+ *
+ * Without mipmaps, so that it can be used to sample offscreen images (e.g. for post-processing).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANSAMPLER_HPP_
+#define SRC_WRAPPER_VULKANSAMPLER_HPP_
+
+#include "VulkanDevice.hpp"
+#include "VulkanError.hpp"
+
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Main/Exception.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <utility>	// std::swap
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanSampler {
+	public:
+		VulkanSampler(
+				VulkanDevice& device,
+				VkFilter filter = VK_FILTER_LINEAR,
+				VkSamplerAddressMode addressMode = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE
+		);
+		virtual ~VulkanSampler();
+
+		// getters
+		VkSampler& get();
+		const VkSampler& get() const;
+
+		// not copyable, only moveable
+		VulkanSampler(const VulkanSampler&) = delete;
+		VulkanSampler(VulkanSampler&& other) noexcept;
+		VulkanSampler& operator=(const VulkanSampler&) = delete;
+		VulkanSampler& operator=(VulkanSampler&& other) noexcept;
+
+	private:
+		VulkanDevice& parent;
+		VkSampler instance;
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the sampler
+	inline VulkanSampler::VulkanSampler(
+			VulkanDevice& device,
+			VkFilter filter,
+			VkSamplerAddressMode addressMode
+	) : parent(device), instance(VK_NULL_HANDLE) {
+		VkSamplerCreateInfo vulkanCreateInfo = {};
+
+		vulkanCreateInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+		vulkanCreateInfo.magFilter = filter;
+		vulkanCreateInfo.minFilter = filter;
+		vulkanCreateInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+		vulkanCreateInfo.addressModeU = addressMode;
+		vulkanCreateInfo.addressModeV = addressMode;
+		vulkanCreateInfo.addressModeW = addressMode;
+		vulkanCreateInfo.mipLodBias = 0.0f;
+		vulkanCreateInfo.anisotropyEnable = VK_FALSE;
+		vulkanCreateInfo.maxAnisotropy = 1.0f;
+		vulkanCreateInfo.compareEnable = VK_FALSE;
+		vulkanCreateInfo.compareOp = VK_COMPARE_OP_ALWAYS;
+		vulkanCreateInfo.minLod = 0.0f;
+		vulkanCreateInfo.maxLod = 0.0f;
+		vulkanCreateInfo.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_BLACK;
+		vulkanCreateInfo.unnormalizedCoordinates = VK_FALSE;
+
+		VkResult vulkanResult = vkCreateSampler(
+				this->parent.get(),
+				&vulkanCreateInfo,
+				Helper::VulkanAllocator::ptr,
+				&(this->instance)
+		);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not create sampler: " + Wrapper::VulkanError(vulkanResult).str());
+	}
+
+	// destructor: destroy the sampler
+	inline VulkanSampler::~VulkanSampler() {
+		if(this->instance)
+			vkDestroySampler(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
+	}
+
+	// get reference to the instance of the sampler
+	inline VkSampler& VulkanSampler::get() {
+		return this->instance;
+	}
+
+	// get const reference to the instance of the sampler
+	inline const VkSampler& VulkanSampler::get() const {
+		return this->instance;
+	}
+
+	// move constructor
+	inline VulkanSampler::VulkanSampler(VulkanSampler&& other) noexcept
+			:	parent(other.parent),
+				instance(other.instance) {
+		other.instance = VK_NULL_HANDLE;
+	}
+
+	// move assignment
+	inline VulkanSampler& VulkanSampler::operator=(VulkanSampler&& other) noexcept {
+		using std::swap;
+
+		swap(this->parent, other.parent);
+		swap(this->instance, other.instance);
+
+		return *this;
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANSAMPLER_HPP_ */
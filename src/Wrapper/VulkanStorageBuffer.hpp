@@ -0,0 +1,81 @@
+/*
+ * VulkanStorageBuffer.hpp
+ *
+ * Wraps a storage buffer on the device for the Vulkan API by using the base class for general buffers.
+ *
+ * The buffer is written by shaders (e.g. compute shaders) and can be used for other purposes at the same time,
+ *  e.g. as vertex buffer, so that its content never needs to be copied back to the host.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANSTORAGEBUFFER_HPP_
+#define SRC_WRAPPER_VULKANSTORAGEBUFFER_HPP_
+
+#include "VulkanBuffer.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanStorageBuffer : public VulkanBuffer {
+	public:
+		VulkanStorageBuffer(
+				VulkanDevice& device,
+				VulkanPhysicalDevice& physicalDevice,
+				VulkanCommandPool& commandPool,
+				bool isExclusive,
+				unsigned long size,
+				VkBufferUsageFlags additionalUsageFlags = 0
+		);
+
+		// getters
+		VkDescriptorBufferInfo getDescriptorInfo() const;
+		unsigned long getSize() const;
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the buffer on the device (its content is undefined until it has been written by a shader)
+	inline VulkanStorageBuffer::VulkanStorageBuffer(
+			VulkanDevice& device,
+			VulkanPhysicalDevice& physicalDevice,
+			VulkanCommandPool& commandPool,
+			bool isExclusive,
+			unsigned long size,
+			VkBufferUsageFlags additionalUsageFlags
+	) : VulkanBuffer(
+			device,
+			physicalDevice,
+			commandPool,
+			size,
+			isExclusive,
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | additionalUsageFlags,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+	) {}
+
+	// get the information needed to bind the whole buffer to a descriptor set
+	inline VkDescriptorBufferInfo VulkanStorageBuffer::getDescriptorInfo() const {
+		VkDescriptorBufferInfo vulkanBufferInfo = {};
+
+		vulkanBufferInfo.buffer = this->instance;
+		vulkanBufferInfo.offset = 0;
+		vulkanBufferInfo.range = VK_WHOLE_SIZE;
+
+		return vulkanBufferInfo;
+	}
+
+	// get the size of the buffer (in bytes)
+	inline unsigned long VulkanStorageBuffer::getSize() const {
+		return this->maxContentSize;
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANSTORAGEBUFFER_HPP_ */
@@ -22,6 +22,7 @@
 #include <vulkan/vulkan_core.h>
 
 #include <algorithm>	// std::clamp
+#include <limits>		// std::numeric_limits
 #include <utility>		// std::move, std::swap
 #include <vector>		// std::vector
 
@@ -53,6 +54,7 @@ namespace spacelite::Wrapper {
 		VkExtent2D& getExtent();
 		const VkExtent2D& getExtent() const;
 		unsigned int getNumberOfImageViews() const;
+		VkImage getImage(unsigned int index) const;
 		const VulkanImageView& getImageView(unsigned int index) const;
 		unsigned int getInFlightMax() const;
 
@@ -155,6 +157,11 @@ namespace spacelite::Wrapper {
 		return this->inFlightMax;
 	}
 
+	// get index-specified image from the swap chain
+	inline VkImage VulkanSwapChain::getImage(unsigned int index) const {
+		return this->images.at(index);
+	}
+
 	// get index-specified image view from the swap chain
 	inline const VulkanImageView& VulkanSwapChain::getImageView(unsigned int index) const {
 		return this->imageViews.at(index);
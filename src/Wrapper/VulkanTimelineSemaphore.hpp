@@ -0,0 +1,232 @@
+/*
+ * VulkanTimelineSemaphore.hpp
+ *
+ * Wraps a timeline semaphore used by the Vulkan API.
+ *
+ * The semaphore keeps the last value that has been handed out for signaling, so that submissions can wait
+ *  for specific values and the host can wait for the work of a specific frame to be finished.
+ *
+ * Needs timeline semaphores to be supported by the device (either by Vulkan API v1.2 or by the extension).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANTIMELINESEMAPHORE_HPP_
+#define SRC_WRAPPER_VULKANTIMELINESEMAPHORE_HPP_
+
+#include "VulkanDevice.hpp"
+#include "VulkanError.hpp"
+
+#include "../Helper/VulkanAllocator.hpp"
+#include "../Main/Exception.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>	// std::uint64_t
+#include <limits>	// std::numeric_limits
+#include <utility>	// std::swap
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanTimelineSemaphore {
+	public:
+		explicit VulkanTimelineSemaphore(VulkanDevice& device);
+		virtual ~VulkanTimelineSemaphore();
+
+		// get the next value to signal (increases the last value)
+		std::uint64_t next();
+
+		// wait on the host until the semaphore has reached a value
+		void wait(std::uint64_t value) const;
+
+		// getters
+		VkSemaphore& get();
+		const VkSemaphore& get() const;
+		std::uint64_t getLast() const;
+		std::uint64_t getValue() const;
+
+		// not copyable, only moveable
+		VulkanTimelineSemaphore(const VulkanTimelineSemaphore&) = delete;
+		VulkanTimelineSemaphore(VulkanTimelineSemaphore&& other) noexcept;
+		VulkanTimelineSemaphore& operator=(const VulkanTimelineSemaphore&) = delete;
+		VulkanTimelineSemaphore& operator=(VulkanTimelineSemaphore&& other) noexcept;
+
+	private:
+		VulkanDevice& parent;
+		VkSemaphore instance;
+		std::uint64_t last;
+
+#ifdef VK_KHR_timeline_semaphore
+		PFN_vkWaitSemaphoresKHR waitSemaphores;
+		PFN_vkGetSemaphoreCounterValueKHR getCounterValue;
+#endif
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the semaphore (starting at zero) and get the functions for timeline semaphores
+	inline VulkanTimelineSemaphore::VulkanTimelineSemaphore(VulkanDevice& device)
+			:	parent(device),
+				instance(VK_NULL_HANDLE),
+				last(0)
+#ifdef VK_KHR_timeline_semaphore
+				,
+				waitSemaphores(nullptr),
+				getCounterValue(nullptr)
+#endif
+	{
+		if(!(this->parent.getCapabilities().timelineSemaphores))
+			throw Exception("Timeline semaphores are not supported by the device");
+
+#ifdef VK_KHR_timeline_semaphore
+		// get the functions for timeline semaphores (either from the core API or from the extension)
+		this->waitSemaphores = reinterpret_cast<PFN_vkWaitSemaphoresKHR>(
+				vkGetDeviceProcAddr(this->parent.get(), "vkWaitSemaphores")
+		);
+		this->getCounterValue = reinterpret_cast<PFN_vkGetSemaphoreCounterValueKHR>(
+				vkGetDeviceProcAddr(this->parent.get(), "vkGetSemaphoreCounterValue")
+		);
+
+		if(!(this->waitSemaphores) || !(this->getCounterValue)) {
+			this->waitSemaphores = reinterpret_cast<PFN_vkWaitSemaphoresKHR>(
+					vkGetDeviceProcAddr(this->parent.get(), "vkWaitSemaphoresKHR")
+			);
+			this->getCounterValue = reinterpret_cast<PFN_vkGetSemaphoreCounterValueKHR>(
+					vkGetDeviceProcAddr(this->parent.get(), "vkGetSemaphoreCounterValueKHR")
+			);
+		}
+
+		if(!(this->waitSemaphores) || !(this->getCounterValue))
+			throw Exception("Could not get the functions for timeline semaphores");
+
+		// create the semaphore
+		VkSemaphoreTypeCreateInfoKHR vulkanTypeInfo = {};
+
+		vulkanTypeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+		vulkanTypeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+		vulkanTypeInfo.initialValue = 0;
+
+		VkSemaphoreCreateInfo vulkanSemaphoreInfo = {};
+
+		vulkanSemaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+		vulkanSemaphoreInfo.pNext = &vulkanTypeInfo;
+
+		VkResult vulkanResult = vkCreateSemaphore(
+				this->parent.get(),
+				&vulkanSemaphoreInfo,
+				Helper::VulkanAllocator::ptr,
+				&(this->instance)
+		);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not create timeline semaphore: " + Wrapper::VulkanError(vulkanResult).str());
+#else
+		throw Exception("Timeline semaphores are not supported by the Vulkan API headers");
+#endif
+	}
+
+	// destructor: destroy the semaphore
+	inline VulkanTimelineSemaphore::~VulkanTimelineSemaphore() {
+		if(this->instance)
+			vkDestroySemaphore(this->parent.get(), this->instance, Helper::VulkanAllocator::ptr);
+	}
+
+	// get the next value to signal (increases the last value)
+	inline std::uint64_t VulkanTimelineSemaphore::next() {
+		return ++(this->last);
+	}
+
+	// wait on the host until the semaphore has reached a value (returns immediately for zero)
+	inline void VulkanTimelineSemaphore::wait(std::uint64_t value) const {
+		if(!value)
+			return;
+
+#ifdef VK_KHR_timeline_semaphore
+		VkSemaphoreWaitInfoKHR vulkanWaitInfo = {};
+
+		vulkanWaitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+		vulkanWaitInfo.semaphoreCount = 1;
+		vulkanWaitInfo.pSemaphores = &(this->instance);
+		vulkanWaitInfo.pValues = &value;
+
+		VkResult vulkanResult = this->waitSemaphores(
+				this->parent.get(),
+				&vulkanWaitInfo,
+				std::numeric_limits<std::uint64_t>::max()
+		);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not wait for timeline semaphore: " + Wrapper::VulkanError(vulkanResult).str());
+#endif
+	}
+
+	// get reference to the instance of the semaphore
+	inline VkSemaphore& VulkanTimelineSemaphore::get() {
+		return this->instance;
+	}
+
+	// get const reference to the instance of the semaphore
+	inline const VkSemaphore& VulkanTimelineSemaphore::get() const {
+		return this->instance;
+	}
+
+	// get the last value that has been handed out for signaling
+	inline std::uint64_t VulkanTimelineSemaphore::getLast() const {
+		return this->last;
+	}
+
+	// get the current value of the semaphore (i.e. the last value that has been signaled on the device)
+	inline std::uint64_t VulkanTimelineSemaphore::getValue() const {
+		std::uint64_t result = 0;
+
+#ifdef VK_KHR_timeline_semaphore
+		VkResult vulkanResult = this->getCounterValue(this->parent.get(), this->instance, &result);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not get value of timeline semaphore: " + Wrapper::VulkanError(vulkanResult).str());
+#endif
+
+		return result;
+	}
+
+	// move constructor
+	inline VulkanTimelineSemaphore::VulkanTimelineSemaphore(VulkanTimelineSemaphore&& other) noexcept
+			:	parent(other.parent),
+				instance(other.instance),
+				last(other.last)
+#ifdef VK_KHR_timeline_semaphore
+				,
+				waitSemaphores(other.waitSemaphores),
+				getCounterValue(other.getCounterValue)
+#endif
+	{
+		other.instance = VK_NULL_HANDLE;
+	}
+
+	// move assignment
+	inline VulkanTimelineSemaphore& VulkanTimelineSemaphore::operator=(VulkanTimelineSemaphore&& other) noexcept {
+		using std::swap;
+
+		swap(this->parent, other.parent);
+		swap(this->instance, other.instance);
+		swap(this->last, other.last);
+
+#ifdef VK_KHR_timeline_semaphore
+		swap(this->waitSemaphores, other.waitSemaphores);
+		swap(this->getCounterValue, other.getCounterValue);
+#endif
+
+		return *this;
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANTIMELINESEMAPHORE_HPP_ */
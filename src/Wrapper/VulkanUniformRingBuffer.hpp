@@ -0,0 +1,211 @@
+/*
+ * VulkanUniformRingBuffer.hpp
+ *
+ * Wraps a persistently mapped uniform buffer for the Vulkan API by using the base class for general buffers.
+ *
+ * The buffer is split into one region per frame in flight. For each frame, uniform data is pushed into its region
+ *  and the returned (aligned) offsets are used as dynamic offsets when binding a descriptor set for the buffer,
+ *  so that per-frame and per-draw data does not need a buffer or a descriptor set of its own.
+ *
+ * The region of a frame may only be re-used after the GPU has finished the frame (i.e. after waiting for its fence).
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef SRC_WRAPPER_VULKANUNIFORMRINGBUFFER_HPP_
+#define SRC_WRAPPER_VULKANUNIFORMRINGBUFFER_HPP_
+
+#include "VulkanBuffer.hpp"
+#include "VulkanError.hpp"
+
+#include "../Main/Exception.hpp"
+
+#include <vulkan/vulkan_core.h>
+
+#include <cstdint>	// std::uint32_t
+#include <cstring>	// std::memcpy
+#include <string>	// std::to_string
+#include <utility>	// std::move, std::swap
+
+namespace spacelite::Wrapper {
+
+	/*
+	 * DECLARATION
+	 */
+	class VulkanUniformRingBuffer : public VulkanBuffer {
+	public:
+		VulkanUniformRingBuffer(
+				VulkanDevice& device,
+				VulkanPhysicalDevice& physicalDevice,
+				VulkanCommandPool& commandPool,
+				unsigned long sizePerFrame,
+				unsigned int numberOfFrames
+		);
+		virtual ~VulkanUniformRingBuffer();
+
+		// start pushing data for a frame (discards the data previously pushed for the same frame)
+		void begin(unsigned int frame);
+
+		// push data for the current frame and get its dynamic offset
+		std::uint32_t push(const void * in, unsigned long size);
+		template<typename T> std::uint32_t push(const T& in);
+
+		// getters
+		VkDescriptorBufferInfo getDescriptorInfo(unsigned long range) const;
+		unsigned long getAlignment() const;
+		unsigned long getFrameSize() const;
+
+		// not copyable, only moveable
+		VulkanUniformRingBuffer(const VulkanUniformRingBuffer&) = delete;
+		VulkanUniformRingBuffer(VulkanUniformRingBuffer&& other) noexcept;
+		VulkanUniformRingBuffer& operator=(const VulkanUniformRingBuffer&) = delete;
+		VulkanUniformRingBuffer& operator=(VulkanUniformRingBuffer&& other) noexcept;
+
+	private:
+		unsigned char * mapped;
+		unsigned long alignment;
+		unsigned long frameSize;
+		unsigned long head;
+		unsigned long end;
+
+		// align a size or offset
+		static unsigned long align(unsigned long value, unsigned long alignment);
+
+		MAIN_EXCEPTION_CLASS();
+	};
+
+	/*
+	 * IMPLEMENTATION
+	 */
+
+	// constructor: create the buffer in host-visible memory and map it (until its destruction)
+	//  NOTE:	The size of each region will be aligned to the minimum alignment of uniform buffer offsets.
+	inline VulkanUniformRingBuffer::VulkanUniformRingBuffer(
+			VulkanDevice& device,
+			VulkanPhysicalDevice& physicalDevice,
+			VulkanCommandPool& commandPool,
+			unsigned long sizePerFrame,
+			unsigned int numberOfFrames
+	) : VulkanBuffer(
+			device,
+			physicalDevice,
+			commandPool,
+			VulkanUniformRingBuffer::align(
+					sizePerFrame,
+					physicalDevice.getProperties().limits.minUniformBufferOffsetAlignment
+			) * numberOfFrames,
+			true,
+			VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+	),		mapped(nullptr),
+			alignment(physicalDevice.getProperties().limits.minUniformBufferOffsetAlignment),
+			frameSize(VulkanUniformRingBuffer::align(sizePerFrame, this->alignment)),
+			head(0),
+			end(this->frameSize) {
+		void * data = nullptr;
+
+		VkResult vulkanResult = vkMapMemory(this->parent.get(), this->memory.get(), 0, VK_WHOLE_SIZE, 0, &data);
+
+		if(vulkanResult != VK_SUCCESS)
+			throw Exception("Could not map uniform buffer: " + Wrapper::VulkanError(vulkanResult).str());
+
+		this->mapped = static_cast<unsigned char *>(data);
+	}
+
+	// destructor: unmap the buffer
+	inline VulkanUniformRingBuffer::~VulkanUniformRingBuffer() {
+		if(this->mapped)
+			vkUnmapMemory(this->parent.get(), this->memory.get());
+	}
+
+	// start pushing data for a frame (discards the data previously pushed for the same frame)
+	inline void VulkanUniformRingBuffer::begin(unsigned int frame) {
+		this->head = frame * this->frameSize;
+		this->end = this->head + this->frameSize;
+
+		if(this->end > this->maxContentSize)
+			throw Exception("Uniform buffer has no region for frame #" + std::to_string(frame));
+	}
+
+	// push data for the current frame and get its dynamic offset
+	inline std::uint32_t VulkanUniformRingBuffer::push(const void * in, unsigned long size) {
+		if(this->head + size > this->end)
+			throw Exception(
+					"Uniform buffer region is full (frame size is "
+					+ std::to_string(this->frameSize)
+					+ " bytes)"
+			);
+
+		const unsigned long offset = this->head;
+
+		std::memcpy(this->mapped + offset, in, size);
+
+		this->head = VulkanUniformRingBuffer::align(offset + size, this->alignment);
+
+		return static_cast<std::uint32_t>(offset);
+	}
+
+	// push data for the current frame and get its dynamic offset (templated version)
+	template<typename T> inline std::uint32_t VulkanUniformRingBuffer::push(const T& in) {
+		return this->push(&in, sizeof(T));
+	}
+
+	// get the information needed to write a dynamic uniform buffer descriptor for the buffer
+	inline VkDescriptorBufferInfo VulkanUniformRingBuffer::getDescriptorInfo(unsigned long range) const {
+		VkDescriptorBufferInfo vulkanBufferInfo = {};
+
+		vulkanBufferInfo.buffer = this->instance;
+		vulkanBufferInfo.offset = 0;
+		vulkanBufferInfo.range = range;
+
+		return vulkanBufferInfo;
+	}
+
+	// get the alignment of the dynamic offsets
+	inline unsigned long VulkanUniformRingBuffer::getAlignment() const {
+		return this->alignment;
+	}
+
+	// get the (aligned) size of the region for one frame
+	inline unsigned long VulkanUniformRingBuffer::getFrameSize() const {
+		return this->frameSize;
+	}
+
+	// align a size or offset
+	inline unsigned long VulkanUniformRingBuffer::align(unsigned long value, unsigned long alignment) {
+		if(!alignment)
+			return value;
+
+		return (value + alignment - 1) / alignment * alignment;
+	}
+
+	// move constructor
+	inline VulkanUniformRingBuffer::VulkanUniformRingBuffer(VulkanUniformRingBuffer&& other) noexcept
+			:	VulkanBuffer(std::move(other)),
+				mapped(other.mapped),
+				alignment(other.alignment),
+				frameSize(other.frameSize),
+				head(other.head),
+				end(other.end) {
+		other.mapped = nullptr;
+	}
+
+	// move assignment
+	inline VulkanUniformRingBuffer& VulkanUniformRingBuffer::operator=(VulkanUniformRingBuffer&& other) noexcept {
+		VulkanBuffer::operator=(std::move(other));
+
+		using std::swap;
+
+		swap(this->mapped, other.mapped);
+		swap(this->alignment, other.alignment);
+		swap(this->frameSize, other.frameSize);
+		swap(this->head, other.head);
+		swap(this->end, other.end);
+
+		return *this;
+	}
+
+} /* spacelite::Wrapper */
+
+#endif /* SRC_WRAPPER_VULKANUNIFORMRINGBUFFER_HPP_ */
@@ -0,0 +1,12 @@
+/*
+ * bench.cpp
+ *
+ * Entry point of the microbenchmark - one line only.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#include "Bench/WrapperBench.hpp"
+
+int main(int argc, char * argv[]) { return spacelite::Bench::WrapperBench(argc, argv).run(); }
@@ -9,4 +9,4 @@
 
 #include "Main/App.hpp"
 
-int main(int argc, char * argv[]) { return spacelite::Main::App::getInstance(argc, argv).run(); }
+int main(int argc, char * argv[]) { return spacelite::Main::App::main(argc, argv); }